@@ -0,0 +1,222 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "BenchmarkCorpus.h"
+
+#include "phasar/Config/phasar-config.h"
+#include "phasar/Utils/IO.h"
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/Twine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+
+namespace psr::bench {
+
+namespace {
+
+/// The Itanium-mangled name of class Idx, e.g., "3C10"
+std::string mangledClassName(unsigned Idx) {
+  auto Name = "C" + std::to_string(Idx);
+  return std::to_string(Name.size()) + Name;
+}
+
+llvm::StringRef typeInfoType(unsigned Idx) {
+  return Idx == 0 ? "{ i8*, i8* }" : "{ i8*, i8*, i8* }";
+}
+
+/// The classes form a binary tree rooted in C0. Each class overrides the only
+/// virtual function C0::get(int).
+void printClass(llvm::raw_ostream &OS, unsigned Idx) {
+  auto Mangled = mangledClassName(Idx);
+  auto ClassTy = "%class.C" + std::to_string(Idx);
+  auto NameLen = Mangled.size() + 1;
+
+  if (Idx == 0) {
+    OS << ClassTy << " = type { i32 (...)** }\n";
+  } else {
+    OS << ClassTy << " = type { %class.C" << (Idx - 1) / 2 << " }\n";
+  }
+
+  OS << "@_ZTS" << Mangled << " = linkonce_odr constant [" << NameLen
+     << " x i8] c\"" << Mangled << "\\00\"\n";
+
+  OS << "@_ZTI" << Mangled << " = linkonce_odr constant " << typeInfoType(Idx)
+     << " { i8* bitcast (i8** getelementptr inbounds (i8*, i8** "
+     << (Idx == 0 ? "@_ZTVN10__cxxabiv117__class_type_infoE"
+                  : "@_ZTVN10__cxxabiv120__si_class_type_infoE")
+     << ", i64 2) to i8*), i8* getelementptr inbounds ([" << NameLen
+     << " x i8], [" << NameLen << " x i8]* @_ZTS" << Mangled
+     << ", i32 0, i32 0)";
+  if (Idx != 0) {
+    auto Parent = (Idx - 1) / 2;
+    OS << ", i8* bitcast (" << typeInfoType(Parent) << "* @_ZTI"
+       << mangledClassName(Parent) << " to i8*)";
+  }
+  OS << " }\n";
+
+  OS << "@_ZTV" << Mangled
+     << " = linkonce_odr unnamed_addr constant { [3 x i8*] } { [3 x i8*] [i8* "
+        "null, i8* bitcast ("
+     << typeInfoType(Idx) << "* @_ZTI" << Mangled << " to i8*), i8* bitcast (i32 ("
+     << ClassTy << "*, i32)* @_ZN" << Mangled << "3getEi to i8*)] }\n";
+
+  OS << "define linkonce_odr i32 @_ZN" << Mangled << "3getEi(" << ClassTy
+     << "* %this, i32 %x) {\n"
+     << "entry:\n"
+     << "  %r = add i32 %x, " << Idx << "\n"
+     << "  ret i32 %r\n"
+     << "}\n\n";
+}
+
+void printFunction(llvm::raw_ostream &OS, unsigned Idx, unsigned NumFunctions,
+                   unsigned NumClasses) {
+  auto Cls = Idx % NumClasses;
+  auto ClassTy = "%class.C" + std::to_string(Cls);
+  auto VTable = "@_ZTV" + mangledClassName(Cls);
+  auto Child1 = 2 * Idx + 1;
+  auto Child2 = 2 * Idx + 2;
+
+  OS << "define i32 @f" << Idx << "(i32 %x, i32* %p) {\n"
+     << "entry:\n"
+     << "  %a = alloca i32\n"
+     << "  %obj = alloca " << ClassTy << '\n';
+  if (Idx % 7 == 3) {
+    OS << "  %src = call i32 @source()\n"
+       << "  store i32 %src, i32* %a\n";
+  } else {
+    OS << "  store i32 %x, i32* %a\n";
+  }
+  OS << "  %v = load i32, i32* %a\n"
+     << "  %cmp = icmp sgt i32 %v, " << Idx << '\n'
+     << "  br i1 %cmp, label %then, label %join\n"
+     << "then:\n"
+     << "  %v.then = mul i32 %v, 3\n"
+     << "  store i32 %v.then, i32* %p\n"
+     << "  br label %join\n"
+     << "join:\n"
+     << "  %s = phi i32 [ %v.then, %then ], [ %v, %entry ]\n";
+
+  // Install the vtable of the dynamic type and call get() through C0
+  OS << "  %vptr = bitcast " << ClassTy << "* %obj to i32 (...)***\n"
+     << "  store i32 (...)** bitcast (i8** getelementptr inbounds ({ [3 x i8*] "
+        "}, { [3 x i8*] }* "
+     << VTable
+     << ", i32 0, inrange i32 0, i32 2) to i32 (...)**), i32 (...)*** %vptr\n";
+  if (Cls == 0) {
+    OS << "  %base = getelementptr inbounds %class.C0, %class.C0* %obj, i32 0\n";
+  } else {
+    OS << "  %base = bitcast " << ClassTy << "* %obj to %class.C0*\n";
+  }
+  OS << "  %vtbl.addr = bitcast %class.C0* %base to i32 (%class.C0*, i32)***\n"
+     << "  %vtbl = load i32 (%class.C0*, i32)**, i32 (%class.C0*, i32)*** "
+        "%vtbl.addr\n"
+     << "  %slot = getelementptr inbounds i32 (%class.C0*, i32)*, i32 "
+        "(%class.C0*, i32)** %vtbl, i64 0\n"
+     << "  %fn = load i32 (%class.C0*, i32)*, i32 (%class.C0*, i32)** %slot\n"
+     << "  %vc = call i32 %fn(%class.C0* %base, i32 %s)\n";
+
+  if (Child1 < NumFunctions) {
+    OS << "  %c1 = call i32 @f" << Child1 << "(i32 %vc, i32* %p)\n";
+  } else {
+    OS << "  %c1 = add i32 %vc, 1\n";
+  }
+  if (Child2 < NumFunctions) {
+    OS << "  %c2 = call i32 @f" << Child2 << "(i32 %s, i32* %a)\n";
+  } else {
+    OS << "  %c2 = load i32, i32* %p\n";
+  }
+  OS << "  %sum = add i32 %c1, %c2\n";
+  if (Idx % 5 == 0) {
+    OS << "  call void @sink(i32 %sum)\n";
+  }
+  OS << "  ret i32 %sum\n"
+     << "}\n\n";
+}
+
+} // namespace
+
+std::string generateSyntheticModule(unsigned NumFunctions) {
+  NumFunctions = std::max(NumFunctions, 1U);
+  auto NumClasses = std::max(NumFunctions / 8, 1U);
+
+  std::string Ret;
+  llvm::raw_string_ostream OS(Ret);
+
+  OS << "; ModuleID = 'synthetic_" << NumFunctions << "'\n\n"
+     << "@_ZTVN10__cxxabiv117__class_type_infoE = external global i8*\n"
+     << "@_ZTVN10__cxxabiv120__si_class_type_infoE = external global i8*\n\n"
+     << "declare i32 @source()\n"
+     << "declare void @sink(i32)\n\n";
+
+  for (unsigned Idx = 0; Idx != NumClasses; ++Idx) {
+    printClass(OS, Idx);
+  }
+  for (unsigned Idx = 0; Idx != NumFunctions; ++Idx) {
+    printFunction(OS, Idx, NumFunctions, NumClasses);
+  }
+
+  OS << "define i32 @main() {\n"
+     << "entry:\n"
+     << "  %p = alloca i32\n"
+     << "  store i32 0, i32* %p\n"
+     << "  %r = call i32 @f0(i32 42, i32* %p)\n"
+     << "  ret i32 %r\n"
+     << "}\n";
+
+  return Ret;
+}
+
+std::vector<CorpusEntry>
+createCorpus(llvm::StringRef GenDir, llvm::ArrayRef<unsigned> SyntheticSizes,
+             llvm::ArrayRef<llvm::StringLiteral> TestCodeFiles,
+             llvm::ArrayRef<std::string> ExtraFiles) {
+  std::vector<CorpusEntry> Ret;
+
+  for (auto Size : SyntheticSizes) {
+    auto Name = "synthetic_" + std::to_string(Size);
+    auto Path = (GenDir + "/" + Name + ".ll").str();
+    writeTextFile(Path, generateSyntheticModule(Size));
+    Ret.push_back({std::move(Name), std::move(Path)});
+  }
+
+  auto AddFile = [&Ret](std::string Path) {
+    if (!llvm::sys::fs::exists(Path)) {
+      llvm::errs() << "[phasar-benchmarks] Skip non-existing IR file: " << Path
+                   << '\n';
+      return;
+    }
+    auto Name = llvm::sys::path::stem(Path).str();
+    Ret.push_back({std::move(Name), std::move(Path)});
+  };
+
+  for (auto File : TestCodeFiles) {
+    AddFile((PHASAR_BUILD_DIR "/test/llvm_test_code/" + File).str());
+  }
+  for (const auto &File : ExtraFiles) {
+    AddFile(File);
+  }
+
+  auto FileSize = [](const std::string &Path) {
+    uint64_t Size = 0;
+    llvm::sys::fs::file_size(Path, Size);
+    return Size;
+  };
+  std::stable_sort(Ret.begin(), Ret.end(),
+                   [&FileSize](const auto &L, const auto &R) {
+                     return FileSize(L.Path) < FileSize(R.Path);
+                   });
+
+  return Ret;
+}
+
+} // namespace psr::bench
@@ -0,0 +1,58 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_BENCHMARKS_BENCHMARKCORPUS_H
+#define PHASAR_BENCHMARKS_BENCHMARKCORPUS_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+
+#include <string>
+#include <vector>
+
+namespace psr::bench {
+
+/// An LLVM IR file that all benchmarks are run on
+struct CorpusEntry {
+  /// Identifies the entry within the benchmark names
+  std::string Name;
+  std::string Path;
+};
+
+/// The default sizes (in number of functions) of the generated modules
+inline constexpr unsigned DefaultSyntheticSizes[] = {16, 64, 256, 1024};
+
+/// The IR files compiled from the checked-in test programs that become part
+/// of the corpus, if PHASAR_BUILD_IR is enabled. Relative to
+/// PHASAR_BUILD_DIR/test/llvm_test_code/
+inline constexpr llvm::StringLiteral DefaultTestCodeFiles[] = {
+    "call_graphs/virtual_call_9_cpp.ll",
+    "general_linear_constant/StringTest_cpp.ll",
+    "taint_analysis/dynamic_memory_cpp.ll",
+    "xtaint/xtaint09_cpp.ll",
+};
+
+/// Generates a deterministic LLVM IR module with NumFunctions functions that
+/// form a binary call tree below main. Each function contains memory
+/// operations, arithmetic, a branch, a virtual call into a class hierarchy
+/// of NumFunctions / 8 classes and, in some functions, calls to the taint
+/// source "source" and the taint sink "sink".
+[[nodiscard]] std::string generateSyntheticModule(unsigned NumFunctions);
+
+/// Writes the synthetic modules of the given sizes into GenDir and collects
+/// them together with all existing TestCodeFiles and ExtraFiles, sorted by
+/// increasing file size.
+[[nodiscard]] std::vector<CorpusEntry>
+createCorpus(llvm::StringRef GenDir, llvm::ArrayRef<unsigned> SyntheticSizes,
+             llvm::ArrayRef<llvm::StringLiteral> TestCodeFiles,
+             llvm::ArrayRef<std::string> ExtraFiles);
+
+} // namespace psr::bench
+
+#endif // PHASAR_BENCHMARKS_BENCHMARKCORPUS_H
@@ -0,0 +1,34 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_BENCHMARKS_BENCHMARKS_H
+#define PHASAR_BENCHMARKS_BENCHMARKS_H
+
+#include "BenchmarkCorpus.h"
+
+#include "llvm/ADT/ArrayRef.h"
+
+namespace psr::bench {
+
+/// Registers the benchmarks for LLVMTypeHierarchy, LLVMAliasSet and the
+/// call-graph construction for each entry of Corpus. The entries must outlive
+/// the benchmark run.
+void registerHelperAnalysesBenchmarks(llvm::ArrayRef<CorpusEntry> Corpus);
+
+/// Registers the benchmarks for the IFDS and IDE solvers for each entry of
+/// Corpus. The entries must outlive the benchmark run.
+void registerDataFlowBenchmarks(llvm::ArrayRef<CorpusEntry> Corpus);
+
+/// Registers the micro-benchmarks for the value sets of IDEGeneralizedLCA.
+/// They do not depend on the corpus.
+void registerGeneralizedLCABenchmarks();
+
+} // namespace psr::bench
+
+#endif // PHASAR_BENCHMARKS_BENCHMARKS_H
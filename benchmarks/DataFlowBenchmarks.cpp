@@ -0,0 +1,166 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "Benchmarks.h"
+#include "ResourceUsage.h"
+
+#include "phasar/DataFlow/IfdsIde/Solver/IDESolver.h"
+#include "phasar/DataFlow/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDELinearConstantAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSTaintAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/TaintConfig/LLVMTaintConfig.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+
+#include "llvm/IR/InstrTypes.h"
+#include "llvm/IR/Instruction.h"
+
+#include "benchmark/benchmark.h"
+
+#include <optional>
+#include <set>
+
+namespace psr::bench {
+
+namespace {
+
+/// The helper analyses that all data-flow benchmarks on one corpus entry
+/// share. They are computed once outside of the measurement.
+struct PreparedEntry {
+  LLVMProjectIRDB IRDB;
+  std::optional<LLVMTypeHierarchy> TH;
+  std::optional<LLVMAliasSet> PT;
+  std::optional<LLVMBasedICFG> ICF;
+
+  explicit PreparedEntry(const CorpusEntry &Entry) : IRDB(Entry.Path) {
+    if (!IRDB.isValid()) {
+      return;
+    }
+    TH.emplace(IRDB);
+    PT.emplace(&IRDB, /*UseLazyEvaluation*/ false);
+    ICF.emplace(&IRDB, CallGraphAnalysisType::OTF,
+                llvm::ArrayRef<std::string>{"main"}, &*TH, &*PT);
+  }
+
+  [[nodiscard]] bool isValid() const noexcept { return ICF.has_value(); }
+
+  void setItemsProcessed(benchmark::State &State) const {
+    State.SetItemsProcessed(int64_t(State.iterations()) *
+                            int64_t(IRDB.getNumInstructions()));
+  }
+};
+
+/// The return values of calls to functions whose name contains Name, such as
+/// "source" or "_Z6sourcev"
+std::set<const llvm::Value *> callsTo(const llvm::Instruction *Inst,
+                                      llvm::StringRef Name) {
+  const auto *Call = llvm::dyn_cast<llvm::CallBase>(Inst);
+  if (!Call || !Call->getCalledFunction() ||
+      !Call->getCalledFunction()->getName().contains(Name)) {
+    return {};
+  }
+  return {Call};
+}
+
+/// The arguments of calls to functions whose name contains Name
+std::set<const llvm::Value *> argsOfCallsTo(const llvm::Instruction *Inst,
+                                            llvm::StringRef Name) {
+  const auto *Call = llvm::dyn_cast<llvm::CallBase>(Inst);
+  if (!Call || !Call->getCalledFunction() ||
+      !Call->getCalledFunction()->getName().contains(Name)) {
+    return {};
+  }
+  return {Call->arg_begin(), Call->arg_end()};
+}
+
+void benchTaintAnalysis(benchmark::State &State, const CorpusEntry &Entry) {
+  PreparedEntry Prep(Entry);
+  if (!Prep.isValid()) {
+    State.SkipWithError("Invalid IR");
+    return;
+  }
+
+  LLVMTaintConfig Config(
+      [](const llvm::Instruction *Inst) { return callsTo(Inst, "source"); },
+      [](const llvm::Instruction *Inst) {
+        return argsOfCallsTo(Inst, "sink");
+      });
+
+  {
+    ResourceReport Report(State);
+    for (auto _ : State) {
+      IFDSTaintAnalysis Problem(&Prep.IRDB, &*Prep.PT, &Config, {"main"});
+      IFDSSolver Solver(Problem, &*Prep.ICF);
+      Solver.solve();
+      benchmark::DoNotOptimize(&Solver);
+    }
+  }
+  Prep.setItemsProcessed(State);
+}
+
+void benchUninitializedVariables(benchmark::State &State,
+                                 const CorpusEntry &Entry) {
+  PreparedEntry Prep(Entry);
+  if (!Prep.isValid()) {
+    State.SkipWithError("Invalid IR");
+    return;
+  }
+
+  {
+    ResourceReport Report(State);
+    for (auto _ : State) {
+      IFDSUninitializedVariables Problem(&Prep.IRDB, {"main"});
+      IFDSSolver Solver(Problem, &*Prep.ICF);
+      Solver.solve();
+      benchmark::DoNotOptimize(&Solver);
+    }
+  }
+  Prep.setItemsProcessed(State);
+}
+
+void benchLinearConstantAnalysis(benchmark::State &State,
+                                 const CorpusEntry &Entry) {
+  PreparedEntry Prep(Entry);
+  if (!Prep.isValid()) {
+    State.SkipWithError("Invalid IR");
+    return;
+  }
+
+  {
+    ResourceReport Report(State);
+    for (auto _ : State) {
+      IDELinearConstantAnalysis Problem(&Prep.IRDB, &*Prep.ICF, {"main"});
+      IDESolver Solver(Problem, &*Prep.ICF);
+      Solver.solve();
+      benchmark::DoNotOptimize(&Solver);
+    }
+  }
+  Prep.setItemsProcessed(State);
+}
+
+} // namespace
+
+void registerDataFlowBenchmarks(llvm::ArrayRef<CorpusEntry> Corpus) {
+  for (const auto &Entry : Corpus) {
+    benchmark::RegisterBenchmark(("IFDSTaint/" + Entry.Name).c_str(),
+                                 benchTaintAnalysis, Entry)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("IFDSUninit/" + Entry.Name).c_str(),
+                                 benchUninitializedVariables, Entry)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("IDELinearConstant/" + Entry.Name).c_str(),
+                                 benchLinearConstantAnalysis, Entry)
+        ->Unit(benchmark::kMillisecond);
+  }
+}
+
+} // namespace psr::bench
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "Benchmarks.h"
+
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEGeneralizedLCA/EdgeValue.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEGeneralizedLCA/EdgeValueSet.h"
+
+#include "llvm/IR/Instruction.h"
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace psr::bench {
+
+namespace {
+
+using glca::EdgeValue;
+using glca::EdgeValueSet;
+
+/// Builds NumSets sets of up to MaxSize values each, mixing integers, floats
+/// and strings, such that the benchmarks see all kinds of values
+std::vector<EdgeValueSet> makeSets(size_t NumSets, size_t MaxSize) {
+  static constexpr const char *Strings[] = {"foo", "bar", "baz", "qux"};
+
+  std::vector<EdgeValueSet> Ret;
+  Ret.reserve(NumSets);
+  for (size_t I = 0; I < NumSets; ++I) {
+    std::vector<EdgeValue> Vals;
+    for (size_t J = 0, End = 1 + I % MaxSize; J < End; ++J) {
+      switch ((I + J) % 3) {
+      case 0:
+        Vals.emplace_back(int(I * 7 + J));
+        break;
+      case 1:
+        Vals.emplace_back(double(I) / 3.0 + double(J));
+        break;
+      default:
+        Vals.emplace_back(llvm::StringRef(Strings[(I + J) % 4]));
+        break;
+      }
+    }
+    Ret.emplace_back(Vals.begin(), Vals.end());
+  }
+  return Ret;
+}
+
+void benchJoin(benchmark::State &State) {
+  auto MaxSize = size_t(State.range(0));
+  auto Sets = makeSets(256, MaxSize);
+
+  size_t Idx = 0;
+  for (auto _ : State) {
+    const auto &Lhs = Sets[Idx % Sets.size()];
+    const auto &Rhs = Sets[(Idx * 31 + 7) % Sets.size()];
+    auto Joined = glca::join(Lhs, Rhs, MaxSize);
+    benchmark::DoNotOptimize(Joined);
+    ++Idx;
+  }
+  State.SetItemsProcessed(int64_t(State.iterations()));
+}
+
+void benchCompare(benchmark::State &State) {
+  auto Sets = makeSets(256, size_t(State.range(0)));
+
+  size_t Idx = 0;
+  for (auto _ : State) {
+    auto Ord = glca::compare(Sets[Idx % Sets.size()],
+                             Sets[(Idx * 31 + 7) % Sets.size()]);
+    benchmark::DoNotOptimize(Ord);
+    ++Idx;
+  }
+  State.SetItemsProcessed(int64_t(State.iterations()));
+}
+
+/// Composing two binary-operation edge functions amounts to applying the
+/// operations one after another on every element of the set
+void benchBinOp(benchmark::State &State) {
+  auto Sets = makeSets(256, size_t(State.range(0)));
+  EdgeValueSet Operand({EdgeValue(3), EdgeValue(5)});
+
+  size_t Idx = 0;
+  for (auto _ : State) {
+    auto Sum = glca::performBinOp(llvm::Instruction::Add,
+                                  Sets[Idx % Sets.size()], Operand, 4);
+    auto Prod = glca::performBinOp(llvm::Instruction::Mul, Sum, Operand, 4);
+    benchmark::DoNotOptimize(Prod);
+    ++Idx;
+  }
+  State.SetItemsProcessed(int64_t(State.iterations()));
+}
+
+} // namespace
+
+void registerGeneralizedLCABenchmarks() {
+  benchmark::RegisterBenchmark("GeneralizedLCA/Join", benchJoin)
+      ->Arg(2)
+      ->Arg(4)
+      ->Arg(8);
+  benchmark::RegisterBenchmark("GeneralizedLCA/Compare", benchCompare)
+      ->Arg(2)
+      ->Arg(4)
+      ->Arg(8);
+  benchmark::RegisterBenchmark("GeneralizedLCA/BinOp", benchBinOp)
+      ->Arg(2)
+      ->Arg(4)
+      ->Arg(8);
+}
+
+} // namespace psr::bench
@@ -0,0 +1,108 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "Benchmarks.h"
+#include "ResourceUsage.h"
+
+#include "phasar/ControlFlow/CallGraphAnalysisType.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+
+#include "benchmark/benchmark.h"
+
+#include <string>
+
+namespace psr::bench {
+
+namespace {
+
+void benchTypeHierarchy(benchmark::State &State, const CorpusEntry &Entry) {
+  LLVMProjectIRDB IRDB(Entry.Path);
+  if (!IRDB.isValid()) {
+    State.SkipWithError("Invalid IR");
+    return;
+  }
+
+  {
+    ResourceReport Report(State);
+    for (auto _ : State) {
+      LLVMTypeHierarchy TH(IRDB);
+      benchmark::DoNotOptimize(&TH);
+    }
+  }
+  State.SetItemsProcessed(int64_t(State.iterations()) *
+                          int64_t(IRDB.getNumInstructions()));
+}
+
+void benchAliasSet(benchmark::State &State, const CorpusEntry &Entry) {
+  LLVMProjectIRDB IRDB(Entry.Path);
+  if (!IRDB.isValid()) {
+    State.SkipWithError("Invalid IR");
+    return;
+  }
+
+  {
+    ResourceReport Report(State);
+    for (auto _ : State) {
+      LLVMAliasSet PT(&IRDB, /*UseLazyEvaluation*/ false);
+      benchmark::DoNotOptimize(&PT);
+    }
+  }
+  State.SetItemsProcessed(int64_t(State.iterations()) *
+                          int64_t(IRDB.getNumInstructions()));
+}
+
+void benchCallGraph(benchmark::State &State, const CorpusEntry &Entry,
+                    CallGraphAnalysisType CGTy) {
+  LLVMProjectIRDB IRDB(Entry.Path);
+  if (!IRDB.isValid()) {
+    State.SkipWithError("Invalid IR");
+    return;
+  }
+  LLVMTypeHierarchy TH(IRDB);
+
+  {
+    ResourceReport Report(State);
+    for (auto _ : State) {
+      // For OTF, the ICFG creates its own (lazy) LLVMAliasSet, which is
+      // therefore part of the measurement.
+      // Modelling the global ctors/dtors adds functions to the IRDB; disable
+      // it, such that all iterations see the same IR.
+      LLVMBasedICFG ICF(&IRDB, CGTy, {"main"}, &TH, nullptr, Soundness::Soundy,
+                        /*IncludeGlobals*/ false);
+      benchmark::DoNotOptimize(&ICF);
+    }
+  }
+  State.SetItemsProcessed(int64_t(State.iterations()) *
+                          int64_t(IRDB.getNumInstructions()));
+}
+
+} // namespace
+
+void registerHelperAnalysesBenchmarks(llvm::ArrayRef<CorpusEntry> Corpus) {
+  for (const auto &Entry : Corpus) {
+    benchmark::RegisterBenchmark(("TypeHierarchy/" + Entry.Name).c_str(),
+                                 benchTypeHierarchy, Entry)
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(("AliasSet/" + Entry.Name).c_str(),
+                                 benchAliasSet, Entry)
+        ->Unit(benchmark::kMillisecond);
+
+    for (auto CGTy : {CallGraphAnalysisType::CHA, CallGraphAnalysisType::RTA,
+                      CallGraphAnalysisType::OTF}) {
+      auto Name = "CallGraph" + toString(CGTy) + "/" + Entry.Name;
+      benchmark::RegisterBenchmark(Name.c_str(), benchCallGraph, Entry, CGTy)
+          ->Unit(benchmark::kMillisecond);
+    }
+  }
+}
+
+} // namespace psr::bench
@@ -0,0 +1,103 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "BenchmarkCorpus.h"
+#include "Benchmarks.h"
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "benchmark/benchmark.h"
+
+#include <string>
+#include <vector>
+
+namespace cl = llvm::cl;
+
+namespace {
+cl::OptionCategory BenchCategory("Benchmark corpus");
+
+cl::opt<std::string> CorpusDirOpt(
+    "corpus-dir",
+    cl::desc("Directory to write the generated IR files into. If not "
+             "specified, a temporary directory is used and removed afterwards"),
+    cl::cat(BenchCategory));
+
+cl::list<unsigned> SyntheticSizesOpt(
+    "synthetic-sizes",
+    cl::desc("Numbers of functions of the generated IR files (default is "
+             "16,64,256,1024)"),
+    cl::CommaSeparated, cl::cat(BenchCategory));
+
+cl::opt<bool> NoTestCodeOpt(
+    "no-test-code",
+    cl::desc("Do not include the IR files compiled from PhASAR's test code"),
+    cl::cat(BenchCategory));
+
+cl::list<std::string> ExtraFilesOpt(cl::Positional,
+                                    cl::desc("<additional IR files>"),
+                                    cl::cat(BenchCategory));
+} // namespace
+
+int main(int Argc, char **Argv) {
+  // Consumes all --benchmark_* arguments; the rest belongs to us
+  benchmark::Initialize(&Argc, Argv);
+  cl::HideUnrelatedOptions(BenchCategory);
+  cl::ParseCommandLineOptions(
+      Argc, Argv,
+      "Benchmarks PhASAR's solvers and helper analyses on a corpus of IR "
+      "files.\nAll --benchmark_* options of Google Benchmark are supported as "
+      "well; use --benchmark_out=<file> --benchmark_out_format=json for "
+      "machine-readable results\n");
+
+  llvm::SmallString<256> CorpusDir(CorpusDirOpt.getValue());
+  bool IsTempDir = CorpusDir.empty();
+  if (IsTempDir) {
+    if (auto EC = llvm::sys::fs::createUniqueDirectory("phasar-benchmarks",
+                                                       CorpusDir)) {
+      llvm::errs() << "Cannot create the corpus directory: " << EC.message()
+                   << '\n';
+      return 1;
+    }
+  } else if (auto EC = llvm::sys::fs::create_directories(CorpusDir)) {
+    llvm::errs() << "Cannot create the corpus directory '" << CorpusDir
+                 << "': " << EC.message() << '\n';
+    return 1;
+  }
+
+  std::vector<unsigned> SyntheticSizes(SyntheticSizesOpt.begin(),
+                                       SyntheticSizesOpt.end());
+  if (SyntheticSizes.empty()) {
+    SyntheticSizes.assign(std::begin(psr::bench::DefaultSyntheticSizes),
+                          std::end(psr::bench::DefaultSyntheticSizes));
+  }
+
+  std::vector<std::string> ExtraFiles(ExtraFilesOpt.begin(),
+                                      ExtraFilesOpt.end());
+
+  auto Corpus = psr::bench::createCorpus(
+      CorpusDir, SyntheticSizes,
+      NoTestCodeOpt ? llvm::ArrayRef<llvm::StringLiteral>{}
+                    : llvm::makeArrayRef(psr::bench::DefaultTestCodeFiles),
+      ExtraFiles);
+
+  psr::bench::registerHelperAnalysesBenchmarks(Corpus);
+  psr::bench::registerDataFlowBenchmarks(Corpus);
+  psr::bench::registerGeneralizedLCABenchmarks();
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  if (IsTempDir) {
+    llvm::sys::fs::remove_directories(CorpusDir);
+  }
+  return 0;
+}
@@ -0,0 +1,165 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "ResourceUsage.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+#include <sys/resource.h>
+
+namespace {
+std::atomic_size_t NumAllocations{};
+std::atomic_size_t NumAllocatedBytes{};
+
+void *countedAlloc(size_t Size) {
+  NumAllocations.fetch_add(1, std::memory_order_relaxed);
+  NumAllocatedBytes.fetch_add(Size, std::memory_order_relaxed);
+  // malloc(0) may return nullptr
+  if (void *Ret = std::malloc(Size ? Size : 1)) {
+    return Ret;
+  }
+  throw std::bad_alloc();
+}
+
+void *countedAlignedAlloc(size_t Size, std::align_val_t Align) {
+  NumAllocations.fetch_add(1, std::memory_order_relaxed);
+  NumAllocatedBytes.fetch_add(Size, std::memory_order_relaxed);
+  auto Alignment = static_cast<size_t>(Align);
+  // aligned_alloc requires the size to be a multiple of the alignment
+  auto AlignedSize = ((Size ? Size : 1) + Alignment - 1) & ~(Alignment - 1);
+  if (void *Ret = std::aligned_alloc(Alignment, AlignedSize)) {
+    return Ret;
+  }
+  throw std::bad_alloc();
+}
+} // namespace
+
+// Replace the global allocation functions to count all heap allocations that
+// are done through operator new, including the ones within LLVM.
+
+void *operator new(size_t Size) { return countedAlloc(Size); }
+void *operator new[](size_t Size) { return countedAlloc(Size); }
+void *operator new(size_t Size, std::align_val_t Align) {
+  return countedAlignedAlloc(Size, Align);
+}
+void *operator new[](size_t Size, std::align_val_t Align) {
+  return countedAlignedAlloc(Size, Align);
+}
+void *operator new(size_t Size, const std::nothrow_t & /*Tag*/) noexcept {
+  try {
+    return countedAlloc(Size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+void *operator new[](size_t Size, const std::nothrow_t & /*Tag*/) noexcept {
+  try {
+    return countedAlloc(Size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void operator delete(void *Ptr) noexcept { std::free(Ptr); }
+void operator delete[](void *Ptr) noexcept { std::free(Ptr); }
+void operator delete(void *Ptr, size_t /*Size*/) noexcept { std::free(Ptr); }
+void operator delete[](void *Ptr, size_t /*Size*/) noexcept { std::free(Ptr); }
+void operator delete(void *Ptr, std::align_val_t /*Align*/) noexcept {
+  std::free(Ptr);
+}
+void operator delete[](void *Ptr, std::align_val_t /*Align*/) noexcept {
+  std::free(Ptr);
+}
+void operator delete(void *Ptr, size_t /*Size*/,
+                     std::align_val_t /*Align*/) noexcept {
+  std::free(Ptr);
+}
+void operator delete[](void *Ptr, size_t /*Size*/,
+                       std::align_val_t /*Align*/) noexcept {
+  std::free(Ptr);
+}
+void operator delete(void *Ptr, const std::nothrow_t & /*Tag*/) noexcept {
+  std::free(Ptr);
+}
+void operator delete[](void *Ptr, const std::nothrow_t & /*Tag*/) noexcept {
+  std::free(Ptr);
+}
+
+namespace psr::bench {
+
+size_t getNumAllocations() noexcept {
+  return NumAllocations.load(std::memory_order_relaxed);
+}
+
+size_t getNumAllocatedBytes() noexcept {
+  return NumAllocatedBytes.load(std::memory_order_relaxed);
+}
+
+bool resetPeakRSS() noexcept {
+  // See proc(5): Writing 5 to clear_refs resets the peak RSS (VmHWM)
+  std::ofstream ClearRefs("/proc/self/clear_refs");
+  if (!ClearRefs) {
+    return false;
+  }
+  ClearRefs << "5";
+  ClearRefs.flush();
+  return ClearRefs.good();
+}
+
+size_t getPeakRSS() noexcept {
+  std::ifstream Status("/proc/self/status");
+  std::string Line;
+  while (std::getline(Status, Line)) {
+    // Format: "VmHWM:     1234 kB"
+    if (Line.rfind("VmHWM:", 0) == 0) {
+      return std::strtoull(Line.c_str() + 6, nullptr, 10) * 1024;
+    }
+  }
+
+  // Fallback for non-Linux systems. Cannot be reset
+  rusage Usage{};
+  if (getrusage(RUSAGE_SELF, &Usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  return Usage.ru_maxrss;
+#else
+  return Usage.ru_maxrss * 1024;
+#endif
+}
+
+ResourceReport::ResourceReport(benchmark::State &State) noexcept
+    : State(State), StartAllocations(getNumAllocations()),
+      StartAllocatedBytes(getNumAllocatedBytes()),
+      PeakRSSIsAccurate(resetPeakRSS()) {}
+
+ResourceReport::~ResourceReport() {
+  auto Allocations = getNumAllocations() - StartAllocations;
+  auto AllocatedBytes = getNumAllocatedBytes() - StartAllocatedBytes;
+
+  State.counters["Allocations"] = benchmark::Counter(
+      double(Allocations), benchmark::Counter::kAvgIterations);
+  State.counters["AllocatedBytes"] =
+      benchmark::Counter(double(AllocatedBytes),
+                         benchmark::Counter::kAvgIterations,
+                         benchmark::Counter::OneK::kIs1024);
+  State.counters["PeakRSS"] =
+      benchmark::Counter(double(getPeakRSS()), benchmark::Counter::kDefaults,
+                         benchmark::Counter::OneK::kIs1024);
+  if (!PeakRSSIsAccurate) {
+    // The peak RSS includes everything before this benchmark
+    State.SetLabel("PeakRSS is process-wide");
+  }
+}
+
+} // namespace psr::bench
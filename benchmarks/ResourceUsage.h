@@ -0,0 +1,52 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_BENCHMARKS_RESOURCEUSAGE_H
+#define PHASAR_BENCHMARKS_RESOURCEUSAGE_H
+
+#include "benchmark/benchmark.h"
+
+#include <cstddef>
+
+namespace psr::bench {
+
+/// Number of calls to (any overload of) the global operator new so far
+[[nodiscard]] size_t getNumAllocations() noexcept;
+/// Number of bytes requested from the global operator new so far
+[[nodiscard]] size_t getNumAllocatedBytes() noexcept;
+
+/// Resets the high-water mark of the resident set size, if supported by the
+/// OS. Returns whether the reset has succeeded.
+bool resetPeakRSS() noexcept;
+/// The peak resident set size of this process in bytes
+[[nodiscard]] size_t getPeakRSS() noexcept;
+
+/// Attaches the counters "Allocations" and "AllocatedBytes" (per iteration)
+/// and "PeakRSS" (in bytes) to the benchmark that State belongs to.
+///
+/// Construct it right before the benchmark loop; the counters are set on
+/// destruction.
+class ResourceReport {
+public:
+  explicit ResourceReport(benchmark::State &State) noexcept;
+  ~ResourceReport();
+
+  ResourceReport(const ResourceReport &) = delete;
+  ResourceReport &operator=(const ResourceReport &) = delete;
+
+private:
+  benchmark::State &State;
+  size_t StartAllocations{};
+  size_t StartAllocatedBytes{};
+  bool PeakRSSIsAccurate{};
+};
+
+} // namespace psr::bench
+
+#endif // PHASAR_BENCHMARKS_RESOURCEUSAGE_H
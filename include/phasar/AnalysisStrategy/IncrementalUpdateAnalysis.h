@@ -10,9 +10,118 @@
 #ifndef PHASAR_ANALYSISSTRATEGY_INCREMENTALUPDATEANALYSIS_H
 #define PHASAR_ANALYSISSTRATEGY_INCREMENTALUPDATEANALYSIS_H
 
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/StringSet.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
 namespace psr {
 
-class IncrementalUpdateAnalysis {};
+/// Structural hashes of all function definitions of a module. Comparing the
+/// fingerprints of two versions of the same program tells which functions
+/// have changed in between.
+struct ModuleFingerprint {
+  /// Maps the name of each defined function to the hash of its body
+  llvm::StringMap<uint64_t> FunctionHashes;
+  /// Hash over all global variables (including vtables) and their
+  /// initializers, and over the bodies of all named struct types
+  uint64_t GlobalsHash = 0;
+};
+
+/// The differences between two ModuleFingerprints
+struct ModuleDiff {
+  std::vector<std::string> Added;
+  std::vector<std::string> Removed;
+  std::vector<std::string> Changed;
+  bool GlobalsChanged = false;
+
+  /// True, iff no function has been added, removed or changed
+  [[nodiscard]] bool functionsUnchanged() const noexcept {
+    return Added.empty() && Removed.empty() && Changed.empty();
+  }
+  [[nodiscard]] bool empty() const noexcept {
+    return functionsUnchanged() && !GlobalsChanged;
+  }
+
+  [[nodiscard]] static ModuleDiff compute(const ModuleFingerprint &Baseline,
+                                          const ModuleFingerprint &Current);
+
+  void print(llvm::raw_ostream &OS) const;
+};
+
+/// Decides, which information computed for a baseline version of a program
+/// can be reused for the current version.
+///
+/// A function is considered unchanged, iff it is defined in both versions
+/// with the same structural hash. Function-local information, such as the
+/// intra-procedural alias sets or the resolved targets of call-sites, of
+/// unchanged functions can be carried over from the baseline. Everything that
+/// summarizes the effects of a call, such as IDE jump functions and
+/// end-summaries, would additionally have to be recomputed for all callers of
+/// changed functions, see computeAffectedFunctions().
+///
+/// Note that only the helper analyses make use of this at the moment; the
+/// IDESolver has no persistable state and always solves from scratch.
+class IncrementalUpdateAnalysis {
+public:
+  IncrementalUpdateAnalysis(const ModuleFingerprint &Baseline,
+                            const ModuleFingerprint &Current);
+
+  [[nodiscard]] const ModuleDiff &getDiff() const noexcept { return Diff; }
+
+  /// True, iff a function with the name FunName is defined in the baseline
+  /// and in the current version and its body did not change
+  [[nodiscard]] bool isUnchanged(llvm::StringRef FunName) const {
+    return Unchanged.contains(FunName);
+  }
+
+  [[nodiscard]] size_t getNumUnchanged() const noexcept {
+    return Unchanged.size();
+  }
+
+  /// Computes all functions in the current version whose data-flow results
+  /// may differ from the baseline: The added and changed functions together
+  /// with all their transitive callers in ICF.
+  template <typename ICFGTy>
+  [[nodiscard]] std::vector<typename ICFGTy::f_t>
+  computeAffectedFunctions(const ICFGTy &ICF) const {
+    using f_t = typename ICFGTy::f_t;
+
+    std::vector<f_t> Affected;
+    llvm::DenseSet<f_t> Seen;
+
+    auto Push = [&](f_t Fun) {
+      if (Fun && Seen.insert(Fun).second) {
+        Affected.push_back(Fun);
+      }
+    };
+
+    for (const auto &Name : Diff.Added) {
+      Push(ICF.getFunction(Name));
+    }
+    for (const auto &Name : Diff.Changed) {
+      Push(ICF.getFunction(Name));
+    }
+
+    // Affected grows while we iterate over it, so don't use iterators here
+    for (size_t I = 0; I != Affected.size(); ++I) {
+      for (const auto &CS : ICF.getCallersOf(Affected[I])) {
+        Push(ICF.getFunctionOf(CS));
+      }
+    }
+
+    return Affected;
+  }
+
+private:
+  ModuleDiff Diff;
+  llvm::StringSet<> Unchanged;
+};
 
 } // namespace psr
 
@@ -10,9 +10,76 @@
 #ifndef PHASAR_ANALYSISSTRATEGY_MODULEWISEANALYSIS_H
 #define PHASAR_ANALYSISSTRATEGY_MODULEWISEANALYSIS_H
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
 namespace psr {
 
-class ModuleWiseAnalysis {};
+/// The link-time interface of a single module: The functions it defines for
+/// other modules and the external functions it calls
+struct ModuleInterface {
+  std::string Name;
+  std::vector<std::string> Defines;
+  std::vector<std::string> Declares;
+};
+
+/// Schedules the compositional analysis of a program that consists of
+/// multiple separately compiled modules.
+///
+/// A module depends on all modules that define a function that it declares.
+/// Modules are analyzed bottom-up along these dependencies, such that the
+/// summaries of all dependencies of a module are available when it is
+/// analyzed. Modules within the same stage do not depend on each other and
+/// can be analyzed in parallel.
+///
+/// Mutually dependent modules are placed into the same stage and analyzed
+/// without the summaries of each other.
+class ModuleWiseAnalysis {
+public:
+  explicit ModuleWiseAnalysis(std::vector<ModuleInterface> Modules);
+
+  [[nodiscard]] size_t size() const noexcept { return Modules.size(); }
+
+  [[nodiscard]] const ModuleInterface &getModule(size_t Mod) const {
+    return Modules[Mod];
+  }
+
+  /// The modules that define functions declared by Mod
+  [[nodiscard]] llvm::ArrayRef<uint32_t> getDependencies(size_t Mod) const {
+    return Deps[Mod];
+  }
+
+  /// All modules that Mod (transitively) depends on, excluding Mod itself
+  [[nodiscard]] std::vector<uint32_t>
+  getTransitiveDependencies(size_t Mod) const;
+
+  /// The stages of the bottom-up analysis. Each module is part of exactly one
+  /// stage and depends only on modules of earlier stages (or of its own
+  /// dependency cycle).
+  [[nodiscard]] const std::vector<std::vector<uint32_t>> &
+  getStages() const noexcept {
+    return Stages;
+  }
+
+  /// True, iff Mod is part of a dependency cycle
+  [[nodiscard]] bool isCyclic(size_t Mod) const { return Cyclic[Mod]; }
+
+  void print(llvm::raw_ostream &OS) const;
+
+private:
+  void computeDependencies();
+  void computeStages();
+
+  std::vector<ModuleInterface> Modules;
+  std::vector<llvm::SmallVector<uint32_t, 4>> Deps;
+  std::vector<std::vector<uint32_t>> Stages;
+  std::vector<bool> Cyclic;
+};
 
 } // namespace psr
 
@@ -0,0 +1,60 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_CONTROLFLOW_STMTLESS_H
+#define PHASAR_CONTROLFLOW_STMTLESS_H
+
+#include "phasar/Utils/Utilities.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace psr {
+
+namespace detail {
+template <typename ICFGTy, typename N, typename = void>
+struct HasNumericStmtIds : std::false_type {};
+template <typename ICFGTy, typename N>
+struct HasNumericStmtIds<
+    ICFGTy, N,
+    std::void_t<decltype(std::declval<const ICFGTy &>()
+                             .getIRDB()
+                             ->getInstructionId(std::declval<N>()))>>
+    : std::true_type {};
+} // namespace detail
+
+/// Orders statements by their statement-id, e.g., for printing analysis
+/// results deterministically.
+///
+/// If the ICFG provides access to the IRDB, the numeric instruction ids of the
+/// IRDB are compared directly; these are consistent with the statement-ids
+/// that the LLVM-based ICFGs print. Otherwise, falls back to comparing the
+/// string ids from ICFGTy::getStatementId().
+template <typename ICFGTy> class StmtLess {
+public:
+  explicit StmtLess(const ICFGTy *ICF) noexcept : ICF(ICF) {}
+
+  template <typename N>
+  [[nodiscard]] bool operator()(const N &Lhs, const N &Rhs) const {
+    if constexpr (detail::HasNumericStmtIds<ICFGTy, N>::value) {
+      const auto *IRDB = ICF->getIRDB();
+      return IRDB->getInstructionId(Lhs) < IRDB->getInstructionId(Rhs);
+    } else {
+      return StringIDLess{}(ICF->getStatementId(Lhs),
+                            ICF->getStatementId(Rhs));
+    }
+  }
+
+private:
+  const ICFGTy *ICF{};
+};
+
+} // namespace psr
+
+#endif // PHASAR_CONTROLFLOW_STMTLESS_H
@@ -16,13 +16,19 @@
     "Hexastore requires SQLite3. Please install libsqlite3-dev and reconfigure PhASAR."
 #endif
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include <array>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <vector>
 
 struct sqlite3;
+struct sqlite3_stmt;
 
 namespace psr {
 /**
@@ -55,6 +61,53 @@ struct HSResult {
   }
 };
 
+class Hexastore;
+
+/**
+ * Iterates over the results of a query to the Hexastore without materializing
+ * them. The strings returned by subject(), predicate() and object() are only
+ * valid until the next call to next().
+ *
+ * A cursor must not outlive the Hexastore that created it.
+ *
+ * @brief Streams the results of a query to the Hexastore.
+ */
+class HSCursor {
+public:
+  /// Creates an empty cursor
+  HSCursor() noexcept = default;
+  HSCursor(HSCursor &&Other) noexcept;
+  HSCursor &operator=(HSCursor &&Other) noexcept;
+  HSCursor(const HSCursor &) = delete;
+  HSCursor &operator=(const HSCursor &) = delete;
+  ~HSCursor();
+
+  /// Advances to the next result. Returns false, if there are no more
+  /// results.
+  [[nodiscard]] bool next();
+
+  [[nodiscard]] llvm::StringRef subject() const noexcept;
+  [[nodiscard]] llvm::StringRef predicate() const noexcept;
+  [[nodiscard]] llvm::StringRef object() const noexcept;
+
+  /// Copies the current result
+  [[nodiscard]] HSResult getResult() const {
+    return {subject().str(), predicate().str(), object().str()};
+  }
+
+private:
+  friend class Hexastore;
+
+  HSCursor(Hexastore *HS, size_t StmtIdx, sqlite3_stmt *Stmt) noexcept
+      : HS(HS), StmtIdx(StmtIdx), Stmt(Stmt) {}
+
+  void release() noexcept;
+
+  Hexastore *HS{};
+  size_t StmtIdx{};
+  sqlite3_stmt *Stmt{};
+};
+
 /**
  * A Hexastore is an efficient approach to store large graphs.
  * This approach is based on the paper "Database-Backed Program Analysis
@@ -65,21 +118,27 @@ struct HSResult {
  *
  *          (source node, edge, destination node)
  *
- * A Hexastore indexes and saves graphs six-fold, according to each of
- * the permutations of source, edge and destination label. For example,
- * this allows to quickly find all edges for a given source node with one
- * look-up. In general, given one or two fixed elements of a (source, edge,
- * destination) tuple, Hexastore can quickly access the related information.
+ * A Hexastore indexes graphs according to the permutations of source, edge and
+ * destination label. For example, this allows to quickly find all edges for a
+ * given source node with one look-up. In general, given one or two fixed
+ * elements of a (source, edge, destination) tuple, Hexastore can quickly
+ * access the related information.
+ *
+ * All node- and edge labels are interned into a dictionary, such that the
+ * indices only store integers. The SQL statements are prepared once and
+ * reused for all puts and queries.
+ *
+ * Databases that were written by the old Hexastore, which used one set of
+ * tables per permutation, are not compatible with this layout. Opening one
+ * reports an error and yields an invalid Hexastore.
+ *
+ * To insert many tuples at once, either use putAll(), or wrap the puts into
+ * beginTransaction() and commitTransaction(). Otherwise, each put is committed
+ * separately. If a commit fails, the whole transaction is rolled back.
  *
  * @brief Efficient data structure for holding graphs in databases.
  */
 class Hexastore {
-private:
-  sqlite3 *HSInternalDB{};
-  static int callback(void * /*NotUsed*/, int Argc, char **Argv,
-                      char **AzColName);
-  void doPut(const std::string &Query, std::array<std::string, 3> Edge);
-
 public:
   /**
    * If the given filename matches an already created Hexastore, no
@@ -94,10 +153,15 @@ public:
   Hexastore &operator=(const Hexastore &) = delete;
 
   /**
-   * Destructor.
+   * Destructor. Commits a pending transaction.
    */
   ~Hexastore();
 
+  /// Returns false, if the database could not be opened or uses the old
+  /// Hexastore layout. All puts and queries on an invalid Hexastore fail.
+  [[nodiscard]] bool isValid() const noexcept { return HSInternalDB; }
+  explicit operator bool() const noexcept { return isValid(); }
+
   /**
    * Adds the given tuple as a new entry to the Hexastore. It is not
    * possible to have duplicate entries in the Hexastore and
@@ -109,7 +173,26 @@ public:
    *        hexastore.put({{"subject", "predicate", "object"}});
    * @param edge New entry in the form of a 3-tuple.
    */
-  void put(const std::array<std::string, 3> &Edge);
+  void put(const std::array<std::string, 3> &Edge) {
+    put(Edge[0], Edge[1], Edge[2]);
+  }
+
+  /// Same as put(Edge), but does not require to allocate the strings
+  void put(llvm::StringRef Subject, llvm::StringRef Predicate,
+           llvm::StringRef Object);
+
+  /// Adds all Edges within one transaction. Returns false, if that transaction
+  /// could not be committed.
+  bool putAll(llvm::ArrayRef<std::array<std::string, 3>> Edges);
+
+  /// Starts a transaction that spans all puts until the next call to
+  /// commitTransaction(). Transactions do not nest.
+  void beginTransaction();
+  /// Writes all puts since the last call to beginTransaction() to the
+  /// database. If that fails, the transaction is rolled back and false is
+  /// returned.
+  bool commitTransaction();
+  [[nodiscard]] bool inTransaction() const noexcept { return InTransaction; }
 
   /**
    * A query is always in the form of a 3-tuple (source, edge, destination)
@@ -128,6 +211,53 @@ public:
    */
   std::vector<HSResult> get(std::array<std::string, 3> EdgeQuery,
                             size_t ResultSizeHint = 0);
+
+  /// Same as get(), but streams the results instead of collecting them into a
+  /// vector.
+  [[nodiscard]] HSCursor query(const std::array<std::string, 3> &EdgeQuery);
+
+private:
+  friend class HSCursor;
+
+  enum StmtKind : size_t {
+    BeginStmt,
+    CommitStmt,
+    RollbackStmt,
+    LookupTermStmt,
+    InsertTermStmt,
+    InsertTripleStmt,
+    // The search statements; the bits denote the fixed elements of the query,
+    // i.e., 4 for the subject, 2 for the predicate and 1 for the object
+    SearchStmtBase,
+    NumStmts = SearchStmtBase + 8,
+  };
+
+  [[nodiscard]] static const std::string &getStmtQuery(size_t Kind);
+  /// Takes the prepared statement of the given kind out of the cache, or
+  /// prepares a new one, if it is already in use.
+  [[nodiscard]] sqlite3_stmt *acquireStmt(size_t Kind);
+  /// Resets Stmt and puts it back into the cache
+  void releaseStmt(size_t Kind, sqlite3_stmt *Stmt) noexcept;
+  /// Executes a statement that does not yield any rows
+  bool execute(size_t Kind);
+
+  /// Memoizes the dictionary id of Term; bounded by MaxCachedTerms
+  void cacheTermId(llvm::StringRef Term, int64_t Id);
+  [[nodiscard]] std::optional<int64_t> lookupTerm(llvm::StringRef Term);
+  [[nodiscard]] std::optional<int64_t> internTerm(llvm::StringRef Term);
+  void doPut(llvm::StringRef Subject, llvm::StringRef Predicate,
+             llvm::StringRef Object);
+  void reportError(llvm::StringRef Context) const;
+
+  sqlite3 *HSInternalDB{};
+  std::array<sqlite3_stmt *, NumStmts> Stmts{};
+  /// The cache is dropped once it reaches this size. The dictionary's unique
+  /// index still serves all lookups, so this only bounds the memory
+  static constexpr size_t MaxCachedTerms = 1 << 16;
+
+  /// Caches the dictionary ids of the recently used terms
+  llvm::StringMap<int64_t> TermIds;
+  bool InTransaction = false;
 };
 
 } // namespace psr
@@ -14,17 +14,31 @@
 
 namespace psr {
 
-extern const std::string SPOInsert;
+/// Creates the dictionary and the triple table together with its indices
+extern const std::string INIT;
+
+/// Yields a row, if the database still contains the per-permutation tables of
+/// the old Hexastore layout
+extern const std::string DetectLegacySchema;
+
+extern const std::string BeginTransaction;
 
-extern const std::string SOPInsert;
+extern const std::string CommitTransaction;
 
-extern const std::string PSOInsert;
+extern const std::string RollbackTransaction;
 
-extern const std::string POSInsert;
+/// Looks up the id of the term ?1 in the dictionary
+extern const std::string LookupTerm;
 
-extern const std::string OSPInsert;
+/// Adds the term ?1 to the dictionary
+extern const std::string InsertTerm;
 
-extern const std::string OPSInsert;
+/// Adds the triple of term-ids (?1, ?2, ?3)
+extern const std::string InsertTriple;
+
+// The search queries bind the term-ids of the fixed elements of the query
+// tuple to ?1 (subject), ?2 (predicate) and ?3 (object) and yield the names of
+// subject, predicate and object for each match.
 
 extern const std::string SearchSPO;
 
@@ -42,8 +56,6 @@ extern const std::string SearchXXO;
 
 extern const std::string SearchXXX;
 
-extern const std::string INIT;
-
 } // namespace psr
 
 #endif
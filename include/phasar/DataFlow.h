@@ -30,8 +30,11 @@
 #include "phasar/DataFlow/IfdsIde/SpecialSummaries.h"
 #include "phasar/DataFlow/Mono/Contexts/CallStringCTX.h"
 #include "phasar/DataFlow/Mono/InterMonoProblem.h"
+#include "phasar/DataFlow/Mono/IntraMonoGenKillProblem.h"
 #include "phasar/DataFlow/Mono/IntraMonoProblem.h"
 #include "phasar/DataFlow/Mono/Solver/InterMonoSolver.h"
+#include "phasar/DataFlow/Mono/Solver/IntraMonoBlockGraph.h"
+#include "phasar/DataFlow/Mono/Solver/IntraMonoGenKillSolver.h"
 #include "phasar/DataFlow/Mono/Solver/IntraMonoSolver.h"
 #include "phasar/DataFlow/PathSensitivity/PathSensitivityConfig.h"
 #include "phasar/DataFlow/PathSensitivity/PathSensitivityManager.h"
@@ -109,6 +109,14 @@ public:
   /// statements to initial analysis facts.
   [[nodiscard]] virtual InitialSeeds<n_t, d_t, l_t> initialSeeds() = 0;
 
+  /// Checks whether the normal flow- and edge functions of the given
+  /// (non-call) statement are the identity for all data-flow facts.
+  /// If IFDSIDESolverConfig::sparseESG() is set, the solver skips over such
+  /// statements and computes their results on demand.
+  [[nodiscard]] virtual bool isIrrelevantStmt(n_t /*Stmt*/) const {
+    return false;
+  }
+
   /// Returns the special tautological lambda (or zero) fact.
   [[nodiscard]] ByConstRef<d_t> getZeroValue() const {
     assert(ZeroValue.has_value());
@@ -35,6 +35,8 @@ enum class SolverConfigOptions : uint32_t {
   RecordEdges = 8,
   EmitESG = 16,
   ComputePersistedSummaries = 32,
+  Profile = 64,
+  SparseESG = 128,
 
   All = ~0U
 };
@@ -49,6 +51,12 @@ struct IFDSIDESolverConfig {
   [[nodiscard]] bool recordEdges() const;
   [[nodiscard]] bool emitESG() const;
   [[nodiscard]] bool computePersistedSummaries() const;
+  /// Attribute the solver's work to the analyzed functions, see
+  /// IDESolverProfiler
+  [[nodiscard]] bool profile() const;
+  /// Skip over statements that the problem declares irrelevant, see
+  /// IDETabulationProblem::isIrrelevantStmt()
+  [[nodiscard]] bool sparseESG() const;
 
   void setFollowReturnsPastSeeds(bool Set = true);
   void setAutoAddZero(bool Set = true);
@@ -56,6 +64,8 @@ struct IFDSIDESolverConfig {
   void setRecordEdges(bool Set = true);
   void setEmitESG(bool Set = true);
   void setComputePersistedSummaries(bool Set = true);
+  void setProfile(bool Set = true);
+  void setSparseESG(bool Set = true);
 
   void setConfig(SolverConfigOptions Opt);
 
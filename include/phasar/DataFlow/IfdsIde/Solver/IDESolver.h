@@ -18,6 +18,7 @@
 #define PHASAR_DATAFLOW_IFDSIDE_SOLVER_IDESOLVER_H
 
 #include "phasar/Config/Configuration.h"
+#include "phasar/ControlFlow/StmtLess.h"
 #include "phasar/DB/ProjectIRDBBase.h"
 #include "phasar/DataFlow/IfdsIde/EdgeFunction.h"
 #include "phasar/DataFlow/IfdsIde/EdgeFunctionStats.h"
@@ -30,6 +31,7 @@
 #include "phasar/DataFlow/IfdsIde/Solver/ESGEdgeKind.h"
 #include "phasar/DataFlow/IfdsIde/Solver/FlowEdgeFunctionCache.h"
 #include "phasar/DataFlow/IfdsIde/Solver/IDESolverAPIMixin.h"
+#include "phasar/DataFlow/IfdsIde/Solver/IDESolverProfiler.h"
 #include "phasar/DataFlow/IfdsIde/Solver/JumpFunctions.h"
 #include "phasar/DataFlow/IfdsIde/Solver/PathEdge.h"
 #include "phasar/DataFlow/IfdsIde/SolverResults.h"
@@ -43,6 +45,7 @@
 #include "phasar/Utils/Utilities.h"
 
 #include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/raw_ostream.h"
 
@@ -50,10 +53,12 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -101,15 +106,17 @@ public:
   nlohmann::json getAsJson() {
     using TableCell = typename Table<n_t, d_t, l_t>::Cell;
     const static std::string DataFlowID = "DataFlow";
+    expandAllSparseResults();
     nlohmann::json J;
     auto Results = this->ValTab.cellSet();
     if (Results.empty()) {
       J[DataFlowID] = "EMPTY";
     } else {
       std::vector<TableCell> Cells(Results.begin(), Results.end());
-      sort(Cells.begin(), Cells.end(), [](TableCell Lhs, TableCell Rhs) {
-        return Lhs.getRowKey() < Rhs.getRowKey();
-      });
+      sort(Cells.begin(), Cells.end(),
+           [](const TableCell &Lhs, const TableCell &Rhs) {
+             return Lhs.getRowKey() < Rhs.getRowKey();
+           });
       n_t Curr;
       for (unsigned I = 0; I < Cells.size(); ++I) {
         Curr = Cells[I].getRowKey();
@@ -131,7 +138,9 @@ public:
 
   /// Returns the L-type result for the given value at the given statement.
   [[nodiscard]] l_t resultAt(n_t Stmt, d_t Value) {
-    return getSolverResults().resultAt(Stmt, Value);
+    expandSparseResultsAt(Stmt);
+    return SolverResults<n_t, d_t, l_t>(ValTab, ZeroValue)
+        .resultAt(Stmt, Value);
   }
 
   /// Returns the L-type result at the given statement for the given data-flow
@@ -161,7 +170,9 @@ public:
   /// TOP values are never returned.
   [[nodiscard]] virtual std::unordered_map<d_t, l_t>
   resultsAt(n_t Stmt, bool StripZero = false) /*TODO const*/ {
-    return getSolverResults().resultsAt(Stmt, StripZero);
+    expandSparseResultsAt(Stmt);
+    return SolverResults<n_t, d_t, l_t>(ValTab, ZeroValue)
+        .resultsAt(Stmt, StripZero);
   }
 
   /// Returns the data-flow results at the given statement while respecting
@@ -245,7 +256,11 @@ public:
   /// lifetime is also bound to the lifetime of this solver. If you want to use
   /// the solverResults beyond the lifetime of this solver, use
   /// comsumeSolverResults() instead.
-  [[nodiscard]] SolverResults<n_t, d_t, l_t> getSolverResults() noexcept {
+  ///
+  /// If IFDSIDESolverConfig::sparseESG() is set, this first computes the
+  /// results at all statements that the solver has skipped.
+  [[nodiscard]] SolverResults<n_t, d_t, l_t> getSolverResults() {
+    expandAllSparseResults();
     return SolverResults<n_t, d_t, l_t>(this->ValTab, ZeroValue);
   }
 
@@ -253,8 +268,8 @@ public:
   /// can be destroyed without that the analysis results are lost.
   /// Do not call any function (including getSolverResults()) on this IDESolver
   /// instance after that.
-  [[nodiscard]] OwningSolverResults<n_t, d_t, l_t>
-  consumeSolverResults() noexcept(std::is_nothrow_move_constructible_v<d_t>) {
+  [[nodiscard]] OwningSolverResults<n_t, d_t, l_t> consumeSolverResults() {
+    expandAllSparseResults();
     return OwningSolverResults<n_t, d_t, l_t>(std::move(this->ValTab),
                                               std::move(ZeroValue));
   }
@@ -334,6 +349,30 @@ public:
     OS << getEdgeFunctionStatistics() << '\n';
   }
 
+  /// Returns the per-function profile of the solver run, or nullptr if
+  /// IFDSIDESolverConfig::profile() has not been set before solving.
+  [[nodiscard]] const IDESolverProfiler<f_t> *getProfiler() const noexcept {
+    return Profiler ? &*Profiler : nullptr;
+  }
+
+  /// Prints the functions ranked by the solver's time spent in them as JSON
+  void emitProfileAsJson(llvm::raw_ostream &OS = llvm::outs()) const {
+    if (Profiler) {
+      Profiler->printAsJson(OS, [this](f_t Fun) {
+        return std::string(ICF->getFunctionName(Fun));
+      });
+    }
+  }
+
+  /// Prints the profile as folded stacks to be rendered as flame graph
+  void emitProfileAsFoldedStacks(llvm::raw_ostream &OS = llvm::outs()) const {
+    if (Profiler) {
+      Profiler->printAsFoldedStacks(OS, [this](f_t Fun) {
+        return std::string(ICF->getFunctionName(Fun));
+      });
+    }
+  }
+
 protected:
   /// Lines 13-20 of the algorithm; processing a call site in the caller's
   /// context.
@@ -391,7 +430,9 @@ protected:
         HasNoCalleeInformation = false;
         PHASAR_LOG_LEVEL(DEBUG, "Found and process special summary");
         for (n_t ReturnSiteN : ReturnSiteNs) {
+          auto FFSample = sampleFlowFunctions();
           container_type Res = computeSummaryFlowFunction(SpecialSum, d1, d2);
+          FFSample.stop();
           INC_COUNTER("SpecialSummary-FF Application", 1, Full);
           ADD_TO_HISTOGRAM("Data-flow facts", Res.size(), 1, Full);
           saveEdges(n, ReturnSiteN, d2, Res, ESGEdgeKind::Summary);
@@ -406,15 +447,17 @@ protected:
             PHASAR_LOG_LEVEL(DEBUG,
                              "Compose: " << SumEdgFnE << " * " << f << '\n');
             WorkList.emplace_back(PathEdge(d1, ReturnSiteN, std::move(d3)),
-                                  IDEProblem.extend(f, SumEdgFnE));
+                                  extend(f, SumEdgFnE));
           }
         }
       } else {
         // compute the call-flow function
+        auto FFSample = sampleFlowFunctions();
         FlowFunctionPtrType Function =
             CachedFlowEdgeFunctions.getCallFlowFunction(n, SCalledProcN);
         INC_COUNTER("FF Queries", 1, Full);
         container_type Res = computeCallFlowFunction(Function, d1, d2);
+        FFSample.stop();
         ADD_TO_HISTOGRAM("Data-flow facts", Res.size(), 1, Full);
         // for each callee's start point(s)
         auto StartPointsOf = ICF->getStartPointsOf(SCalledProcN);
@@ -459,12 +502,14 @@ protected:
               // for each return site
               for (n_t RetSiteN : ReturnSiteNs) {
                 // compute return-flow function
+                auto FFSample = sampleFlowFunctions();
                 FlowFunctionPtrType RetFunction =
                     CachedFlowEdgeFunctions.getRetFlowFunction(n, SCalledProcN,
                                                                eP, RetSiteN);
                 INC_COUNTER("FF Queries", 1, Full);
                 const container_type ReturnedFacts = computeReturnFlowFunction(
                     RetFunction, d3, d4, n, Container{d2});
+                FFSample.stop();
                 ADD_TO_HISTOGRAM("Data-flow facts", ReturnedFacts.size(), 1,
                                  Full);
                 saveEdges(eP, RetSiteN, d4, ReturnedFacts, ESGEdgeKind::Ret);
@@ -498,15 +543,15 @@ protected:
                                                       << f4);
                   PHASAR_LOG_LEVEL(DEBUG,
                                    "         (return * calleeSummary * call)");
-                  EdgeFunction<l_t> fPrime = IDEProblem.extend(
-                      IDEProblem.extend(f4, fCalleeSummary), f5);
+                  EdgeFunction<l_t> fPrime =
+                      extend(extend(f4, fCalleeSummary), f5);
                   PHASAR_LOG_LEVEL(DEBUG, "       = " << fPrime);
                   d_t d5_restoredCtx = restoreContextOnReturnedFact(n, d2, d5);
                   // propagte the effects of the entire call
                   PHASAR_LOG_LEVEL(DEBUG, "Compose: " << fPrime << " * " << f);
                   WorkList.emplace_back(
                       PathEdge(d1, RetSiteN, std::move(d5_restoredCtx)),
-                      IDEProblem.extend(f, fPrime));
+                      extend(f, fPrime));
                 }
               }
             }
@@ -517,12 +562,14 @@ protected:
     // line 17-19 of Naeem/Lhotak/Rodriguez
     // process intra-procedural flows along call-to-return flow functions
     for (n_t ReturnSiteN : ReturnSiteNs) {
+      auto FFSample = sampleFlowFunctions();
       FlowFunctionPtrType CallToReturnFF =
           CachedFlowEdgeFunctions.getCallToRetFlowFunction(n, ReturnSiteN,
                                                            Callees);
       INC_COUNTER("FF Queries", 1, Full);
       container_type ReturnFacts =
           computeCallToReturnFlowFunction(CallToReturnFF, d1, d2);
+      FFSample.stop();
       ADD_TO_HISTOGRAM("Data-flow facts", ReturnFacts.size(), 1, Full);
       saveEdges(n, ReturnSiteN, d2, ReturnFacts,
                 HasNoCalleeInformation ? ESGEdgeKind::SkipUnknownFn
@@ -538,7 +585,7 @@ protected:
               .push_back(EdgeFnE);
         }
         INC_COUNTER("EF Queries", 1, Full);
-        auto fPrime = IDEProblem.extend(f, EdgeFnE);
+        auto fPrime = extend(f, EdgeFnE);
         PHASAR_LOG_LEVEL(DEBUG, "Compose: " << EdgeFnE << " * " << f << " = "
                                             << fPrime);
         WorkList.emplace_back(PathEdge(d1, ReturnSiteN, std::move(d3)),
@@ -560,30 +607,112 @@ protected:
     auto [d1, n, d2] = Edge.consume();
 
     for (const auto nPrime : ICF->getSuccsOf(n)) {
+      auto FFSample = sampleFlowFunctions();
       FlowFunctionPtrType FlowFunc =
           CachedFlowEdgeFunctions.getNormalFlowFunction(n, nPrime);
       INC_COUNTER("FF Queries", 1, Full);
       const container_type Res = computeNormalFlowFunction(FlowFunc, d1, d2);
+      FFSample.stop();
       ADD_TO_HISTOGRAM("Data-flow facts", Res.size(), 1, Full);
-      saveEdges(n, nPrime, d2, Res, ESGEdgeKind::Normal);
+      // In sparse mode, we directly propagate to the end of the chain of
+      // irrelevant statements starting at nPrime
+      n_t Target = getSparseSuccessor(n, nPrime);
+      auto *SparseChain =
+          Target != nPrime ? &SparseChains.find(nPrime)->second : nullptr;
+      saveEdges(n, Target, d2, Res, ESGEdgeKind::Normal);
       for (d_t d3 : Res) {
         EdgeFunction<l_t> g =
             CachedFlowEdgeFunctions.getNormalEdgeFunction(n, d2, nPrime, d3);
         PHASAR_LOG_LEVEL(DEBUG, "Queried Normal Edge Function: " << g);
-        EdgeFunction<l_t> fPrime = IDEProblem.extend(f, g);
+        if (SparseChain) {
+          SparseChain->EntryEdges.insert(d2, d3, g);
+        }
+        EdgeFunction<l_t> fPrime = extend(f, g);
         if (SolverConfig.emitESG()) {
-          IntermediateEdgeFunctions[std::make_tuple(n, d2, nPrime, d3)]
+          IntermediateEdgeFunctions[std::make_tuple(n, d2, Target, d3)]
               .push_back(g);
         }
         PHASAR_LOG_LEVEL(DEBUG,
                          "Compose: " << g << " * " << f << " = " << fPrime);
         INC_COUNTER("EF Queries", 1, Full);
-        WorkList.emplace_back(PathEdge(d1, nPrime, std::move(d3)),
+        WorkList.emplace_back(PathEdge(d1, Target, std::move(d3)),
                               std::move(fPrime));
       }
     }
   }
 
+  /// Whether the solver may skip over Stmt in sparse mode. These are the
+  /// statements that the problem declares irrelevant and that have a single
+  /// intra-procedural predecessor and successor, such that the facts holding
+  /// at them can be recovered from the facts at the preceding relevant
+  /// statement.
+  bool isSkippableStmt(n_t Stmt) {
+    return !ICF->isCallSite(Stmt) && !ICF->isExitInst(Stmt) &&
+           !ICF->isStartPoint(Stmt) &&
+           llvm::hasSingleElement(ICF->getPredsOf(Stmt)) &&
+           llvm::hasSingleElement(ICF->getSuccsOf(Stmt)) &&
+           !Seeds.containsInitialSeedsFor(Stmt) &&
+           IDEProblem.isIrrelevantStmt(Stmt);
+  }
+
+  /// Returns the first statement starting at Succ, a successor of Curr, that
+  /// the solver must not skip over. Returns Succ, if IFDSIDESolverConfig::
+  /// sparseESG() is not set.
+  n_t getSparseSuccessor(n_t Curr, n_t Succ) {
+    if (!SolverConfig.sparseESG()) {
+      return Succ;
+    }
+
+    auto [It, Inserted] = SparseSuccessors.try_emplace(Succ, Succ);
+    if (!Inserted) {
+      return It->second;
+    }
+
+    n_t Target = Succ;
+    while (isSkippableStmt(Target)) {
+      n_t Next = *ICF->getSuccsOf(Target).begin();
+      if (Next == Succ) {
+        // A loop that consists of irrelevant statements only
+        break;
+      }
+      SkippedStmts.try_emplace(Target, Succ);
+      Target = std::move(Next);
+    }
+
+    if (Target != Succ) {
+      SparseChains[Succ].Head = Curr;
+    }
+    It->second = Target;
+    return Target;
+  }
+
+  /// Computes the results at a statement that has been skipped in sparse mode
+  /// from the results at the relevant statement before the skipped chain
+  void expandSparseResultsAt(n_t Stmt) {
+    auto It = SkippedStmts.find(Stmt);
+    if (It == SkippedStmts.end()) {
+      return;
+    }
+
+    const auto &Chain = SparseChains.at(It->second);
+    const auto &HeadResults = std::as_const(ValTab).row(Chain.Head);
+    for (const auto &[SourceVal, Value] : HeadResults) {
+      for (const auto &[TargetVal, EdgeFn] :
+           std::as_const(Chain.EntryEdges).row(SourceVal)) {
+        setVal(Stmt, TargetVal,
+               IDEProblem.join(val(Stmt, TargetVal),
+                               EdgeFn.computeTarget(Value)));
+      }
+    }
+    SkippedStmts.erase(It);
+  }
+
+  void expandAllSparseResults() {
+    while (!SkippedStmts.empty()) {
+      expandSparseResultsAt(SkippedStmts.begin()->first);
+    }
+  }
+
   void propagateValueAtStart(const std::pair<n_t, d_t> NAndD, n_t Stmt) {
     PAMM_GET_INSTANCE;
     d_t Fact = NAndD.second;
@@ -706,6 +835,12 @@ protected:
   void pathEdgeProcessingTask(PathEdge<n_t, d_t> Edge) {
     PAMM_GET_INSTANCE;
     INC_COUNTER("JumpFn Construction", 1, Full);
+    // All work for this edge belongs to the function of its target, no matter
+    // which function the previously processed edge was in
+    auto ProfileSample = enterProfiler(Edge.getTarget());
+    if (Profiler) {
+      Profiler->countPathEdge();
+    }
     IF_LOG_LEVEL_ENABLED(DEBUG, {
       PHASAR_LOG_LEVEL(
           DEBUG,
@@ -914,14 +1049,18 @@ protected:
       // for each return site
       for (n_t RetSiteC : ICF->getReturnSitesOfCallAt(c)) {
         // compute return-flow function
+        auto FFSample = sampleFlowFunctions();
         FlowFunctionPtrType RetFunction =
             CachedFlowEdgeFunctions.getRetFlowFunction(
                 c, FunctionThatNeedsSummary, n, RetSiteC);
         INC_COUNTER("FF Queries", 1, Full);
+        FFSample.stop();
         // for each incoming-call value
         for (d_t d4 : Entry.second) {
+          FFSample = sampleFlowFunctions();
           const container_type Targets =
               computeReturnFlowFunction(RetFunction, d1, d2, c, Entry.second);
+          FFSample.stop();
           ADD_TO_HISTOGRAM("Data-flow facts", Targets.size(), 1, Full);
           saveEdges(n, RetSiteC, d2, Targets, ESGEdgeKind::Ret);
           // for each target value at the return site
@@ -950,8 +1089,7 @@ protected:
             PHASAR_LOG_LEVEL(DEBUG,
                              "Compose: " << f5 << " * " << f << " * " << f4);
             PHASAR_LOG_LEVEL(DEBUG, "         (return * function * call)");
-            EdgeFunction<l_t> fPrime =
-                IDEProblem.extend(IDEProblem.extend(f4, f), f5);
+            EdgeFunction<l_t> fPrime = extend(extend(f4, f), f5);
             PHASAR_LOG_LEVEL(DEBUG, "       = " << fPrime);
             // for each jump function coming into the call, propagate to
             // return site using the composed function
@@ -966,7 +1104,7 @@ protected:
                   PHASAR_LOG_LEVEL(DEBUG, "Compose: " << fPrime << " * " << f3);
                   WorkList.emplace_back(PathEdge(std::move(d3), RetSiteC,
                                                  std::move(d5_restoredCtx)),
-                                        IDEProblem.extend(f3, fPrime));
+                                        extend(f3, fPrime));
                 }
               }
             }
@@ -986,12 +1124,14 @@ protected:
       const auto &Callers = ICF->getCallersOf(FunctionThatNeedsSummary);
       for (n_t Caller : Callers) {
         for (n_t RetSiteC : ICF->getReturnSitesOfCallAt(Caller)) {
+          auto FFSample = sampleFlowFunctions();
           FlowFunctionPtrType RetFunction =
               CachedFlowEdgeFunctions.getRetFlowFunction(
                   Caller, FunctionThatNeedsSummary, n, RetSiteC);
           INC_COUNTER("FF Queries", 1, Full);
           const container_type Targets = computeReturnFlowFunction(
               RetFunction, d1, d2, Caller, Container{ZeroValue});
+          FFSample.stop();
           ADD_TO_HISTOGRAM("Data-flow facts", Targets.size(), 1, Full);
           saveEdges(n, RetSiteC, d2, Targets, ESGEdgeKind::Ret);
           for (d_t d5 : Targets) {
@@ -1005,8 +1145,7 @@ protected:
             }
             INC_COUNTER("EF Queries", 1, Full);
             PHASAR_LOG_LEVEL(DEBUG, "Compose: " << f5 << " * " << f);
-            propagteUnbalancedReturnFlow(RetSiteC, d5, IDEProblem.extend(f, f5),
-                                         Caller);
+            propagteUnbalancedReturnFlow(RetSiteC, d5, extend(f, f5), Caller);
             // register for value processing (2nd IDE phase)
             UnbalancedRetSites.insert(RetSiteC);
           }
@@ -1139,6 +1278,8 @@ protected:
     PHASAR_LOG_LEVEL(
         DEBUG, "Edge function : " << f << " (result of previous compose)");
 
+    auto PropagationSample = enterProfiler(Target);
+
     EdgeFunction<l_t> JumpFnE = [&]() {
       const auto RevLookupResult = JumpFn->reverseLookup(Target, TargetVal);
       if (RevLookupResult) {
@@ -1154,7 +1295,7 @@ protected:
       // was found
       return AllTop;
     }();
-    EdgeFunction<l_t> fPrime = IDEProblem.combine(JumpFnE, f);
+    EdgeFunction<l_t> fPrime = combine(JumpFnE, f);
     bool NewFunction = fPrime != JumpFnE;
 
     IF_LOG_LEVEL_ENABLED(DEBUG, {
@@ -1167,6 +1308,9 @@ protected:
       PHASAR_LOG_LEVEL(DEBUG, ' ');
     });
     if (NewFunction) {
+      if (Profiler && JumpFnE == AllTop) {
+        Profiler->countJumpFunction();
+      }
       JumpFn->addFunction(SourceVal, Target, TargetVal, fPrime);
       PathEdge Edge(SourceVal, Target, TargetVal);
       PathEdgeCount++;
@@ -1192,6 +1336,38 @@ protected:
     return IDEProblem.join(std::move(Curr), std::move(NewVal));
   }
 
+  /// Composes two edge functions and attributes the time to the profiler
+  EdgeFunction<l_t> extend(const EdgeFunction<l_t> &L,
+                           const EdgeFunction<l_t> &R) {
+    auto EFSample = sampleEdgeFunctions();
+    return IDEProblem.extend(L, R);
+  }
+
+  /// Joins two edge functions and attributes the time to the profiler
+  EdgeFunction<l_t> combine(const EdgeFunction<l_t> &L,
+                            const EdgeFunction<l_t> &R) {
+    auto EFSample = sampleEdgeFunctions();
+    return IDEProblem.combine(L, R);
+  }
+
+  using ProfileSample = typename IDESolverProfiler<f_t>::Sample;
+
+  /// Attributes the following work to the function containing Target
+  ProfileSample enterProfiler(n_t Target) {
+    if (!Profiler) {
+      return {};
+    }
+    return Profiler->enter(ICF->getFunctionOf(Target));
+  }
+
+  ProfileSample sampleFlowFunctions() {
+    return Profiler ? Profiler->sampleFlowFunctions() : ProfileSample{};
+  }
+
+  ProfileSample sampleEdgeFunctions() {
+    return Profiler ? Profiler->sampleEdgeFunctions() : ProfileSample{};
+  }
+
   std::set<typename Table<n_t, d_t, EdgeFunction<l_t>>::Cell>
   endSummary(n_t SP, d_t d3) {
     if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::Core) {
@@ -1264,10 +1440,11 @@ protected:
 
     // Sort intra-procedural path edges
     auto Cells = ComputedIntraPathEdges.cellVec();
-    StmtLess Stmtless(ICF);
-    sort(Cells.begin(), Cells.end(), [&Stmtless](auto Lhs, auto Rhs) {
-      return Stmtless(Lhs.getRowKey(), Rhs.getRowKey());
-    });
+    StmtLess<i_t> Stmtless(ICF);
+    sort(Cells.begin(), Cells.end(),
+         [&Stmtless](const auto &Lhs, const auto &Rhs) {
+           return Stmtless(Lhs.getRowKey(), Rhs.getRowKey());
+         });
     for (const auto &Cell : Cells) {
       auto Edge = std::make_pair(Cell.getRowKey(), Cell.getColumnKey());
       std::string N2Label = NToString(Edge.second);
@@ -1293,9 +1470,10 @@ protected:
 
     // Sort intra-procedural path edges
     Cells = ComputedInterPathEdges.cellVec();
-    sort(Cells.begin(), Cells.end(), [&Stmtless](auto Lhs, auto Rhs) {
-      return Stmtless(Lhs.getRowKey(), Rhs.getRowKey());
-    });
+    sort(Cells.begin(), Cells.end(),
+         [&Stmtless](const auto &Lhs, const auto &Rhs) {
+           return Stmtless(Lhs.getRowKey(), Rhs.getRowKey());
+         });
     for (const auto &Cell : Cells) {
       auto Edge = std::make_pair(Cell.getRowKey(), Cell.getColumnKey());
       std::string N2Label = NToString(Edge.second);
@@ -1505,20 +1683,32 @@ public:
     DOTConfig::importDOTConfig(DotConfigDir);
     DOTFunctionSubGraph *FG = nullptr;
 
+    // Each statement takes part in many edges; only convert its id to a string
+    // once
+    std::unordered_map<n_t, std::string> StmtIds;
+    auto GetStmtId = [this, &StmtIds](n_t Stmt) -> const std::string & {
+      auto [It, Inserted] = StmtIds.try_emplace(Stmt);
+      if (Inserted) {
+        It->second = ICF->getStatementId(Stmt);
+      }
+      return It->second;
+    };
+
     // Sort intra-procedural path edges
     auto Cells = ComputedIntraPathEdges.cellVec();
-    StmtLess Stmtless(ICF);
-    sort(Cells.begin(), Cells.end(), [&Stmtless](auto Lhs, auto Rhs) {
-      return Stmtless(Lhs.getRowKey(), Rhs.getRowKey());
-    });
+    StmtLess<i_t> Stmtless(ICF);
+    sort(Cells.begin(), Cells.end(),
+         [&Stmtless](const auto &Lhs, const auto &Rhs) {
+           return Stmtless(Lhs.getRowKey(), Rhs.getRowKey());
+         });
     for (const auto &Cell : Cells) {
       auto Edge = std::make_pair(Cell.getRowKey(), Cell.getColumnKey());
       std::string N1Label = NToString(Edge.first);
       std::string N2Label = NToString(Edge.second);
       PHASAR_LOG_LEVEL(DEBUG, "N1: " << N1Label);
       PHASAR_LOG_LEVEL(DEBUG, "N2: " << N2Label);
-      std::string N1StmtId = ICF->getStatementId(Edge.first);
-      std::string N2StmtId = ICF->getStatementId(Edge.second);
+      const auto &N1StmtId = GetStmtId(Edge.first);
+      const auto &N2StmtId = GetStmtId(Edge.second);
       std::string FuncName = ICF->getFunctionOf(Edge.first)->getName().str();
       // Get or create function subgraph
       if (!FG || FG->Id != FuncName) {
@@ -1601,17 +1791,18 @@ public:
     PHASAR_LOG_LEVEL(DEBUG, "Process inter-procedural path edges");
     PHASAR_LOG_LEVEL(DEBUG, "=============================================");
     Cells = ComputedInterPathEdges.cellVec();
-    sort(Cells.begin(), Cells.end(), [&Stmtless](auto Lhs, auto Rhs) {
-      return Stmtless(Lhs.getRowKey(), Rhs.getRowKey());
-    });
+    sort(Cells.begin(), Cells.end(),
+         [&Stmtless](const auto &Lhs, const auto &Rhs) {
+           return Stmtless(Lhs.getRowKey(), Rhs.getRowKey());
+         });
     for (const auto &Cell : Cells) {
       auto Edge = std::make_pair(Cell.getRowKey(), Cell.getColumnKey());
       std::string N1Label = NToString(Edge.first);
       std::string N2Label = NToString(Edge.second);
       std::string FNameOfN1 = ICF->getFunctionOf(Edge.first)->getName().str();
       std::string FNameOfN2 = ICF->getFunctionOf(Edge.second)->getName().str();
-      std::string N1StmtId = ICF->getStatementId(Edge.first);
-      std::string N2StmtId = ICF->getStatementId(Edge.second);
+      const auto &N1StmtId = GetStmtId(Edge.first);
+      const auto &N2StmtId = GetStmtId(Edge.second);
       PHASAR_LOG_LEVEL(DEBUG, "N1: " << N1Label);
       PHASAR_LOG_LEVEL(DEBUG, "N2: " << N2Label);
 
@@ -1711,16 +1902,6 @@ public:
   }
 
 private:
-  /// @brief: Allows less-than comparison based on the statement ID.
-  struct StmtLess {
-    const i_t *ICF;
-    StringIDLess StrIDLess;
-    StmtLess(const i_t *ICF) : ICF(ICF), StrIDLess(StringIDLess()) {}
-    bool operator()(n_t Lhs, n_t Rhs) {
-      return StrIDLess(ICF->getStatementId(Lhs), ICF->getStatementId(Rhs));
-    }
-  };
-
   /// -- InteractiveIDESolverMixin implementation
 
   bool doInitialize() {
@@ -1744,6 +1925,10 @@ private:
     REG_HISTOGRAM("Data-flow facts", Full);
     REG_HISTOGRAM("Points-to", Full);
 
+    if (SolverConfig.profile()) {
+      Profiler.emplace();
+    }
+
     PHASAR_LOG_LEVEL(INFO, "IDE solver is solving the specified problem");
     PHASAR_LOG_LEVEL(INFO,
                      "Submit initial seeds, construct exploded super graph");
@@ -1842,6 +2027,24 @@ private:
   Table<n_t, d_t, l_t> ValTab;
 
   std::map<std::pair<n_t, d_t>, size_t> FSummaryReuse;
+
+  std::optional<IDESolverProfiler<f_t>> Profiler;
+
+  /// The flows into a chain of statements that are skipped in sparse mode
+  struct SparseChainInfo {
+    /// The relevant statement that precedes the chain
+    n_t Head{};
+    /// Source fact at Head -> target fact at the first statement of the chain
+    Table<d_t, d_t, EdgeFunction<l_t>> EntryEdges{};
+  };
+
+  // Used if SolverConfig.sparseESG() is set. All keyed by the first statement
+  // of the skipped chain
+  std::unordered_map<n_t, n_t> SparseSuccessors;
+  std::unordered_map<n_t, SparseChainInfo> SparseChains;
+  // Skipped statement -> first statement of its chain; Erased once the results
+  // at the skipped statement have been computed
+  std::unordered_map<n_t, n_t> SkippedStmts;
 };
 
 template <typename AnalysisDomainTy, typename Container>
@@ -0,0 +1,299 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_DATAFLOW_IFDSIDE_SOLVER_IDESOLVERPROFILER_H
+#define PHASAR_DATAFLOW_IFDSIDE_SOLVER_IDESOLVERPROFILER_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/// Attributes the work of the IDESolver to the functions that it is spent in.
+///
+/// Counters, such as the number of processed path edges, are exact. Timings
+/// are only taken for every SamplingPeriod-th propagation (and the first one
+/// into each function) and extrapolated per function, so that profiling does
+/// not dominate the cost of cheap flow- and edge functions.
+///
+/// The IDESolver maintains an instance of this class iff
+/// IFDSIDESolverConfig::profile() is set.
+template <typename F> class IDESolverProfiler {
+public:
+  static constexpr uint32_t DefaultSamplingPeriod = 16;
+
+  struct FunctionProfile {
+    /// Number of path edges (including the already known ones) that reached
+    /// this function
+    size_t Propagations = 0;
+    size_t SampledPropagations = 0;
+    /// Number of new path edges that have been processed in this function
+    size_t PathEdges = 0;
+    /// Number of jump functions that have been added or updated
+    size_t JumpFunctions = 0;
+
+    uint64_t SampledTotalNanos = 0;
+    uint64_t SampledFlowFunctionNanos = 0;
+    uint64_t SampledEdgeFunctionNanos = 0;
+
+    [[nodiscard]] uint64_t extrapolate(uint64_t SampledNanos) const noexcept {
+      if (!SampledPropagations) {
+        return 0;
+      }
+      return uint64_t(double(SampledNanos) * double(Propagations) /
+                      double(SampledPropagations));
+    }
+
+    [[nodiscard]] uint64_t getTotalNanos() const noexcept {
+      return extrapolate(SampledTotalNanos);
+    }
+    [[nodiscard]] uint64_t getFlowFunctionNanos() const noexcept {
+      return extrapolate(SampledFlowFunctionNanos);
+    }
+    [[nodiscard]] uint64_t getEdgeFunctionNanos() const noexcept {
+      return extrapolate(SampledEdgeFunctionNanos);
+    }
+    /// The time spent in the solver itself, i.e., neither in flow- nor in
+    /// edge functions
+    [[nodiscard]] uint64_t getSelfNanos() const noexcept {
+      auto Total = getTotalNanos();
+      auto Callees = getFlowFunctionNanos() + getEdgeFunctionNanos();
+      return Total > Callees ? Total - Callees : 0;
+    }
+  };
+
+  /// Adds the time between its construction and stop() to a counter of the
+  /// current function. Without counter, it only marks the sampled section as
+  /// active. Default-constructed samples are inert.
+  class [[nodiscard]] Sample {
+  public:
+    Sample() noexcept = default;
+    Sample(uint64_t *Dest, bool *Active) noexcept
+        : Dest(Dest), Active(Active) {
+      if (Dest) {
+        Start = std::chrono::steady_clock::now();
+      }
+      if (Active) {
+        *Active = true;
+      }
+    }
+
+    Sample(Sample &&Other) noexcept
+        : Dest(std::exchange(Other.Dest, nullptr)),
+          Active(std::exchange(Other.Active, nullptr)), Start(Other.Start) {}
+    Sample &operator=(Sample &&Other) noexcept {
+      stop();
+      Dest = std::exchange(Other.Dest, nullptr);
+      Active = std::exchange(Other.Active, nullptr);
+      Start = Other.Start;
+      return *this;
+    }
+    Sample(const Sample &) = delete;
+    Sample &operator=(const Sample &) = delete;
+
+    ~Sample() { stop(); }
+
+    void stop() noexcept {
+      if (Dest) {
+        *Dest += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                     std::chrono::steady_clock::now() - Start)
+                     .count();
+        Dest = nullptr;
+      }
+      if (Active) {
+        *Active = false;
+        Active = nullptr;
+      }
+    }
+
+  private:
+    uint64_t *Dest = nullptr;
+    bool *Active = nullptr;
+    std::chrono::steady_clock::time_point Start{};
+  };
+
+  explicit IDESolverProfiler(
+      uint32_t SamplingPeriod = DefaultSamplingPeriod) noexcept
+      : SamplingPeriod(SamplingPeriod ? SamplingPeriod : 1) {}
+
+  /// Attributes all following events to Fun, until the next call to enter().
+  /// The returned sample measures the total time spent for the current
+  /// propagation; propagations must not nest.
+  ///
+  /// Entering Fun again while its propagation is still running, e.g., for
+  /// processing the path edge that the propagation has produced, neither
+  /// counts nor samples it a second time.
+  Sample enter(F Fun) {
+    auto *Profile = &Profiles[std::move(Fun)];
+    if (InPropagation) {
+      assert(Profile == Current &&
+             "Cannot enter a different function during a propagation");
+      return {};
+    }
+
+    Current = Profile;
+    ++Current->Propagations;
+
+    // Always sample the first propagation of each function, such that
+    // functions that are rarely reached get a time estimate as well
+    IsSampling = ++Tick >= SamplingPeriod || !Current->SampledPropagations;
+    if (!IsSampling) {
+      return {nullptr, &InPropagation};
+    }
+    Tick = 0;
+    ++Current->SampledPropagations;
+    return {&Current->SampledTotalNanos, &InPropagation};
+  }
+
+  void countPathEdge() noexcept {
+    assert(Current != nullptr);
+    ++Current->PathEdges;
+  }
+
+  void countJumpFunction() noexcept {
+    assert(Current != nullptr);
+    ++Current->JumpFunctions;
+  }
+
+  /// Measures the time spent constructing and applying flow functions. Nested
+  /// samples are ignored, such that no time is counted twice.
+  Sample sampleFlowFunctions() noexcept {
+    return sampleInto(&FunctionProfile::SampledFlowFunctionNanos);
+  }
+
+  /// Measures the time spent composing and joining edge functions. Nested
+  /// samples are ignored, such that no time is counted twice.
+  Sample sampleEdgeFunctions() noexcept {
+    return sampleInto(&FunctionProfile::SampledEdgeFunctionNanos);
+  }
+
+  [[nodiscard]] uint32_t getSamplingPeriod() const noexcept {
+    return SamplingPeriod;
+  }
+
+  [[nodiscard]] const llvm::DenseMap<F, FunctionProfile> &
+  getProfiles() const noexcept {
+    return Profiles;
+  }
+
+  /// Returns all profiled functions, ordered by their estimated total time,
+  /// most expensive first
+  [[nodiscard]] std::vector<std::pair<F, const FunctionProfile *>>
+  getRanking() const {
+    std::vector<std::pair<F, const FunctionProfile *>> Ret;
+    Ret.reserve(Profiles.size());
+    for (const auto &[Fun, Profile] : Profiles) {
+      Ret.emplace_back(Fun, &Profile);
+    }
+    std::stable_sort(Ret.begin(), Ret.end(), [](const auto &L, const auto &R) {
+      auto LTime = L.second->getTotalNanos();
+      auto RTime = R.second->getTotalNanos();
+      if (LTime != RTime) {
+        return LTime > RTime;
+      }
+      return L.second->PathEdges > R.second->PathEdges;
+    });
+    return Ret;
+  }
+
+  [[nodiscard]] nlohmann::json
+  getAsJson(llvm::function_ref<std::string(F)> GetName) const {
+    nlohmann::json J;
+    J["SamplingPeriod"] = SamplingPeriod;
+
+    size_t TotalPathEdges = 0;
+    uint64_t TotalNanos = 0;
+    auto &Funs = J["Functions"];
+    Funs = nlohmann::json::array();
+    for (const auto &[Fun, Profile] : getRanking()) {
+      TotalPathEdges += Profile->PathEdges;
+      TotalNanos += Profile->getTotalNanos();
+      Funs.push_back({
+          {"Function", GetName(Fun)},
+          {"PathEdges", Profile->PathEdges},
+          {"Propagations", Profile->Propagations},
+          {"JumpFunctions", Profile->JumpFunctions},
+          {"TotalTimeNs", Profile->getTotalNanos()},
+          {"FlowFunctionTimeNs", Profile->getFlowFunctionNanos()},
+          {"EdgeFunctionTimeNs", Profile->getEdgeFunctionNanos()},
+          {"SelfTimeNs", Profile->getSelfNanos()},
+      });
+    }
+    J["TotalPathEdges"] = TotalPathEdges;
+    J["TotalTimeNs"] = TotalNanos;
+    return J;
+  }
+
+  void printAsJson(llvm::raw_ostream &OS,
+                   llvm::function_ref<std::string(F)> GetName) const {
+    OS << getAsJson(GetName).dump(2) << '\n';
+  }
+
+  /// Prints the profile in the folded-stack format that flamegraph.pl,
+  /// speedscope and inferno understand. The weights are given in
+  /// microseconds.
+  void printAsFoldedStacks(llvm::raw_ostream &OS,
+                           llvm::function_ref<std::string(F)> GetName,
+                           llvm::StringRef Root = "IDESolver") const {
+    for (const auto &[Fun, Profile] : getRanking()) {
+      auto Name = GetName(Fun);
+      // ';' separates the frames
+      std::replace(Name.begin(), Name.end(), ';', ':');
+
+      auto PrintFrame = [&](llvm::StringRef Leaf, uint64_t Nanos) {
+        auto Micros = Nanos / 1000;
+        if (!Micros) {
+          return;
+        }
+        OS << Root << ';' << Name;
+        if (!Leaf.empty()) {
+          OS << ';' << Leaf;
+        }
+        OS << ' ' << Micros << '\n';
+      };
+
+      PrintFrame("", Profile->getSelfNanos());
+      PrintFrame("flow-functions", Profile->getFlowFunctionNanos());
+      PrintFrame("edge-functions", Profile->getEdgeFunctionNanos());
+    }
+  }
+
+private:
+  Sample sampleInto(uint64_t FunctionProfile::*Counter) noexcept {
+    if (!IsSampling || InnerSampleActive) {
+      return {};
+    }
+    assert(Current != nullptr);
+    return {&(Current->*Counter), &InnerSampleActive};
+  }
+
+  llvm::DenseMap<F, FunctionProfile> Profiles;
+  /// Points into Profiles; Only valid until the next call to enter()
+  FunctionProfile *Current = nullptr;
+  uint32_t SamplingPeriod{};
+  uint32_t Tick = 0;
+  bool IsSampling = false;
+  bool InPropagation = false;
+  bool InnerSampleActive = false;
+};
+
+} // namespace psr
+
+#endif // PHASAR_DATAFLOW_IFDSIDE_SOLVER_IDESOLVERPROFILER_H
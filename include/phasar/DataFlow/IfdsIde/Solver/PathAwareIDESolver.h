@@ -16,6 +16,10 @@
 #include "phasar/DataFlow/PathSensitivity/ExplodedSuperGraph.h"
 #include "phasar/Utils/Logger.h"
 
+#include "llvm/ADT/Twine.h"
+
+#include <system_error>
+
 namespace psr {
 template <typename AnalysisDomainTy,
           typename Container = std::set<typename AnalysisDomainTy::d_t>>
@@ -50,6 +54,16 @@ public:
     return std::move(ESG);
   }
 
+  /// Compacts the explicit ESG after solving. See
+  /// ExplodedSuperGraph::finalize()
+  void finalizeExplicitESG() { ESG.finalize(); }
+
+  /// Compacts the explicit ESG after solving and moves it into the
+  /// memory-mapped file FileName. See ExplodedSuperGraph::spillTo()
+  [[nodiscard]] std::error_code spillExplicitESGTo(const llvm::Twine &FileName) {
+    return ESG.spillTo(FileName);
+  }
+
 private:
   void saveEdges(n_t Curr, n_t Succ, d_t CurrNode,
                  const container_type &SuccNodes, ESGEdgeKind Kind) override {
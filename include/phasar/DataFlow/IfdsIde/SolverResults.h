@@ -17,6 +17,7 @@
 #ifndef PHASAR_DATAFLOW_IFDSIDE_SOLVERRESULTS_H
 #define PHASAR_DATAFLOW_IFDSIDE_SOLVERRESULTS_H
 
+#include "phasar/ControlFlow/StmtLess.h"
 #include "phasar/Domain/BinaryDomain.h"
 #include "phasar/Utils/ByRef.h"
 #include "phasar/Utils/PAMMMacros.h"
@@ -24,7 +25,12 @@
 #include "phasar/Utils/Table.h"
 #include "phasar/Utils/Utilities.h"
 
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
 #include <set>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -35,7 +41,7 @@ class Value;
 } // namespace llvm
 
 namespace psr {
-// For sorting the results in dumpResults()
+// Kept for compatibility; see LLVMShorthands.h
 std::string getMetaDataID(const llvm::Value *V);
 
 namespace detail {
@@ -140,46 +146,77 @@ public:
     OS << "\n***************************************************************\n"
        << "*                  Raw IDESolver results                      *\n"
        << "***************************************************************\n";
-    auto Cells = self().Results.cellVec();
-    if (Cells.empty()) {
+    const auto &RowMap = self().Results.rowMap();
+    if (RowMap.empty()) {
       OS << "No results computed!" << '\n';
     } else {
-      std::sort(
-          Cells.begin(), Cells.end(), [](const auto &Lhs, const auto &Rhs) {
-            if constexpr (std::is_same_v<n_t, const llvm::Instruction *>) {
-              return StringIDLess{}(getMetaDataID(Lhs.getRowKey()),
-                                    getMetaDataID(Rhs.getRowKey()));
-            } else {
-              // If non-LLVM IR is used
-              return Lhs.getRowKey() < Rhs.getRowKey();
-            }
-          });
-      n_t Prev = n_t{};
-      n_t Curr = n_t{};
+      // Only sort the statements; the results themselves are printed directly
+      // from the result table
+      std::vector<n_t> Stmts;
+      Stmts.reserve(RowMap.size());
+      for (const auto &Row : RowMap) {
+        Stmts.push_back(Row.first);
+      }
+      std::sort(Stmts.begin(), Stmts.end(), StmtLess<ICFGTy>(&ICF));
+
       f_t PrevFn = f_t{};
-      f_t CurrFn = f_t{};
-      for (unsigned I = 0; I < Cells.size(); ++I) {
-        Curr = Cells[I].getRowKey();
-        CurrFn = ICF.getFunctionOf(Curr);
+      for (const auto &Curr : Stmts) {
+        f_t CurrFn = ICF.getFunctionOf(Curr);
         if (PrevFn != CurrFn) {
           PrevFn = CurrFn;
           OS << "\n\n============ Results for function '" +
                     ICF.getFunctionName(CurrFn) + "' ============\n";
         }
-        if (Prev != Curr) {
-          Prev = Curr;
-          std::string NString = NToString(Curr);
-          std::string Line(NString.size(), '-');
-          OS << "\n\nN: " << NString << "\n---" << Line << '\n';
+
+        std::string NString = NToString(Curr);
+        std::string Line(NString.size(), '-');
+        OS << "\n\nN: " << NString << "\n---" << Line << '\n';
+        for (const auto &[Fact, Value] : RowMap.find(Curr)->second) {
+          OS << "\tD: " << DToString(Fact) << " | V: " << LToString(Value)
+             << '\n';
         }
-        OS << "\tD: " << DToString(Cells[I].getColumnKey())
-           << " | V: " << LToString(Cells[I].getValue()) << '\n';
       }
     }
     OS << '\n';
     STOP_TIMER("DFA IDE Result Dumping", Full);
   }
 
+  /// Writes the results as JSON Lines to OS: One JSON object per statement
+  /// that has results, in the order of the functions and instructions of the
+  /// ICF. The results are streamed directly from the result table, without
+  /// sorting or copying them, and the statements, facts and values are only
+  /// converted to strings as they are written.
+  ///
+  /// Format: {"function": "...", "id": "<statement-id>", "stmt": "...",
+  ///          "results": [{"fact": "...", "value": "..."}, ...]}
+  template <typename ICFGTy>
+  void exportResultsAsJsonl(const ICFGTy &ICF, llvm::raw_ostream &OS) const {
+    const auto &Results = self().Results;
+    for (const auto &Fun : ICF.getAllFunctions()) {
+      for (const auto &Stmt : ICF.getAllInstructionsOf(Fun)) {
+        if (!Results.containsRow(Stmt)) {
+          continue;
+        }
+
+        llvm::json::OStream JOS(OS);
+        JOS.object([&] {
+          JOS.attribute("function", ICF.getFunctionName(Fun));
+          JOS.attribute("id", ICF.getStatementId(Stmt));
+          JOS.attribute("stmt", NToString(Stmt));
+          JOS.attributeArray("results", [&] {
+            for (const auto &[Fact, Value] : Results.row(Stmt)) {
+              JOS.object([&] {
+                JOS.attribute("fact", DToString(Fact));
+                JOS.attribute("value", LToString(Value));
+              });
+            }
+          });
+        });
+        OS << '\n';
+      }
+    }
+  }
+
 private:
   [[nodiscard]] const Derived &self() const noexcept {
     static_assert(std::is_base_of_v<SolverResultsBase, Derived>);
@@ -3,50 +3,79 @@
 
 #include "phasar/Utils/Printer.h"
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include "boost/functional/hash.hpp"
 
-#include <deque>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace psr {
 
+/// A call-string of at most K call-sites.
+///
+/// The call-sites are stored inline, so creating, copying and modifying a
+/// CallStringCTX never allocates. Pushing to a full call-string drops the
+/// oldest call-site.
 template <typename N, unsigned K> class CallStringCTX {
+  static_assert(K > 0, "The call-string length must be positive");
+
 protected:
-  std::deque<N> CallString;
+  std::array<N, K> CallString{};
+  uint32_t Size = 0;
   static constexpr unsigned KLimit = K;
   friend struct std::hash<psr::CallStringCTX<N, K>>;
 
 public:
   CallStringCTX() = default;
 
-  CallStringCTX(std::initializer_list<N> IList) : CallString(IList) {
+  CallStringCTX(std::initializer_list<N> IList) {
     if (IList.size() > KLimit) {
       throw std::runtime_error(
           "initial call std::string length exceeds maximal length K");
     }
+    std::copy(IList.begin(), IList.end(), CallString.begin());
+    Size = IList.size();
   }
 
   void push_back(N Stmt) { // NOLINT
-    if (CallString.size() > KLimit - 1) {
-      CallString.pop_front();
+    if (Size == KLimit) {
+      std::move(std::next(CallString.begin()), CallString.end(),
+                CallString.begin());
+      --Size;
     }
-    CallString.push_back(Stmt);
+    CallString[Size++] = std::move(Stmt);
   }
 
   N pop_back() { // NOLINT
-    if (!CallString.empty()) {
-      N Stmt = CallString.back();
-      CallString.pop_back();
-      return Stmt;
+    if (Size != 0) {
+      return std::exchange(CallString[--Size], N{});
     }
     return N{};
   }
 
+  /// The most recent call-site. Requires !empty()
+  [[nodiscard]] const N &back() const noexcept {
+    assert(Size != 0);
+    return CallString[Size - 1];
+  }
+
+  [[nodiscard]] llvm::ArrayRef<N> getCallSites() const noexcept {
+    return llvm::makeArrayRef(CallString.data(), Size);
+  }
+
   [[nodiscard]] bool isEqual(const CallStringCTX &Rhs) const {
-    return CallString == Rhs.CallString;
+    return getCallSites() == Rhs.getCallSites();
   }
 
   [[nodiscard]] bool isDifferent(const CallStringCTX &Rhs) const {
@@ -65,23 +94,42 @@ public:
 
   friend bool operator<(const CallStringCTX<N, K> &Lhs,
                         const CallStringCTX<N, K> &Rhs) {
-    return Lhs.cs < Rhs.cs;
+    auto LhsCS = Lhs.getCallSites();
+    auto RhsCS = Rhs.getCallSites();
+    return std::lexicographical_compare(LhsCS.begin(), LhsCS.end(),
+                                        RhsCS.begin(), RhsCS.end());
   }
 
   llvm::raw_ostream &print(llvm::raw_ostream &OS) const {
     OS << "Call string: [ ";
-    for (auto C : CallString) {
-      OS << NToString(C);
-      if (C != CallString.back()) {
+    for (uint32_t I = 0; I != Size; ++I) {
+      if (I != 0) {
         OS << " * ";
       }
+      OS << NToString(CallString[I]);
     }
     return OS << " ]";
   }
 
-  [[nodiscard]] bool empty() const { return CallString.empty(); }
+  [[nodiscard]] bool empty() const { return Size == 0; }
 
-  [[nodiscard]] std::size_t size() const { return CallString.size(); }
+  [[nodiscard]] std::size_t size() const { return Size; }
+};
+
+/// A handle to a call-string that is interned in a CallStringCTXTree. Two
+/// handles from the same tree are equal iff they refer to equal call-strings.
+struct CallStringCTXId {
+  uint32_t Id{};
+
+  friend bool operator==(CallStringCTXId Lhs, CallStringCTXId Rhs) noexcept {
+    return Lhs.Id == Rhs.Id;
+  }
+  friend bool operator!=(CallStringCTXId Lhs, CallStringCTXId Rhs) noexcept {
+    return !(Lhs == Rhs);
+  }
+  friend bool operator<(CallStringCTXId Lhs, CallStringCTXId Rhs) noexcept {
+    return Lhs.Id < Rhs.Id;
+  }
 };
 
 } // namespace psr
@@ -90,14 +138,101 @@ namespace std {
 
 template <typename N, unsigned K> struct hash<psr::CallStringCTX<N, K>> {
   size_t operator()(const psr::CallStringCTX<N, K> &CS) const noexcept {
-    boost::hash<std::deque<N>> HashDeque;
+    auto CallSites = CS.getCallSites();
+    size_t H = boost::hash_range(CallSites.begin(), CallSites.end());
     std::hash<unsigned> HashUnsigned;
     size_t U = HashUnsigned(K);
-    size_t H = HashDeque(CS.CallString);
     return U ^ (H << 1);
   }
 };
 
+template <> struct hash<psr::CallStringCTXId> {
+  size_t operator()(psr::CallStringCTXId Ctx) const noexcept { return Ctx.Id; }
+};
+
 } // namespace std
 
+namespace psr {
+
+/// Interns CallStringCTX objects and hands out CallStringCTXId handles to
+/// them.
+///
+/// The interned call-strings form a tree, where the parent of a call-string
+/// is the call-string without its most recent call-site. Both, parent links
+/// and pushed call-strings are memoized, such that push() and pop() are
+/// amortized O(1) and never copy a call-string after it has been created
+/// once.
+template <typename N, unsigned K> class CallStringCTXTree {
+public:
+  using context_t = CallStringCTX<N, K>;
+
+  CallStringCTXTree() {
+    Nodes.push_back({context_t{}, 0});
+    Ids.try_emplace(context_t{}, 0);
+  }
+
+  /// The empty call-string
+  [[nodiscard]] static constexpr CallStringCTXId getEmpty() noexcept {
+    return {0};
+  }
+
+  [[nodiscard]] CallStringCTXId intern(const context_t &CS) {
+    if (auto It = Ids.find(CS); It != Ids.end()) {
+      return {It->second};
+    }
+
+    // CS cannot be empty here, so it has a parent. Intern the parent first,
+    // such that it gets the smaller id
+    auto Parent = CS;
+    Parent.pop_back();
+    auto ParentId = intern(Parent);
+
+    auto Id = uint32_t(Nodes.size());
+    Nodes.push_back({CS, ParentId.Id});
+    Ids.try_emplace(CS, Id);
+    return {Id};
+  }
+
+  /// The call-string Ctx extended by CallSite
+  [[nodiscard]] CallStringCTXId push(CallStringCTXId Ctx, N CallSite) {
+    if (auto It = PushCache.find({Ctx.Id, CallSite}); It != PushCache.end()) {
+      return {It->second};
+    }
+
+    auto CS = get(Ctx);
+    CS.push_back(CallSite);
+    auto Ret = intern(CS);
+    PushCache.try_emplace({Ctx.Id, CallSite}, Ret.Id);
+    return Ret;
+  }
+
+  /// The call-string Ctx without its most recent call-site
+  [[nodiscard]] CallStringCTXId pop(CallStringCTXId Ctx) const noexcept {
+    return {Nodes[Ctx.Id].Parent};
+  }
+
+  [[nodiscard]] const context_t &get(CallStringCTXId Ctx) const noexcept {
+    return Nodes[Ctx.Id].CS;
+  }
+
+  [[nodiscard]] bool empty(CallStringCTXId Ctx) const noexcept {
+    return Ctx == getEmpty();
+  }
+
+  /// The number of distinct call-strings interned so far
+  [[nodiscard]] size_t size() const noexcept { return Nodes.size(); }
+
+private:
+  struct Node {
+    context_t CS;
+    uint32_t Parent;
+  };
+
+  std::vector<Node> Nodes;
+  std::unordered_map<context_t, uint32_t> Ids;
+  llvm::DenseMap<std::pair<uint32_t, N>, uint32_t> PushCache;
+};
+
+} // namespace psr
+
 #endif
@@ -74,6 +74,11 @@ public:
                                          llvm::ArrayRef<f_t> Callees,
                                          const mono_container_t &In) = 0;
 
+  /// Whether normalFlow(Inst, In) == In holds for all In. Such instructions
+  /// can be skipped by the InterMonoSolver in sparse propagation mode. Must
+  /// not depend on the data-flow facts.
+  virtual bool isIdentityNormalFlow(n_t /*Inst*/) { return false; }
+
   [[nodiscard]] const i_t *getICFG() const { return ICF; }
 };
 
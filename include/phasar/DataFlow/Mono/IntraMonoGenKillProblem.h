@@ -0,0 +1,87 @@
+/******************************************************************************
+ * Copyright (c) 2024 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_DATAFLOW_MONO_INTRAMONOGENKILLPROBLEM_H
+#define PHASAR_DATAFLOW_MONO_INTRAMONOGENKILLPROBLEM_H
+
+#include "phasar/DataFlow/Mono/IntraMonoProblem.h"
+
+#include "llvm/ADT/SmallVector.h"
+
+#include <utility>
+
+namespace psr {
+
+/// An IntraMonoProblem whose flow-functions all have the shape
+/// Out = (In \ Kill) ∪ Gen and that merges either by set-union (may-analysis)
+/// or by set-intersection (must-analysis).
+///
+/// Such problems can be solved by the IntraMonoGenKillSolver, which represents
+/// the data-flow facts as bit-vectors and summarizes whole basic blocks into a
+/// single gen/kill pair. They can still be solved by the generic
+/// IntraMonoSolver as well.
+///
+/// Subclasses should only override genKill() and isMustAnalysis(); the
+/// remaining flow-functions are derived from them.
+template <typename AnalysisDomainTy>
+class IntraMonoGenKillProblem : public IntraMonoProblem<AnalysisDomainTy> {
+public:
+  using typename IntraMonoProblem<AnalysisDomainTy>::n_t;
+  using typename IntraMonoProblem<AnalysisDomainTy>::d_t;
+  using typename IntraMonoProblem<AnalysisDomainTy>::mono_container_t;
+
+  using IntraMonoProblem<AnalysisDomainTy>::IntraMonoProblem;
+
+  /// Collects the facts that are generated, resp. killed by Inst
+  virtual void genKill(n_t Inst, llvm::SmallVectorImpl<d_t> &Gen,
+                       llvm::SmallVectorImpl<d_t> &Kill) = 0;
+
+  /// Whether facts must hold on all paths (intersection) rather than on some
+  /// path (union) to reach a program point
+  [[nodiscard]] virtual bool isMustAnalysis() const = 0;
+
+  mono_container_t normalFlow(n_t Inst, const mono_container_t &In) final {
+    llvm::SmallVector<d_t, 4> Gen;
+    llvm::SmallVector<d_t, 4> Kill;
+    genKill(Inst, Gen, Kill);
+
+    auto Out = In;
+    for (const auto &Fact : Kill) {
+      Out.erase(Fact);
+    }
+    Out.insert(Gen.begin(), Gen.end());
+    return Out;
+  }
+
+  mono_container_t merge(const mono_container_t &Lhs,
+                         const mono_container_t &Rhs) final {
+    if (!isMustAnalysis()) {
+      auto Ret = Lhs;
+      Ret.insert(Rhs.begin(), Rhs.end());
+      return Ret;
+    }
+
+    mono_container_t Ret;
+    for (const auto &Fact : Lhs) {
+      if (Rhs.count(Fact)) {
+        Ret.insert(Fact);
+      }
+    }
+    return Ret;
+  }
+
+  bool equal_to( // NOLINT - this would break client analyses
+      const mono_container_t &Lhs, const mono_container_t &Rhs) final {
+    return Lhs == Rhs;
+  }
+};
+
+} // namespace psr
+
+#endif // PHASAR_DATAFLOW_MONO_INTRAMONOGENKILLPROBLEM_H
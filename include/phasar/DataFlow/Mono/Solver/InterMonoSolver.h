@@ -20,13 +20,26 @@
 #include "phasar/DataFlow/Mono/Contexts/CallStringCTX.h"
 #include "phasar/DataFlow/Mono/InterMonoProblem.h"
 
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+
 #include <deque>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace psr {
 
+enum class InterMonoPropagationMode {
+  /// Propagate the data-flow facts along every control-flow edge
+  Dense,
+  /// Propagate the data-flow facts directly over chains of instructions whose
+  /// normal flow-function is the identity, see
+  /// InterMonoProblem::isIdentityNormalFlow()
+  Sparse,
+};
+
 template <typename AnalysisDomainTy, unsigned K> class InterMonoSolver {
 public:
   using ProblemTy = InterMonoProblem<AnalysisDomainTy>;
@@ -41,31 +54,154 @@ public:
 protected:
   ProblemTy &IMProblem;
   std::deque<std::pair<n_t, n_t>> Worklist;
-  std::unordered_map<
-      n_t, std::unordered_map<CallStringCTX<n_t, K>, mono_container_t>>
+  /// The call-strings are interned, such that the contexts can be used as
+  /// cheap map-keys and pushing/popping a call-site does not copy them
+  CallStringCTXTree<n_t, K> Contexts;
+  std::unordered_map<n_t,
+                     std::unordered_map<CallStringCTXId, mono_container_t>>
       Analysis;
   std::unordered_set<f_t> AddedFunctions;
   const i_t *ICF;
+  InterMonoPropagationMode Mode;
+  std::unordered_set<n_t> SeedNodes;
+  std::unordered_map<n_t, bool> SkippedCache;
+  std::vector<n_t> SkippedNodes;
+
+  /// In sparse mode, an instruction is skipped if its normal flow-function is
+  /// the identity and its facts are fully determined by its unique
+  /// predecessor. No facts are stored for skipped instructions; instead they
+  /// are forwarded directly to the next instruction that is not skipped.
+  bool isSkipped(n_t Inst) {
+    if (Mode != InterMonoPropagationMode::Sparse) {
+      return false;
+    }
+    auto [It, Inserted] = SkippedCache.try_emplace(Inst, false);
+    if (Inserted) {
+      It->second = computeIsSkipped(Inst);
+      if (It->second) {
+        SkippedNodes.push_back(Inst);
+      }
+    }
+    return It->second;
+  }
+
+  bool computeIsSkipped(n_t Inst) {
+    if (SeedNodes.count(Inst) || ICF->isCallSite(Inst) ||
+        ICF->isExitInst(Inst) || ICF->isStartPoint(Inst) ||
+        !IMProblem.isIdentityNormalFlow(Inst)) {
+      return false;
+    }
+    const auto &Preds = ICF->getPredsOf(Inst);
+    if (llvm::size(Preds) != 1 || llvm::size(ICF->getSuccsOf(Inst)) != 1) {
+      return false;
+    }
+    // The facts that flow along call-to-return and return edges are not
+    // computed by the normal flow-function
+    auto Pred = *Preds.begin();
+    if (ICF->isCallSite(Pred) || ICF->isExitInst(Pred)) {
+      return false;
+    }
+    // processExit() updates the facts at return-sites without propagating
+    // them further, so the successor of a return-site must keep its own facts
+    return llvm::none_of(ICF->getPredsOf(Pred), [this](const auto &PredPred) {
+      return ICF->isCallSite(PredPred);
+    });
+  }
+
+  /// Follows the chain of skipped instructions starting at Dst. Returns the
+  /// last skipped instruction (or Src, if Dst is not skipped) together with
+  /// the first instruction after the chain
+  std::pair<n_t, n_t> followSkippedChain(n_t Src, n_t Dst) {
+    while (isSkipped(Dst)) {
+      Src = Dst;
+      Dst = *ICF->getSuccsOf(Dst).begin();
+    }
+    return {Src, Dst};
+  }
+
+  /// The last instruction before Inst that is not skipped
+  n_t getChainHead(n_t Inst) {
+    while (isSkipped(Inst)) {
+      Inst = *ICF->getPredsOf(Inst).begin();
+    }
+    return Inst;
+  }
+
+  /// The facts of Inst per context. For skipped instructions, these are
+  /// computed from the head of the chain
+  std::unordered_map<CallStringCTXId, mono_container_t>
+  getContextMapAt(n_t Inst) {
+    if (!isSkipped(Inst)) {
+      auto It = Analysis.find(Inst);
+      return It != Analysis.end()
+                 ? It->second
+                 : std::unordered_map<CallStringCTXId, mono_container_t>{};
+    }
+    auto Head = getChainHead(Inst);
+    std::unordered_map<CallStringCTXId, mono_container_t> Ret;
+    if (auto It = Analysis.find(Head); It != Analysis.end()) {
+      for (const auto &[Ctx, Facts] : It->second) {
+        Ret.try_emplace(Ctx, IMProblem.normalFlow(Head, Facts));
+      }
+    }
+    return Ret;
+  }
+
+  /// The facts after Inst in context Ctx
+  mono_container_t getOutSetOf(n_t Inst, CallStringCTXId Ctx) {
+    if (!isSkipped(Inst)) {
+      return IMProblem.normalFlow(Inst, Analysis[Inst][Ctx]);
+    }
+    auto Head = getChainHead(Inst);
+    if (auto It = Analysis.find(Head); It != Analysis.end()) {
+      if (auto CtxIt = It->second.find(Ctx); CtxIt != It->second.end()) {
+        return IMProblem.normalFlow(Head, CtxIt->second);
+      }
+    }
+    return mono_container_t{};
+  }
+
+  /// Adds the edges to the front of the worklist, leaving out the ones that
+  /// start at a skipped instruction
+  template <typename EdgeRange> void enqueueFront(const EdgeRange &Edges) {
+    if (Mode != InterMonoPropagationMode::Sparse) {
+      Worklist.insert(Worklist.begin(), Edges.begin(), Edges.end());
+      return;
+    }
+    llvm::SmallVector<std::pair<n_t, n_t>> NonSkipped;
+    for (const auto &Edge : Edges) {
+      if (!isSkipped(Edge.first)) {
+        NonSkipped.push_back(Edge);
+      }
+    }
+    Worklist.insert(Worklist.begin(), NonSkipped.begin(), NonSkipped.end());
+  }
 
   void initialize() {
-    for (auto &[Node, FlowFacts] : IMProblem.initialSeeds()) {
+    auto Seeds = IMProblem.initialSeeds();
+    for (const auto &[Node, FlowFacts] : Seeds) {
+      SeedNodes.insert(Node);
+    }
+    for (auto &[Node, FlowFacts] : Seeds) {
       auto ControlFlowEdges =
           ICF->getAllControlFlowEdges(ICF->getFunctionOf(Node));
-      Worklist.insert(Worklist.begin(), ControlFlowEdges.begin(),
-                      ControlFlowEdges.end());
+      enqueueFront(ControlFlowEdges);
       // Initialize with empty context and empty data-flow set such that the
       // flow functions are at least called once per instruction
       for (auto &[Src, Dst] : ControlFlowEdges) {
-        Analysis[Src][CallStringCTX<n_t, K>()] = IMProblem.allTop();
+        if (!isSkipped(Src)) {
+          Analysis[Src][Contexts.getEmpty()] = IMProblem.allTop();
+        }
       }
       // Initialize last
-      if (!ControlFlowEdges.empty()) {
-        Analysis[ControlFlowEdges.back().second][CallStringCTX<n_t, K>()] =
+      if (!ControlFlowEdges.empty() &&
+          !isSkipped(ControlFlowEdges.back().second)) {
+        Analysis[ControlFlowEdges.back().second][Contexts.getEmpty()] =
             IMProblem.allTop();
       }
       // Additionally, insert the initial seeds
-      Analysis[Node][CallStringCTX<n_t, K>()].insert(FlowFacts.begin(),
-                                                     FlowFacts.end());
+      Analysis[Node][Contexts.getEmpty()].insert(FlowFacts.begin(),
+                                                 FlowFacts.end());
     }
   }
 
@@ -104,15 +240,17 @@ protected:
       }
       // Add intra edges of callee
       auto Edges = ICF->getAllControlFlowEdges(Callee);
-      Worklist.insert(Worklist.begin(), Edges.begin(), Edges.end());
+      enqueueFront(Edges);
       // Initialize with empty context and empty data-flow set such that the
       // flow functions are at least called once per instruction
       for (auto &[Src, Dst] : Edges) {
-        Analysis[Src][CallStringCTX<n_t, K>()] = IMProblem.allTop();
+        if (!isSkipped(Src)) {
+          Analysis[Src][Contexts.getEmpty()] = IMProblem.allTop();
+        }
       }
       // Initialize last
-      if (!Edges.empty()) {
-        Analysis[Edges.back().second][CallStringCTX<n_t, K>()] =
+      if (!Edges.empty() && !isSkipped(Edges.back().second)) {
+        Analysis[Edges.back().second][Contexts.getEmpty()] =
             IMProblem.allTop();
       }
       // Add return Edge(s)
@@ -128,8 +266,10 @@ protected:
 
   void addToWorklist(std::pair<n_t, n_t> Edge) {
     auto Src = Edge.first;
-    auto Dst = Edge.second;
-    Worklist.push_back({Src, Dst});
+    Worklist.push_back(Edge);
+    // The facts have actually changed at the end of the chain of skipped
+    // instructions
+    auto Dst = followSkippedChain(Src, Edge.second).second;
     // add intra-procedural edges again
     for (auto Nprimeprime : ICF->getSuccsOf(Dst)) {
       Worklist.push_back({Dst, Nprimeprime});
@@ -144,8 +284,8 @@ protected:
     }
     // add inter-procedural return edges again
     if (ICF->isExitInst(Dst)) {
-      for (const auto *Caller : ICF->getCallersOf(ICF->getFunctionOf(Dst))) {
-        for (const auto *Nprimeprime : ICF->getSuccsOf(Caller)) {
+      for (auto Caller : ICF->getCallersOf(ICF->getFunctionOf(Dst))) {
+        for (auto Nprimeprime : ICF->getSuccsOf(Caller)) {
           Worklist.push_back({Dst, Nprimeprime});
         }
       }
@@ -153,8 +293,10 @@ protected:
   }
 
 public:
-  InterMonoSolver(InterMonoProblem<AnalysisDomainTy> &IMP)
-      : IMProblem(IMP), ICF(IMP.getICFG()) {}
+  InterMonoSolver(
+      InterMonoProblem<AnalysisDomainTy> &IMP,
+      InterMonoPropagationMode Mode = InterMonoPropagationMode::Dense)
+      : IMProblem(IMP), ICF(IMP.getICFG()), Mode(Mode) {}
 
   InterMonoSolver(const InterMonoSolver &) = delete;
 
@@ -169,28 +311,46 @@ public:
   std::unordered_map<
       n_t, std::unordered_map<CallStringCTX<n_t, K>, mono_container_t>>
   getAnalysis() {
-    return Analysis;
+    std::unordered_map<
+        n_t, std::unordered_map<CallStringCTX<n_t, K>, mono_container_t>>
+        Ret;
+    Ret.reserve(Analysis.size());
+    auto Insert = [&](n_t Node, const auto &ContextMap) {
+      auto &RetContextMap = Ret[Node];
+      for (const auto &[Ctx, FlowFacts] : ContextMap) {
+        RetContextMap.try_emplace(Contexts.get(Ctx), FlowFacts);
+      }
+    };
+    for (const auto &[Node, ContextMap] : Analysis) {
+      Insert(Node, ContextMap);
+    }
+    for (auto Node : SkippedNodes) {
+      Insert(Node, getContextMapAt(Node));
+    }
+    return Ret;
   }
 
   void processNormal(std::pair<n_t, n_t> Edge) {
     llvm::outs() << "Handle normal flow\n";
     auto Src = Edge.first;
-    auto Dst = Edge.second;
+    // In sparse mode, the facts are propagated over all skipped instructions
+    // at once; Tail is the last of them
+    auto [Tail, Dst] = followSkippedChain(Src, Edge.second);
     llvm::outs() << "Src: " << NToString(Src) << '\n';
     llvm::outs() << "Dst: " << NToString(Dst) << '\n';
-    std::unordered_map<CallStringCTX<n_t, K>, mono_container_t> Out;
+    std::unordered_map<CallStringCTXId, mono_container_t> Out;
     for (auto &[Ctx, Facts] : Analysis[Src]) {
       Out[Ctx] = IMProblem.normalFlow(Src, Analysis[Src][Ctx]);
       // need to merge if Dst is a branch target
-      if (ICF->isBranchTarget(Src, Dst)) {
+      if (ICF->isBranchTarget(Tail, Dst)) {
         llvm::outs() << "Num preds: " << ICF->getPredsOf(Dst).size() << '\n';
         for (auto Pred : ICF->getPredsOf(Dst)) {
-          if (Pred != Src) {
+          if (Pred != Tail) {
             // we need to compute the out set of Pred and merge it with the
             // out set of Src on-the-fly as we do not have a dedicated
             // storage for merge points (otherwise we run into trouble with
             // merge operator such as set union)
-            auto OtherPredOut = IMProblem.normalFlow(Pred, Analysis[Pred][Ctx]);
+            auto OtherPredOut = getOutSetOf(Pred, Ctx);
             Out[Ctx] = IMProblem.merge(Out[Ctx], OtherPredOut);
           }
         }
@@ -211,7 +371,7 @@ public:
         IMProblem.printContainer(llvm::outs(), Merged);
         llvm::outs() << '\n';
         Analysis[Dst][Ctx] = Merged;
-        addToWorklist({Src, Dst});
+        addToWorklist(Edge);
       }
     }
   }
@@ -219,14 +379,13 @@ public:
   void processCall(std::pair<n_t, n_t> Edge) {
     auto Src = Edge.first;
     auto Dst = Edge.second;
-    std::unordered_map<CallStringCTX<n_t, K>, mono_container_t> Out;
+    std::unordered_map<CallStringCTXId, mono_container_t> Out;
     if (!isIntraEdge(Edge)) {
       llvm::outs() << "Handle call flow\n";
       llvm::outs() << "Src: " << NToString(Src) << '\n';
       llvm::outs() << "Dst: " << NToString(Dst) << '\n';
       for (auto &[Ctx, Facts] : Analysis[Src]) {
-        auto CTXAdd(Ctx);
-        CTXAdd.push_back(Src);
+        auto CTXAdd = Contexts.push(Ctx, Src);
         Out[CTXAdd] = IMProblem.callFlow(Src, ICF->getFunctionOf(Dst),
                                          Analysis[Src][Ctx]);
         bool FlowFactStabilized =
@@ -283,24 +442,25 @@ public:
   void processExit(std::pair<n_t, n_t> Edge) {
     auto Src = Edge.first;
     auto Dst = Edge.second;
-    std::unordered_map<CallStringCTX<n_t, K>, mono_container_t> Out;
+    std::unordered_map<CallStringCTXId, mono_container_t> Out;
     llvm::outs() << "\nHandle ret flow in: "
                  << ICF->getFunctionName(ICF->getFunctionOf(Src)) << '\n';
     llvm::outs() << "Src: " << NToString(Src) << '\n';
     llvm::outs() << "Dst: " << NToString(Dst) << '\n';
     for (auto &[Ctx, Facts] : Analysis[Src]) {
-      auto CTXRm(Ctx);
-      CTXRm.print(llvm::outs() << "CTXRm: ") << '\n';
+      auto CTXRm = Ctx;
+      Contexts.get(Ctx).print(llvm::outs() << "CTXRm: ") << '\n';
       // we need to use several call- and retsites if the context is empty
       llvm::SmallVector<n_t> CallSites;
 
       // handle empty context
-      if (Ctx.empty()) {
+      if (Contexts.empty(Ctx)) {
         const auto &Callers = ICF->getCallersOf(ICF->getFunctionOf(Src));
         CallSites.append(Callers.begin(), Callers.end());
       } else {
         // handle context containing at least one element
-        CallSites.push_back(CTXRm.pop_back());
+        CallSites.push_back(Contexts.get(Ctx).back());
+        CTXRm = Contexts.pop(Ctx);
       }
 
       std::set<n_t> RetSites;
@@ -381,6 +541,12 @@ public:
 
   mono_container_t getResultsAt(n_t Stmt) {
     mono_container_t Result;
+    if (isSkipped(Stmt)) {
+      for (auto &[Ctx, Facts] : getContextMapAt(Stmt)) {
+        Result.insert(Facts.begin(), Facts.end());
+      }
+      return Result;
+    }
     for (auto &[Ctx, Facts] : Analysis[Stmt]) {
       Result.insert(Facts.begin(), Facts.end());
     }
@@ -389,14 +555,14 @@ public:
 
   virtual void dumpResults(llvm::raw_ostream &OS = llvm::outs()) {
     OS << "======= DUMP LLVM-INTER-MONOTONE-SOLVER RESULTS =======\n";
-    for (auto &[Node, ContextMap] : this->Analysis) {
+    auto DumpNode = [&](n_t Node, const auto &ContextMap) {
       OS << "Instruction:\n" << NToString(Node);
       OS << "\nFacts:\n";
       if (ContextMap.empty()) {
         OS << "\tEMPTY\n";
       } else {
         for (auto &[Context, FlowFacts] : ContextMap) {
-          Context.print(OS) << '\n';
+          Contexts.get(Context).print(OS) << '\n';
           if (FlowFacts.empty()) {
             OS << "\tEMPTY\n";
           } else {
@@ -405,6 +571,12 @@ public:
         }
       }
       OS << '\n';
+    };
+    for (auto &[Node, ContextMap] : this->Analysis) {
+      DumpNode(Node, ContextMap);
+    }
+    for (auto Node : SkippedNodes) {
+      DumpNode(Node, getContextMapAt(Node));
     }
   }
 
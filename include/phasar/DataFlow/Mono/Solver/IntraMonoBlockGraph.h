@@ -0,0 +1,267 @@
+/******************************************************************************
+ * Copyright (c) 2024 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_DATAFLOW_MONO_SOLVER_INTRAMONOBLOCKGRAPH_H
+#define PHASAR_DATAFLOW_MONO_SOLVER_INTRAMONOBLOCKGRAPH_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/SmallVector.h"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/// The control-flow graph of one or more functions, condensed to basic
+/// blocks, i.e., maximal chains of instructions with exactly one predecessor
+/// and one successor each.
+///
+/// The graph is computed solely from the control-flow edges that are reported
+/// by the CFG, such that it does not depend on how the CFG handles
+/// debug-intrinsics, etc. The blocks are numbered in reverse post-order (RPO)
+/// starting from the blocks without predecessor, such that forward data-flow
+/// solvers can use the block-ids directly as worklist priorities.
+template <typename N> class IntraMonoBlockGraph {
+public:
+  using n_t = N;
+  using block_id_t = uint32_t;
+
+  IntraMonoBlockGraph() noexcept = default;
+
+  /// Adds all instructions and control-flow edges of Fun to the graph. Call
+  /// finalize() after adding all functions.
+  template <typename CFGTy, typename FunTy>
+  void addFunction(const CFGTy &CFG, const FunTy &Fun) {
+    for (const auto &Inst : CFG.getAllInstructionsOf(Fun)) {
+      getOrCreateNode(Inst);
+    }
+    for (const auto &[From, To] : CFG.getAllControlFlowEdges(Fun)) {
+      auto FromId = getOrCreateNode(From);
+      auto ToId = getOrCreateNode(To);
+      NodeSuccs[FromId].push_back(ToId);
+      NodePreds[ToId].push_back(FromId);
+    }
+  }
+
+  /// Partitions the instructions into blocks and orders them in RPO
+  void finalize();
+
+  [[nodiscard]] size_t getNumBlocks() const noexcept { return Blocks.size(); }
+  [[nodiscard]] size_t getNumNodes() const noexcept { return Nodes.size(); }
+
+  /// The instructions of the given block in control-flow order
+  [[nodiscard]] llvm::ArrayRef<n_t> getInstructions(block_id_t Blk) const {
+    const auto &B = Blocks[Blk];
+    return llvm::makeArrayRef(BlockInsts).slice(B.InstsBegin,
+                                                B.InstsEnd - B.InstsBegin);
+  }
+  [[nodiscard]] llvm::ArrayRef<block_id_t> getPreds(block_id_t Blk) const {
+    return Blocks[Blk].Preds;
+  }
+  [[nodiscard]] llvm::ArrayRef<block_id_t> getSuccs(block_id_t Blk) const {
+    return Blocks[Blk].Succs;
+  }
+
+  /// The block containing Inst together with the position of Inst inside that
+  /// block, if Inst is part of this graph
+  [[nodiscard]] std::optional<std::pair<block_id_t, uint32_t>>
+  getBlockOf(const n_t &Inst) const {
+    auto It = NodeIds.find(Inst);
+    if (It == NodeIds.end()) {
+      return std::nullopt;
+    }
+    return std::make_pair(NodeBlock[It->second], NodePosInBlock[It->second]);
+  }
+
+private:
+  struct Block {
+    uint32_t InstsBegin{};
+    uint32_t InstsEnd{};
+    llvm::SmallVector<block_id_t, 2> Preds{};
+    llvm::SmallVector<block_id_t, 2> Succs{};
+  };
+
+  uint32_t getOrCreateNode(const n_t &Inst) {
+    auto [It, Inserted] = NodeIds.try_emplace(Inst, Nodes.size());
+    if (Inserted) {
+      Nodes.push_back(Inst);
+      NodeSuccs.emplace_back();
+      NodePreds.emplace_back();
+    }
+    return It->second;
+  }
+
+  [[nodiscard]] bool isLeader(uint32_t Node) const {
+    const auto &Preds = NodePreds[Node];
+    return Preds.size() != 1 || NodeSuccs[Preds.front()].size() != 1 ||
+           Preds.front() == Node;
+  }
+
+  std::vector<n_t> Nodes;
+  std::unordered_map<n_t, uint32_t> NodeIds;
+  std::vector<llvm::SmallVector<uint32_t, 2>> NodeSuccs;
+  std::vector<llvm::SmallVector<uint32_t, 2>> NodePreds;
+
+  std::vector<block_id_t> NodeBlock;
+  std::vector<uint32_t> NodePosInBlock;
+  std::vector<n_t> BlockInsts;
+  std::vector<Block> Blocks;
+};
+
+template <typename N> void IntraMonoBlockGraph<N>::finalize() {
+  static constexpr auto None = ~block_id_t(0);
+
+  // Step 1: Cut the instructions into chains. Every instruction that is not a
+  // leader is placed behind its unique predecessor.
+  std::vector<std::vector<uint32_t>> Chains;
+  std::vector<block_id_t> ChainOf(Nodes.size(), None);
+
+  auto BuildChain = [&](uint32_t Leader) {
+    auto ChainId = block_id_t(Chains.size());
+    auto &Chain = Chains.emplace_back();
+    auto Curr = Leader;
+    while (true) {
+      Chain.push_back(Curr);
+      ChainOf[Curr] = ChainId;
+      if (NodeSuccs[Curr].size() != 1) {
+        break;
+      }
+      auto Next = NodeSuccs[Curr].front();
+      if (ChainOf[Next] != None || isLeader(Next)) {
+        break;
+      }
+      Curr = Next;
+    }
+  };
+
+  for (uint32_t Node = 0, End = Nodes.size(); Node != End; ++Node) {
+    if (ChainOf[Node] == None && isLeader(Node)) {
+      BuildChain(Node);
+    }
+  }
+  // Isolated cycles of straight-line instructions do not have a leader
+  for (uint32_t Node = 0, End = Nodes.size(); Node != End; ++Node) {
+    if (ChainOf[Node] == None) {
+      BuildChain(Node);
+    }
+  }
+
+  // Step 2: Order the chains in RPO, beginning with the ones without
+  // predecessor
+  auto NumChains = Chains.size();
+  std::vector<block_id_t> PostOrder;
+  PostOrder.reserve(NumChains);
+  llvm::BitVector Seen(NumChains);
+
+  auto ChainSuccs = [&](block_id_t Chain) -> auto & {
+    return NodeSuccs[Chains[Chain].back()];
+  };
+
+  auto Dfs = [&](block_id_t Root) {
+    llvm::SmallVector<std::pair<block_id_t, uint32_t>, 16> Stack;
+    Stack.emplace_back(Root, 0);
+    Seen.set(Root);
+    while (!Stack.empty()) {
+      auto &[Chain, SuccIdx] = Stack.back();
+      const auto &Succs = ChainSuccs(Chain);
+      if (SuccIdx < Succs.size()) {
+        auto Succ = ChainOf[Succs[SuccIdx++]];
+        if (!Seen.test(Succ)) {
+          Seen.set(Succ);
+          Stack.emplace_back(Succ, 0);
+        }
+        continue;
+      }
+      PostOrder.push_back(Chain);
+      Stack.pop_back();
+    }
+  };
+
+  for (block_id_t Chain = 0; Chain != NumChains; ++Chain) {
+    if (NodePreds[Chains[Chain].front()].empty()) {
+      Dfs(Chain);
+    }
+  }
+  // Unreachable cycles
+  for (block_id_t Chain = 0; Chain != NumChains; ++Chain) {
+    if (!Seen.test(Chain)) {
+      Dfs(Chain);
+    }
+  }
+
+  // Step 3: Materialize the blocks in RPO
+  std::vector<block_id_t> BlockOfChain(NumChains);
+  for (size_t I = 0; I != NumChains; ++I) {
+    BlockOfChain[PostOrder[NumChains - I - 1]] = block_id_t(I);
+  }
+
+  Blocks.clear();
+  Blocks.resize(NumChains);
+  BlockInsts.clear();
+  BlockInsts.reserve(Nodes.size());
+  NodeBlock.assign(Nodes.size(), None);
+  NodePosInBlock.assign(Nodes.size(), 0);
+
+  for (size_t I = 0; I != NumChains; ++I) {
+    auto Chain = PostOrder[NumChains - I - 1];
+    auto &Blk = Blocks[I];
+    Blk.InstsBegin = BlockInsts.size();
+    uint32_t Pos = 0;
+    for (auto Node : Chains[Chain]) {
+      BlockInsts.push_back(Nodes[Node]);
+      NodeBlock[Node] = block_id_t(I);
+      NodePosInBlock[Node] = Pos++;
+    }
+    Blk.InstsEnd = BlockInsts.size();
+
+    for (auto Pred : NodePreds[Chains[Chain].front()]) {
+      Blk.Preds.push_back(BlockOfChain[ChainOf[Pred]]);
+    }
+    for (auto Succ : ChainSuccs(Chain)) {
+      Blk.Succs.push_back(BlockOfChain[ChainOf[Succ]]);
+    }
+  }
+}
+
+/// A worklist of basic blocks that always pops the block with the smallest
+/// RPO-number first and that does not contain duplicates
+class IntraMonoBlockWorklist {
+public:
+  explicit IntraMonoBlockWorklist(size_t NumBlocks) : Contained(NumBlocks) {}
+
+  void push(uint32_t Blk) {
+    if (!Contained.test(Blk)) {
+      Contained.set(Blk);
+      Queue.push(Blk);
+    }
+  }
+
+  [[nodiscard]] uint32_t pop() {
+    auto Blk = Queue.top();
+    Queue.pop();
+    Contained.reset(Blk);
+    return Blk;
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return Queue.empty(); }
+
+private:
+  std::priority_queue<uint32_t, std::vector<uint32_t>, std::greater<>> Queue;
+  llvm::BitVector Contained;
+};
+
+} // namespace psr
+
+#endif // PHASAR_DATAFLOW_MONO_SOLVER_INTRAMONOBLOCKGRAPH_H
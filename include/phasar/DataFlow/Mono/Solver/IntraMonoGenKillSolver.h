@@ -0,0 +1,282 @@
+/******************************************************************************
+ * Copyright (c) 2024 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#ifndef PHASAR_DATAFLOW_MONO_SOLVER_INTRAMONOGENKILLSOLVER_H
+#define PHASAR_DATAFLOW_MONO_SOLVER_INTRAMONOGENKILLSOLVER_H
+
+#include "phasar/DataFlow/Mono/IntraMonoGenKillProblem.h"
+#include "phasar/DataFlow/Mono/Solver/IntraMonoBlockGraph.h"
+#include "phasar/Utils/Logger.h"
+#include "phasar/Utils/Printer.h"
+
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/// Solves an IntraMonoGenKillProblem on dense bit-vectors.
+///
+/// All data-flow facts that are ever generated are numbered up front, such that
+/// merge, equality-check and transfer reduce to word-wise bit operations. The
+/// gen/kill sets of all instructions of a basic block are composed into a
+/// single gen/kill pair before the fixpoint iteration, so each visit of a block
+/// costs only a constant number of bit-vector operations independent of the
+/// block's length.
+///
+/// The results are equal to the ones of the IntraMonoSolver for the same
+/// problem.
+template <typename AnalysisDomainTy> class IntraMonoGenKillSolver {
+public:
+  using ProblemTy = IntraMonoGenKillProblem<AnalysisDomainTy>;
+  using n_t = typename AnalysisDomainTy::n_t;
+  using d_t = typename AnalysisDomainTy::d_t;
+  using f_t = typename AnalysisDomainTy::f_t;
+  using c_t = typename AnalysisDomainTy::c_t;
+  using mono_container_t = typename AnalysisDomainTy::mono_container_t;
+
+  IntraMonoGenKillSolver(ProblemTy &IMP) : IMProblem(IMP), CFG(IMP.getCFG()) {}
+
+  void solve() {
+    initialize();
+
+    auto NumBlocks = Blocks.getNumBlocks();
+    IntraMonoBlockWorklist Worklist(NumBlocks);
+    for (uint32_t Blk = 0; Blk != NumBlocks; ++Blk) {
+      Worklist.push(Blk);
+    }
+
+    bool IsMust = IMProblem.isMustAnalysis();
+    llvm::BitVector In;
+    llvm::BitVector Out;
+    while (!Worklist.empty()) {
+      auto Blk = Worklist.pop();
+      auto Preds = Blocks.getPreds(Blk);
+      if (!Preds.empty()) {
+        In = BlockOut[Preds.front()];
+        for (auto Pred : Preds.drop_front()) {
+          if (IsMust) {
+            In &= BlockOut[Pred];
+          } else {
+            In |= BlockOut[Pred];
+          }
+        }
+        if (In == BlockIn[Blk]) {
+          continue;
+        }
+        std::swap(BlockIn[Blk], In);
+      }
+
+      Out = BlockIn[Blk];
+      applySummary(Blk, Out);
+      if (Out != BlockOut[Blk]) {
+        std::swap(BlockOut[Blk], Out);
+        for (auto Succ : Blocks.getSuccs(Blk)) {
+          Worklist.push(Succ);
+        }
+      }
+    }
+  }
+
+  /// Returns the data-flow facts that hold right after Stmt (MFP_out)
+  [[nodiscard]] mono_container_t getResultsAt(n_t Stmt) {
+    auto BlkAndPos = Blocks.getBlockOf(Stmt);
+    if (!BlkAndPos) {
+      return mono_container_t{};
+    }
+    auto [Blk, Pos] = *BlkAndPos;
+    auto Facts = BlockIn[Blk];
+    for (const auto &Inst : Blocks.getInstructions(Blk).take_front(Pos + 1)) {
+      applySeeds(Inst, Facts);
+      applyInstruction(Inst, Facts);
+    }
+    return toContainer(Facts);
+  }
+
+  void dumpResults(llvm::raw_ostream &OS = llvm::outs()) {
+    OS << "Intra-Monotone gen/kill solver results:\n"
+          "---------------------------------------\n";
+    for (uint32_t Blk = 0, End = Blocks.getNumBlocks(); Blk != End; ++Blk) {
+      auto Facts = BlockIn[Blk];
+      for (const auto &Node : Blocks.getInstructions(Blk)) {
+        applySeeds(Node, Facts);
+        applyInstruction(Node, Facts);
+        OS << "Instruction:\n" << NToString(Node);
+        OS << "\nFacts:\n";
+        if (Facts.none()) {
+          OS << "\tEMPTY\n";
+        } else {
+          IMProblem.printContainer(OS, toContainer(Facts));
+        }
+        OS << "\n\n";
+      }
+    }
+  }
+
+  /// The number of distinct data-flow facts, i.e., the width of the
+  /// bit-vectors
+  [[nodiscard]] size_t getNumFacts() const noexcept { return Facts.size(); }
+
+private:
+  uint32_t getOrCreateFactId(const d_t &Fact) {
+    auto [It, Inserted] = FactIds.try_emplace(Fact, Facts.size());
+    if (Inserted) {
+      Facts.push_back(Fact);
+    }
+    return It->second;
+  }
+
+  [[nodiscard]] llvm::BitVector toBits(const mono_container_t &Cont) const {
+    llvm::BitVector Ret(Facts.size());
+    for (const auto &Fact : Cont) {
+      Ret.set(FactIds.at(Fact));
+    }
+    return Ret;
+  }
+
+  [[nodiscard]] mono_container_t toContainer(const llvm::BitVector &Bits) const {
+    mono_container_t Ret;
+    for (auto Idx : Bits.set_bits()) {
+      Ret.insert(Facts[Idx]);
+    }
+    return Ret;
+  }
+
+  void applySummary(uint32_t Blk, llvm::BitVector &Bits) const {
+    Bits.reset(BlockKill[Blk]);
+    Bits |= BlockGen[Blk];
+  }
+
+  void applySeeds(n_t Inst, llvm::BitVector &Bits) const {
+    if (auto It = SeedBits.find(Inst); It != SeedBits.end()) {
+      Bits |= It->second;
+    }
+  }
+
+  void applyInstruction(n_t Inst, llvm::BitVector &Bits) {
+    llvm::SmallVector<d_t, 4> Gen;
+    llvm::SmallVector<d_t, 4> Kill;
+    IMProblem.genKill(Inst, Gen, Kill);
+    for (const auto &Fact : Kill) {
+      if (auto It = FactIds.find(Fact); It != FactIds.end()) {
+        Bits.reset(It->second);
+      }
+    }
+    for (const auto &Fact : Gen) {
+      Bits.set(FactIds.at(Fact));
+    }
+  }
+
+  void initialize() {
+    for (const auto &EntryPoint : IMProblem.getEntryPoints()) {
+      auto Function =
+          IMProblem.getProjectIRDB()->getFunctionDefinition(EntryPoint);
+      Blocks.addFunction(*CFG, Function);
+    }
+    Blocks.finalize();
+    auto NumBlocks = Blocks.getNumBlocks();
+
+    // Number all facts that can ever be present
+    auto Top = IMProblem.allTop();
+    for (const auto &Fact : Top) {
+      getOrCreateFactId(Fact);
+    }
+    auto Seeds = IMProblem.initialSeeds();
+    for (const auto &[Node, SeedFacts] : Seeds) {
+      for (const auto &Fact : SeedFacts) {
+        getOrCreateFactId(Fact);
+      }
+    }
+
+    std::vector<llvm::SmallVector<uint32_t, 4>> InstGen;
+    std::vector<llvm::SmallVector<d_t, 4>> InstKill;
+    InstGen.reserve(Blocks.getNumNodes());
+    InstKill.reserve(Blocks.getNumNodes());
+    for (uint32_t Blk = 0; Blk != NumBlocks; ++Blk) {
+      for (const auto &Inst : Blocks.getInstructions(Blk)) {
+        llvm::SmallVector<d_t, 4> Gen;
+        auto &Kill = InstKill.emplace_back();
+        IMProblem.genKill(Inst, Gen, Kill);
+        auto &GenIds = InstGen.emplace_back();
+        for (const auto &Fact : Gen) {
+          GenIds.push_back(getOrCreateFactId(Fact));
+        }
+      }
+    }
+
+    // The seeds are joined into the IN-set of their instruction, wherever it
+    // is located within its block
+    SeedBits.clear();
+    for (const auto &[Node, SeedFacts] : Seeds) {
+      if (Blocks.getBlockOf(Node)) {
+        SeedBits.try_emplace(Node, toBits(SeedFacts));
+      } else {
+        PHASAR_LOG_LEVEL(WARNING, "Ignoring seed at instruction outside of the "
+                                  "analyzed functions: "
+                                      << NToString(Node));
+      }
+    }
+
+    // Summarize the blocks: After each instruction, K' = K ∪ K_i and
+    // G' = ((G ∪ S_i) \ K_i) ∪ G_i, where S_i are the seeds of the instruction
+    auto NumFacts = Facts.size();
+    BlockGen.assign(NumBlocks, llvm::BitVector(NumFacts));
+    BlockKill.assign(NumBlocks, llvm::BitVector(NumFacts));
+    size_t InstIdx = 0;
+    for (uint32_t Blk = 0; Blk != NumBlocks; ++Blk) {
+      auto &Gen = BlockGen[Blk];
+      auto &Kill = BlockKill[Blk];
+      for (const auto &Inst : Blocks.getInstructions(Blk)) {
+        applySeeds(Inst, Gen);
+        for (const auto &Fact : InstKill[InstIdx]) {
+          if (auto It = FactIds.find(Fact); It != FactIds.end()) {
+            Kill.set(It->second);
+            Gen.reset(It->second);
+          }
+        }
+        for (auto Id : InstGen[InstIdx]) {
+          Gen.set(Id);
+        }
+        ++InstIdx;
+      }
+    }
+
+    BlockIn.assign(NumBlocks, toBits(Top));
+    BlockOut = BlockIn;
+    for (uint32_t Blk = 0; Blk != NumBlocks; ++Blk) {
+      applySummary(Blk, BlockOut[Blk]);
+    }
+  }
+
+  ProblemTy &IMProblem;
+  const CFGBase<c_t> *CFG;
+  IntraMonoBlockGraph<n_t> Blocks;
+
+  std::vector<d_t> Facts;
+  std::unordered_map<d_t, uint32_t> FactIds;
+
+  std::unordered_map<n_t, llvm::BitVector> SeedBits;
+  std::vector<llvm::BitVector> BlockGen;
+  std::vector<llvm::BitVector> BlockKill;
+  std::vector<llvm::BitVector> BlockIn;
+  std::vector<llvm::BitVector> BlockOut;
+};
+
+template <typename Problem>
+IntraMonoGenKillSolver(Problem &)
+    -> IntraMonoGenKillSolver<typename Problem::ProblemAnalysisDomain>;
+
+} // namespace psr
+
+#endif // PHASAR_DATAFLOW_MONO_SOLVER_INTRAMONOGENKILLSOLVER_H
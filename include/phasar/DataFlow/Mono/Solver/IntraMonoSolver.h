@@ -18,15 +18,27 @@
 #define PHASAR_DATAFLOW_MONO_SOLVER_INTRAMONOSOLVER_H
 
 #include "phasar/DataFlow/Mono/IntraMonoProblem.h"
+#include "phasar/DataFlow/Mono/Solver/IntraMonoBlockGraph.h"
 #include "phasar/Utils/BitVectorSet.h"
+#include "phasar/Utils/Logger.h"
 
-#include <deque>
+#include "llvm/ADT/BitVector.h"
+
+#include <cstdint>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace psr {
 
+/// Solves an IntraMonoProblem using the classic worklist algorithm.
+///
+/// The solver operates on basic blocks rather than on individual
+/// control-flow edges: Only the IN-set of each block is stored and the facts
+/// inside a block are recomputed on demand. The worklist always selects the
+/// block with the smallest reverse post-order number first, such that, for
+/// reducible CFGs, every block is usually visited only once per loop
+/// iteration.
 template <typename AnalysisDomainTy> class IntraMonoSolver {
 public:
   using ProblemTy = IntraMonoProblem<AnalysisDomainTy>;
@@ -41,88 +53,136 @@ public:
 
 protected:
   ProblemTy &IMProblem;
-  std::deque<std::pair<n_t, n_t>> Worklist;
-  std::unordered_map<n_t, mono_container_t> Analysis;
   const CFGBase<c_t> *CFG;
+  IntraMonoBlockGraph<n_t> Blocks;
+  std::vector<mono_container_t> BlockIn;
+  std::vector<mono_container_t> BlockOut;
+  std::unordered_map<n_t, mono_container_t> Seeds;
+  /// The blocks that contain at least one seeded instruction
+  llvm::BitVector SeededBlocks;
 
   void initialize() {
-    const auto &EntryPoints = IMProblem.getEntryPoints();
-    for (const auto &EntryPoint : EntryPoints) {
+    for (const auto &EntryPoint : IMProblem.getEntryPoints()) {
       auto Function =
           IMProblem.getProjectIRDB()->getFunctionDefinition(EntryPoint);
-      auto ControlFlowEdges = CFG->getAllControlFlowEdges(Function);
-      // add all intra-procedural edges to the worklist
-      Worklist.insert(Worklist.begin(), ControlFlowEdges.begin(),
-                      ControlFlowEdges.end());
-      // set all analysis information to the empty set
-      for (auto Insts : CFG->getAllInstructionsOf(Function)) {
-        Analysis.insert(std::make_pair(Insts, IMProblem.allTop()));
+      Blocks.addFunction(*CFG, Function);
+    }
+    Blocks.finalize();
+
+    auto NumBlocks = Blocks.getNumBlocks();
+    BlockIn.assign(NumBlocks, IMProblem.allTop());
+
+    // The initial seeds are joined into the IN-set of their instruction
+    // whenever the block containing it is transferred, such that they take
+    // effect at any position, not only at the beginning of a function
+    Seeds = IMProblem.initialSeeds();
+    SeededBlocks.clear();
+    SeededBlocks.resize(NumBlocks);
+    for (const auto &[Node, FlowFacts] : Seeds) {
+      if (auto BlkAndPos = Blocks.getBlockOf(Node)) {
+        SeededBlocks.set(BlkAndPos->first);
+      } else {
+        PHASAR_LOG_LEVEL(WARNING, "Ignoring seed at instruction outside of the "
+                                  "analyzed functions: "
+                                      << NToString(Node));
       }
     }
-    // insert initial seeds
-    for (auto &[Node, FlowFacts] : IMProblem.initialSeeds()) {
-      Analysis[Node].insert(FlowFacts.begin(), FlowFacts.end());
+
+    BlockOut.clear();
+    BlockOut.reserve(NumBlocks);
+    for (uint32_t Blk = 0; Blk != NumBlocks; ++Blk) {
+      BlockOut.push_back(
+          transfer(Blk, Blocks.getInstructions(Blk), BlockIn[Blk]));
+    }
+  }
+
+  /// Joins the seeds of Inst (if any) into In
+  void addSeeds(n_t Inst, mono_container_t &In) const {
+    if (auto It = Seeds.find(Inst); It != Seeds.end()) {
+      In.insert(It->second.begin(), It->second.end());
     }
   }
 
+  /// Applies the flow-functions of all instructions in Insts, which must be a
+  /// prefix of block Blk, to In
+  mono_container_t transfer(uint32_t Blk, llvm::ArrayRef<n_t> Insts,
+                            mono_container_t In) {
+    bool HasSeeds = SeededBlocks.test(Blk);
+    for (const auto &Inst : Insts) {
+      if (HasSeeds) {
+        addSeeds(Inst, In);
+      }
+      In = IMProblem.normalFlow(Inst, In);
+    }
+    return In;
+  }
+
 public:
   IntraMonoSolver(ProblemTy &IMP) : IMProblem(IMP), CFG(IMP.getCFG()) {}
 
   virtual ~IntraMonoSolver() = default;
 
   virtual void solve() {
-    // step 1: Initalization (of Worklist and Analysis)
+    // step 1: Initalization (of Blocks, Worklist and Analysis)
     initialize();
+    auto NumBlocks = Blocks.getNumBlocks();
+    IntraMonoBlockWorklist Worklist(NumBlocks);
+    for (uint32_t Blk = 0; Blk != NumBlocks; ++Blk) {
+      Worklist.push(Blk);
+    }
     // step 2: Iteration (updating Worklist and Analysis)
     while (!Worklist.empty()) {
-      // llvm::outs() << "worklist size: " << Worklist.size() << "\n";
-      std::pair<n_t, n_t> Edge = Worklist.front();
-      Worklist.pop_front();
-      n_t Src = Edge.first;
-      n_t Dst = Edge.second;
-      auto Out = IMProblem.normalFlow(Src, Analysis[Src]);
-      // need to merge if Dst is a branch target
-      if (CFG->isBranchTarget(Src, Dst)) {
-        for (auto Pred : CFG->getPredsOf(Dst)) {
-          if (Pred != Src) {
-            // we need to compute the out set of Pred and merge it with the out
-            // set of Src on-the-fly as we do not have a dedicated storage for
-            // merge points (otherwise we run into trouble with merge operator
-            // such as set union)
-            auto OtherPredOut = IMProblem.normalFlow(Pred, Analysis[Pred]);
-            Out = IMProblem.merge(Out, OtherPredOut);
-          }
+      auto Blk = Worklist.pop();
+      auto Preds = Blocks.getPreds(Blk);
+      if (!Preds.empty()) {
+        auto In = BlockOut[Preds.front()];
+        for (auto Pred : Preds.drop_front()) {
+          In = IMProblem.merge(In, BlockOut[Pred]);
+        }
+        if (IMProblem.equal_to(In, BlockIn[Blk])) {
+          continue;
         }
+        BlockIn[Blk] = std::move(In);
       }
-      if (!IMProblem.equal_to(Out, Analysis[Dst])) {
-        Analysis[Dst] = Out;
-        for (auto Nprimeprime : CFG->getSuccsOf(Dst)) {
-          Worklist.push_back({Dst, Nprimeprime});
+
+      auto Out = transfer(Blk, Blocks.getInstructions(Blk), BlockIn[Blk]);
+      if (!IMProblem.equal_to(Out, BlockOut[Blk])) {
+        BlockOut[Blk] = std::move(Out);
+        for (auto Succ : Blocks.getSuccs(Blk)) {
+          Worklist.push(Succ);
         }
       }
     }
-    // step 3: Presenting the result (MFP_in and MFP_out)
-    // MFP_in[s] = Analysis[s];
-    // MFP out[s] = IMProblem.flow(Analysis[s]);
-    for (auto &[Node, FlowFacts] : Analysis) {
-      FlowFacts = IMProblem.normalFlow(Node, FlowFacts);
-    }
   }
 
-  mono_container_t getResultsAt(n_t Stmt) { return Analysis[Stmt]; }
+  /// Returns the data-flow facts that hold right after Stmt (MFP_out)
+  mono_container_t getResultsAt(n_t Stmt) {
+    auto BlkAndPos = Blocks.getBlockOf(Stmt);
+    if (!BlkAndPos) {
+      return mono_container_t{};
+    }
+    auto [Blk, Pos] = *BlkAndPos;
+    return transfer(Blk, Blocks.getInstructions(Blk).take_front(Pos + 1),
+                    BlockIn[Blk]);
+  }
 
   virtual void dumpResults(llvm::raw_ostream &OS = llvm::outs()) {
     OS << "Intra-Monotone solver results:\n"
           "------------------------------\n";
-    for (auto &[Node, FlowFacts] : this->Analysis) {
-      OS << "Instruction:\n" << NToString(Node);
-      OS << "\nFacts:\n";
-      if (FlowFacts.empty()) {
-        OS << "\tEMPTY\n";
-      } else {
-        IMProblem.printContainer(OS, FlowFacts);
+    for (uint32_t Blk = 0, End = Blocks.getNumBlocks(); Blk != End; ++Blk) {
+      auto FlowFacts = BlockIn[Blk];
+      for (const auto &Node : Blocks.getInstructions(Blk)) {
+        addSeeds(Node, FlowFacts);
+        FlowFacts = IMProblem.normalFlow(Node, FlowFacts);
+        OS << "Instruction:\n" << NToString(Node);
+        OS << "\nFacts:\n";
+        if (FlowFacts.empty()) {
+          OS << "\tEMPTY\n";
+        } else {
+          IMProblem.printContainer(OS, FlowFacts);
+        }
+        OS << "\n\n";
       }
-      OS << "\n\n";
     }
   }
 
@@ -17,21 +17,31 @@
 #include "phasar/Utils/StableVector.h"
 #include "phasar/Utils/Utilities.h"
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/DenseMapInfo.h"
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/Sequence.h"
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/TinyPtrVector.h"
 #include "llvm/ADT/iterator_range.h"
 #include "llvm/IR/Instructions.h"
+#include "llvm/Support/Alignment.h"
 #include "llvm/Support/Casting.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Support/raw_os_ostream.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <set>
@@ -49,10 +59,19 @@ namespace psr {
 /// Not all covered instructions of a BasicBlock might be present; however, it
 /// is guaranteed that for each BasicBlock covered by the analysis there is at
 /// least one node in the ExplicitESG containing an instruction from that BB.
+///
+/// Nodes are identified by 32-bit ids. While the ESG is being built, only the
+/// few nodes with more than one predecessor store their additional
+/// predecessors ("neighbors") in a side-table. finalize() compacts these into
+/// a CSR-style array and spillTo() additionally moves all node arrays into a
+/// memory-mapped file, such that the OS can page them out. The ESG can be
+/// extended after finalize() or spillTo(), which transparently copies the
+/// data back into memory.
 template <typename AnalysisDomainTy> class ExplodedSuperGraph {
 public:
   using n_t = typename AnalysisDomainTy::n_t;
   using d_t = typename AnalysisDomainTy::d_t;
+  using node_id_t = uint32_t;
 
   struct Node {
     static constexpr size_t NoPredId = ~size_t(0);
@@ -63,11 +82,6 @@ public:
     n_t Source{};
   };
 
-  struct NodeAdj {
-    size_t PredecessorIdx = Node::NoPredId;
-    llvm::SmallVector<size_t, 0> Neighbors{};
-  };
-
   class BuildNodeRef;
   class NodeRef {
     friend ExplodedSuperGraph;
@@ -79,44 +93,46 @@ public:
 
     [[nodiscard]] ByConstRef<d_t> value() const noexcept {
       assert(*this);
-      return Owner->NodeDataOwner[NodeId].Value;
+      return Owner->getNodeData()[NodeId].Value;
     }
 
     [[nodiscard]] ByConstRef<n_t> source() const noexcept {
       assert(*this);
-      return Owner->NodeDataOwner[NodeId].Source;
+      return Owner->getNodeData()[NodeId].Source;
     }
 
     [[nodiscard]] NodeRef predecessor() const noexcept {
       assert(*this);
-      auto PredId = Owner->NodeAdjOwner[NodeId].PredecessorIdx;
-      return PredId == Node::NoPredId ? NodeRef() : NodeRef(PredId, Owner);
+      auto PredId = Owner->getPredecessors()[NodeId];
+      return PredId == NoNodeId ? NodeRef() : NodeRef(PredId, Owner);
     }
 
     [[nodiscard]] bool hasNeighbors() const noexcept {
       assert(*this);
-      return !Owner->NodeAdjOwner[NodeId].Neighbors.empty();
+      return !Owner->getNeighbors(NodeId).empty();
     }
 
     [[nodiscard]] bool getNumNeighbors() const noexcept {
       assert(*this);
-      return Owner->NodeAdjOwner[NodeId].Neighbors.size();
+      return Owner->getNeighbors(NodeId).size();
     }
 
     [[nodiscard]] auto neighbors() const noexcept {
       assert(*this);
 
-      return llvm::map_range(Owner->NodeAdjOwner[NodeId].Neighbors,
-                             [Owner{Owner}](size_t NBIdx) {
-                               assert(NBIdx != Node::NoPredId);
+      return llvm::map_range(Owner->getNeighbors(NodeId),
+                             [Owner{Owner}](node_id_t NBIdx) {
+                               assert(NBIdx != NoNodeId);
                                return NodeRef(NBIdx, Owner);
                              });
     }
 
-    [[nodiscard]] size_t id() const noexcept { return NodeId; }
+    [[nodiscard]] size_t id() const noexcept {
+      return NodeId == NoNodeId ? Node::NoPredId : size_t(NodeId);
+    }
 
     explicit operator bool() const noexcept {
-      return Owner != nullptr && NodeId != Node::NoPredId;
+      return Owner != nullptr && NodeId != NoNodeId;
     }
 
     [[nodiscard]] friend bool operator==(NodeRef L, NodeRef R) noexcept {
@@ -139,13 +155,16 @@ public:
 
   private:
     explicit NodeRef(size_t NodeId, const ExplodedSuperGraph *Owner) noexcept
-        : NodeId(NodeId), Owner(Owner) {}
+        : NodeId(NodeId == Node::NoPredId ? NoNodeId : node_id_t(NodeId)),
+          Owner(Owner) {}
 
-    size_t NodeId = Node::NoPredId;
+    node_id_t NodeId = NoNodeId;
     const ExplodedSuperGraph *Owner{};
   };
 
   class BuildNodeRef {
+    friend ExplodedSuperGraph;
+
   public:
     [[nodiscard]] NodeRef operator()(size_t NodeId) const noexcept {
       return NodeRef(NodeId, Owner);
@@ -162,7 +181,26 @@ public:
       std::is_nothrow_move_constructible_v<d_t>)
       : ZeroValue(std::move(ZeroValue)) {}
 
-  explicit ExplodedSuperGraph(const ExplodedSuperGraph &) = default;
+  /// Copies share the memory-mapped spill-file, if any
+  explicit ExplodedSuperGraph(const ExplodedSuperGraph &Other)
+      : NodeDataOwner(Other.NodeDataOwner), Predecessors(Other.Predecessors),
+        PendingNeighbors(Other.PendingNeighbors),
+        NeighborOffsets(Other.NeighborOffsets), NeighborIds(Other.NeighborIds),
+        DataView(Other.DataView), PredView(Other.PredView),
+        OffsetsView(Other.OffsetsView), NeighborsView(Other.NeighborsView),
+        Spill(Other.Spill), Finalized(Other.Finalized),
+        FlowFactVertexMap(Other.FlowFactVertexMap),
+        ZeroValue(Other.ZeroValue) {
+    // Views into Other's vectors must refer to our own copies instead
+    if (Finalized && !Spill) {
+      PredView = Predecessors;
+      OffsetsView = NeighborOffsets;
+      NeighborsView = NeighborIds;
+    }
+    if (Finalized && !NodeDataOwner.empty()) {
+      DataView = NodeDataOwner;
+    }
+  }
   ExplodedSuperGraph &operator=(const ExplodedSuperGraph &) = delete;
 
   ExplodedSuperGraph(ExplodedSuperGraph &&) noexcept = default;
@@ -180,8 +218,7 @@ public:
   }
 
   [[nodiscard]] NodeRef fromNodeId(size_t NodeId) const noexcept {
-    assert(NodeDataOwner.size() == NodeAdjOwner.size());
-    assert(NodeId < NodeDataOwner.size());
+    assert(NodeId < size());
 
     return NodeRef(NodeId, this);
   }
@@ -193,6 +230,10 @@ public:
   template <typename Container>
   void saveEdges(n_t Curr, d_t CurrNode, n_t Succ, const Container &SuccNodes,
                  ESGEdgeKind Kind) {
+    if (LLVM_UNLIKELY(Finalized)) {
+      reopen();
+    }
+
     auto PredId = getNodeIdOrNull(Curr, std::move(CurrNode));
 
     /// The Identity CTR-flow on the zero-value has no meaning at all regarding
@@ -203,37 +244,121 @@ public:
     }
   }
 
+  /// Compacts the neighbor-lists into a single CSR-style array and releases
+  /// all memory that was only needed while building the ESG. Call this after
+  /// the IFDS/IDE solver has finished.
+  void finalize() {
+    if (Finalized) {
+      return;
+    }
+
+    NeighborOffsets.assign(size() + 1, 0);
+    for (const auto &[Id, NBs] : PendingNeighbors) {
+      NeighborOffsets[Id + 1] = NBs.size();
+    }
+    std::partial_sum(NeighborOffsets.begin(), NeighborOffsets.end(),
+                     NeighborOffsets.begin());
+
+    NeighborIds.resize(NeighborOffsets.back());
+    for (const auto &[Id, NBs] : PendingNeighbors) {
+      std::copy(NBs.begin(), NBs.end(),
+                std::next(NeighborIds.begin(), NeighborOffsets[Id]));
+    }
+    decltype(PendingNeighbors)().swap(PendingNeighbors);
+
+    NodeDataOwner.shrink_to_fit();
+    Predecessors.shrink_to_fit();
+
+    DataView = NodeDataOwner;
+    PredView = Predecessors;
+    OffsetsView = NeighborOffsets;
+    NeighborsView = NeighborIds;
+    Finalized = true;
+  }
+
+  [[nodiscard]] bool isFinalized() const noexcept { return Finalized; }
+  [[nodiscard]] bool isSpilled() const noexcept { return Spill != nullptr; }
+
+  /// Finalizes the ESG and moves its node-arrays into the file FileName, which
+  /// is then memory-mapped read-only. The node-data (facts and instructions)
+  /// is only moved if it is trivially copyable. The FlowFactVertexMap always
+  /// stays in memory.
+  ///
+  /// The file must not be modified as long as this ESG or any copy of it is
+  /// alive; removing it is up to the caller. Spilling again to the same file
+  /// is fine: The new contents are written to a temporary file that then
+  /// replaces FileName, so existing mappings keep referring to the old data.
+  [[nodiscard]] std::error_code spillTo(const llvm::Twine &FileName) {
+    finalize();
+
+    SpillLayout Layout;
+    llvm::SmallString<256> TmpFileName;
+    if (auto EC = writeSpillFile(FileName, TmpFileName, Layout)) {
+      return EC;
+    }
+    if (auto EC = llvm::sys::fs::rename(TmpFileName, FileName)) {
+      llvm::sys::fs::remove(TmpFileName);
+      return EC;
+    }
+
+    int FD = -1;
+    if (auto EC = llvm::sys::fs::openFileForRead(FileName, FD)) {
+      return EC;
+    }
+    std::error_code EC;
+    auto Region = std::make_shared<llvm::sys::fs::mapped_file_region>(
+        llvm::sys::fs::convertFDToNativeFile(FD),
+        llvm::sys::fs::mapped_file_region::readonly, Layout.FileSize, 0, EC);
+    llvm::sys::Process::SafelyCloseFileDescriptor(FD);
+    if (EC) {
+      return EC;
+    }
+
+    const char *Base = Region->const_data();
+    // Note: If we were already spilled, the owning vectors are empty
+    PredView = viewOf<node_id_t>(Base, Layout.PredOffset, size());
+    OffsetsView =
+        viewOf<node_id_t>(Base, Layout.OffsetsOffset, OffsetsView.size());
+    NeighborsView =
+        viewOf<node_id_t>(Base, Layout.NeighborsOffset, NeighborsView.size());
+    std::vector<node_id_t>().swap(Predecessors);
+    std::vector<node_id_t>().swap(NeighborOffsets);
+    std::vector<node_id_t>().swap(NeighborIds);
+    if constexpr (std::is_trivially_copyable_v<NodeData>) {
+      DataView = viewOf<NodeData>(Base, Layout.DataOffset, DataView.size());
+      std::vector<NodeData>().swap(NodeDataOwner);
+    }
+
+    Spill = std::move(Region);
+    return {};
+  }
+
   // NOLINTNEXTLINE(readability-identifier-naming)
   [[nodiscard]] auto node_begin() const noexcept {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
-    return llvm::map_iterator(
-        llvm::seq(size_t(0), NodeDataOwner.size()).begin(), BuildNodeRef(this));
+    return llvm::map_iterator(llvm::seq(size_t(0), size()).begin(),
+                              BuildNodeRef(this));
   }
   // NOLINTNEXTLINE(readability-identifier-naming)
   [[nodiscard]] auto node_end() const noexcept {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
-    return llvm::map_iterator(llvm::seq(size_t(0), NodeDataOwner.size()).end(),
+    return llvm::map_iterator(llvm::seq(size_t(0), size()).end(),
                               BuildNodeRef(this));
   }
   [[nodiscard]] auto nodes() const noexcept {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
-    return llvm::map_range(llvm::seq(size_t(0), NodeDataOwner.size()),
-                           BuildNodeRef(this));
+    return llvm::map_range(llvm::seq(size_t(0), size()), BuildNodeRef(this));
   }
 
   [[nodiscard]] size_t size() const noexcept {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
-    return NodeDataOwner.size();
+    assert(getNodeData().size() == getPredecessors().size());
+    return getNodeData().size();
   }
 
   /// Printing:
 
   void printAsDot(llvm::raw_ostream &OS) const {
-    assert(NodeAdjOwner.size() == NodeDataOwner.size());
     OS << "digraph ESG{\n";
     psr::scope_exit ClosingBrace = [&OS] { OS << '}'; };
 
-    for (size_t I = 0, End = NodeDataOwner.size(); I != End; ++I) {
+    for (size_t I = 0, End = size(); I != End; ++I) {
       auto Nod = NodeRef(I, this);
       OS << I << "[label=\"";
       OS.write_escaped(DToString(Nod.value())) << "\"];\n";
@@ -260,6 +385,113 @@ public:
   }
 
 private:
+  static constexpr node_id_t NoNodeId = std::numeric_limits<node_id_t>::max();
+
+  struct SpillLayout {
+    size_t PredOffset = 0;
+    size_t OffsetsOffset = 0;
+    size_t NeighborsOffset = 0;
+    size_t DataOffset = 0;
+    size_t FileSize = 0;
+  };
+
+  [[nodiscard]] llvm::ArrayRef<NodeData> getNodeData() const noexcept {
+    return Finalized ? DataView : llvm::ArrayRef<NodeData>(NodeDataOwner);
+  }
+
+  [[nodiscard]] llvm::ArrayRef<node_id_t> getPredecessors() const noexcept {
+    return Finalized ? PredView : llvm::ArrayRef<node_id_t>(Predecessors);
+  }
+
+  [[nodiscard]] llvm::ArrayRef<node_id_t>
+  getNeighbors(node_id_t Id) const noexcept {
+    if (Finalized) {
+      return NeighborsView.slice(OffsetsView[Id],
+                                 OffsetsView[Id + 1] - OffsetsView[Id]);
+    }
+    if (auto It = PendingNeighbors.find(Id); It != PendingNeighbors.end()) {
+      return It->second;
+    }
+    return {};
+  }
+
+  template <typename T>
+  [[nodiscard]] static llvm::ArrayRef<T> viewOf(const char *Base, size_t Offset,
+                                                size_t Size) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return llvm::makeArrayRef(reinterpret_cast<const T *>(Base + Offset), Size);
+  }
+
+  /// Writes the node-arrays into a fresh temporary file next to FileName and
+  /// stores its path in TmpFileName. Never truncates FileName itself, as it
+  /// may still be mapped by this ESG or a copy of it.
+  [[nodiscard]] std::error_code
+  writeSpillFile(const llvm::Twine &FileName,
+                 llvm::SmallVectorImpl<char> &TmpFileName,
+                 SpillLayout &Layout) const {
+    int FD = -1;
+    if (auto EC = llvm::sys::fs::createUniqueFile(FileName + "-%%%%%%.tmp",
+                                                  FD, TmpFileName)) {
+      return EC;
+    }
+    llvm::raw_fd_ostream OS(FD, /*shouldClose*/ true);
+
+    auto Write = [&OS](auto Arr) {
+      static constexpr size_t Alignment = 16;
+      OS.write_zeros(llvm::offsetToAlignment(OS.tell(), llvm::Align(Alignment)));
+      auto Offset = size_t(OS.tell());
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      OS.write(reinterpret_cast<const char *>(Arr.data()),
+               Arr.size() * sizeof(Arr[0]));
+      return Offset;
+    };
+
+    Layout.PredOffset = Write(PredView);
+    Layout.OffsetsOffset = Write(OffsetsView);
+    Layout.NeighborsOffset = Write(NeighborsView);
+    if constexpr (std::is_trivially_copyable_v<NodeData>) {
+      Layout.DataOffset = Write(DataView);
+    }
+    // Never map an empty file
+    OS.write_zeros(1);
+    Layout.FileSize = OS.tell();
+
+    OS.close();
+    if (auto EC = OS.error()) {
+      OS.clear_error();
+      llvm::sys::fs::remove(TmpFileName);
+      return EC;
+    }
+    return {};
+  }
+
+  /// Makes the ESG mutable again after finalize() or spillTo()
+  void reopen() {
+    assert(Finalized);
+    // Only copy, if the views refer to the spill-file
+    if (DataView.data() != NodeDataOwner.data()) {
+      NodeDataOwner.assign(DataView.begin(), DataView.end());
+    }
+    if (PredView.data() != Predecessors.data()) {
+      Predecessors.assign(PredView.begin(), PredView.end());
+    }
+    for (node_id_t Id = 0, End = Predecessors.size(); Id != End; ++Id) {
+      auto NBs = getNeighbors(Id);
+      if (!NBs.empty()) {
+        PendingNeighbors[Id].assign(NBs.begin(), NBs.end());
+      }
+    }
+
+    std::vector<node_id_t>().swap(NeighborOffsets);
+    std::vector<node_id_t>().swap(NeighborIds);
+    DataView = {};
+    PredView = {};
+    OffsetsView = {};
+    NeighborsView = {};
+    Spill = nullptr;
+    Finalized = false;
+  }
+
   struct PathInfoHash {
     size_t operator()(const std::pair<n_t, d_t> &ND) const {
       return std::hash<n_t>()(ND.first) * 31 + std::hash<d_t>()(ND.second);
@@ -273,8 +505,8 @@ private:
     }
   };
 
-  [[nodiscard]] std::optional<size_t> getNodeIdOrNull(n_t Inst,
-                                                      d_t Fact) const {
+  [[nodiscard]] std::optional<node_id_t> getNodeIdOrNull(n_t Inst,
+                                                         d_t Fact) const {
     auto It = FlowFactVertexMap.find(
         std::make_pair(std::move(Inst), std::move(Fact)));
     if (It != FlowFactVertexMap.end()) {
@@ -283,10 +515,10 @@ private:
     return std::nullopt;
   }
 
-  void saveEdge(std::optional<size_t> PredId, n_t Curr, d_t CurrNode, n_t Succ,
-                d_t SuccNode, bool MaySkipEdge) {
+  void saveEdge(std::optional<node_id_t> PredId, n_t Curr, d_t CurrNode,
+                n_t Succ, d_t SuccNode, bool MaySkipEdge) {
     auto [SuccVtxIt, Inserted] = FlowFactVertexMap.try_emplace(
-        std::make_pair(Succ, SuccNode), Node::NoPredId);
+        std::make_pair(Succ, SuccNode), NoNodeId);
 
     // Save a reference into the FlowFactVertexMap before the SuccVtxIt gets
     // invalidated
@@ -294,11 +526,15 @@ private:
 
     // NOLINTNEXTLINE(readability-identifier-naming)
     auto makeNode = [this, PredId, Curr, &CurrNode, &SuccNode]() mutable {
-      assert(NodeAdjOwner.size() == NodeDataOwner.size());
-      auto Ret = NodeDataOwner.size();
+      assert(Predecessors.size() == NodeDataOwner.size());
+      if (LLVM_UNLIKELY(NodeDataOwner.size() >= NoNodeId)) {
+        llvm::report_fatal_error(
+            "The ExplodedSuperGraph exceeds the maximum of 2^32-1 nodes");
+      }
+      auto Ret = node_id_t(NodeDataOwner.size());
 
       auto &NodData = NodeDataOwner.emplace_back();
-      auto &NodAdj = NodeAdjOwner.emplace_back();
+      auto &NodPred = Predecessors.emplace_back();
       NodData.Value = SuccNode;
 
       if (!PredId) {
@@ -307,7 +543,7 @@ private:
         FlowFactVertexMap[std::make_pair(Curr, CurrNode)] = Ret;
       }
 
-      NodAdj.PredecessorIdx = PredId.value_or(Node::NoPredId);
+      NodPred = PredId.value_or(NoNodeId);
       NodData.Source = Curr;
 
       return Ret;
@@ -319,7 +555,7 @@ private:
       assert(PredId);
       if (Inserted) {
         SuccVtxNode = makeNode();
-        NodeAdjOwner.back().PredecessorIdx = Node::NoPredId;
+        Predecessors.back() = NoNodeId;
       }
       return;
     }
@@ -349,28 +585,42 @@ private:
     // connecting with the pred. Now, we have a non-skippable edge to connect to
     NodeRef SuccVtx(SuccVtxNode, this);
     if (!SuccVtx.predecessor()) {
-      NodeAdjOwner[SuccVtxNode].PredecessorIdx =
-          PredId.value_or(Node::NoPredId);
+      Predecessors[SuccVtxNode] = PredId.value_or(NoNodeId);
       NodeDataOwner[SuccVtxNode].Source = Curr;
       return;
     }
 
     // This node has more than one predecessor; add a neighbor then
-    if (SuccVtx.predecessor().id() != PredId.value_or(Node::NoPredId) &&
-        llvm::none_of(SuccVtx.neighbors(),
-                      [Pred = PredId.value_or(Node::NoPredId)](NodeRef Nd) {
-                        return Nd.predecessor().id() == Pred;
-                      })) {
+    auto Pred = PredId ? size_t(*PredId) : Node::NoPredId;
+    if (SuccVtx.predecessor().id() != Pred &&
+        llvm::none_of(SuccVtx.neighbors(), [Pred](NodeRef Nd) {
+          return Nd.predecessor().id() == Pred;
+        })) {
 
       auto NewNode = makeNode();
-      NodeAdjOwner[SuccVtxNode].Neighbors.push_back(NewNode);
+      PendingNeighbors[SuccVtxNode].push_back(NewNode);
       return;
     }
   }
 
+  // While building:
   std::vector<NodeData> NodeDataOwner;
-  std::vector<NodeAdj> NodeAdjOwner;
-  std::unordered_map<std::pair<n_t, d_t>, size_t, PathInfoHash, PathInfoEq>
+  std::vector<node_id_t> Predecessors;
+  llvm::DenseMap<node_id_t, llvm::SmallVector<node_id_t, 2>> PendingNeighbors;
+
+  // After finalize(): The neighbors of node I are
+  // NeighborIds[NeighborOffsets[I]..NeighborOffsets[I+1]]. The views either
+  // refer to the vectors or into the spill-file
+  std::vector<node_id_t> NeighborOffsets;
+  std::vector<node_id_t> NeighborIds;
+  llvm::ArrayRef<NodeData> DataView;
+  llvm::ArrayRef<node_id_t> PredView;
+  llvm::ArrayRef<node_id_t> OffsetsView;
+  llvm::ArrayRef<node_id_t> NeighborsView;
+  std::shared_ptr<const llvm::sys::fs::mapped_file_region> Spill;
+  bool Finalized = false;
+
+  std::unordered_map<std::pair<n_t, d_t>, node_id_t, PathInfoHash, PathInfoEq>
       FlowFactVertexMap{};
 
   // ZeroValue
@@ -16,6 +16,7 @@
 #include "PhasarLLVM/Domain.h"
 #include "PhasarLLVM/HelperAnalyses.h"
 #include "PhasarLLVM/HelperAnalysisConfig.h"
+#include "PhasarLLVM/LLVMIncrementalUpdate.h"
 #include "PhasarLLVM/Passes.h"
 #include "PhasarLLVM/Pointer.h"
 #include "PhasarLLVM/SimpleAnalysisConstructor.h"
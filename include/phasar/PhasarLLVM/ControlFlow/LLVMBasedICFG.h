@@ -107,9 +107,15 @@ public:
   /// \param WithSourceCodeInfo If true, not only contains the LLVM instructions
   /// as labels, but source-code information as well (e.g. function name, line
   /// no, col no, src-line).
+  ///
+  /// For large ICFGs, prefer the streaming psr::exportICFG() from
+  /// LLVMBasedICFGExporter.h.
   [[nodiscard]] std::string
   exportICFGAsDot(bool WithSourceCodeInfo = true) const;
-  /// Similar to exportICFGAsDot, but exports the ICFG as JSON instead
+  /// Similar to exportICFGAsDot, but exports the ICFG as JSON instead.
+  ///
+  /// Builds the whole JSON document in memory. For large ICFGs, prefer the
+  /// streaming psr::exportICFG() from LLVMBasedICFGExporter.h.
   [[nodiscard]] nlohmann::json
   exportICFGAsJson(bool WithSourceCodeInfo = true) const;
 
@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_CONTROLFLOW_LLVMBASEDICFGEXPORTER_H
+#define PHASAR_PHASARLLVM_CONTROLFLOW_LLVMBASEDICFGEXPORTER_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace llvm {
+class Function;
+} // namespace llvm
+
+namespace psr {
+class LLVMBasedICFG;
+
+enum class ICFGExportFormat {
+  /// One JSON object per line: First the nodes of a function, then its edges
+  Jsonl,
+  /// A graphviz digraph
+  Dot,
+  /// A compact edge list; see readICFGBinaryEdgeList()
+  Binary,
+};
+
+enum class ICFGEdgeKind : uint8_t {
+  Intra = 0,
+  Call = 1,
+  Return = 2,
+  CallToReturn = 3,
+};
+
+[[nodiscard]] llvm::StringRef to_string(ICFGEdgeKind Kind) noexcept;
+
+struct ICFGExportOptions {
+  ICFGExportFormat Format = ICFGExportFormat::Jsonl;
+  /// Also export the source-code location and -line of each instruction.
+  /// Not used for the Binary format.
+  bool WithSourceCodeInfo = false;
+  /// If not empty, only export the functions that are transitively reachable
+  /// from these functions in the call-graph. Otherwise, exports all functions
+  /// of the ICFG.
+  std::vector<const llvm::Function *> ReachableFrom{};
+};
+
+/// Writes the ICFG incrementally to OS, one function at a time. Nodes are
+/// identified by the instruction ids of the ICFG's IRDB. Apart from the set of
+/// functions to export, no intermediate state is kept, such that the memory
+/// consumption does not depend on the size of the ICFG; the source-code
+/// information is retrieved lazily through the LLVMSourceCache.
+///
+/// JSON Lines records have the forms
+///   {"kind": "node", "id": 4, "function": "main", "ir": "...",
+///    ["file": "...", "line": 3, "column": 5, "src": "..."]}
+///   {"kind": "edge", "from": 4, "to": 5, "type": "intra", ["label": "true"]}
+///
+/// The Binary format starts with the 8-byte header "PSRICFG\1", followed by
+/// one 9-byte record per edge: The little-endian uint32 ids of the source and
+/// target instruction and the ICFGEdgeKind as uint8.
+void exportICFG(const LLVMBasedICFG &ICF, llvm::raw_ostream &OS,
+                const ICFGExportOptions &Opts = {});
+
+/// Writes the call-graph of ICF as JSON Lines to OS, one call-site per line:
+///   {"caller": "main", "cs": 4, "callees": ["foo", "bar"]}
+///
+/// If ReachableFrom is not empty, only exports the call-sites within the
+/// functions that are transitively reachable from ReachableFrom.
+void exportCallGraphAsJsonl(
+    const LLVMBasedICFG &ICF, llvm::raw_ostream &OS,
+    llvm::ArrayRef<const llvm::Function *> ReachableFrom = {});
+
+struct ICFGBinaryEdge {
+  uint32_t From{};
+  uint32_t To{};
+  ICFGEdgeKind Kind{};
+
+  friend bool operator==(const ICFGBinaryEdge &Lhs,
+                         const ICFGBinaryEdge &Rhs) noexcept {
+    return Lhs.From == Rhs.From && Lhs.To == Rhs.To && Lhs.Kind == Rhs.Kind;
+  }
+  friend bool operator!=(const ICFGBinaryEdge &Lhs,
+                         const ICFGBinaryEdge &Rhs) noexcept {
+    return !(Lhs == Rhs);
+  }
+};
+
+/// Parses an edge list that was written by exportICFG() using the Binary
+/// format. Returns std::nullopt, if Data is not a valid edge list.
+[[nodiscard]] std::optional<std::vector<ICFGBinaryEdge>>
+readICFGBinaryEdgeList(llvm::StringRef Data);
+
+} // namespace psr
+
+#endif // PHASAR_PHASARLLVM_CONTROLFLOW_LLVMBASEDICFGEXPORTER_H
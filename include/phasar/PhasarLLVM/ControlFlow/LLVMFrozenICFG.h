@@ -0,0 +1,218 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_CONTROLFLOW_LLVMFROZENICFG_H
+#define PHASAR_PHASARLLVM_CONTROLFLOW_LLVMFROZENICFG_H
+
+#include "phasar/ControlFlow/CFGBase.h"
+#include "phasar/ControlFlow/ICFGBase.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/Utils/LLVMBasedContainerConfig.h"
+#include "phasar/Utils/CompressedSparseRows.h"
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instruction.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace psr {
+class LLVMProjectIRDB;
+
+class LLVMFrozenICFG;
+template <> struct CFGTraits<LLVMFrozenICFG> : CFGTraits<LLVMBasedICFG> {};
+
+/// An immutable snapshot of an LLVMBasedICFG that answers the queries that the
+/// data-flow solvers issue in their hot loops from precomputed arrays.
+///
+/// Successors, predecessors and return-sites are stored in compressed sparse
+/// row form indexed by the instruction ids of the LLVMProjectIRDB; start- and
+/// exit points, call-sites and control-flow edges are stored per function. All
+/// of these queries return ArrayRefs without allocating.
+///
+/// The IR, the IRDB and the ICFG that this snapshot is taken from must neither
+/// be modified nor destroyed while the LLVMFrozenICFG is in use. To use it for
+/// a data-flow analysis, set the i_t of the analysis domain to LLVMFrozenICFG.
+class LLVMFrozenICFG : public CFGBase<LLVMFrozenICFG>,
+                       public ICFGBase<LLVMFrozenICFG> {
+  friend CFGBase;
+  friend ICFGBase;
+
+public:
+  using typename ICFGBase::f_t;
+  using typename ICFGBase::n_t;
+
+  explicit LLVMFrozenICFG(const LLVMBasedICFG &ICF);
+
+  LLVMFrozenICFG(const LLVMFrozenICFG &) = delete;
+  LLVMFrozenICFG &operator=(const LLVMFrozenICFG &) = delete;
+  LLVMFrozenICFG(LLVMFrozenICFG &&) noexcept = default;
+  LLVMFrozenICFG &operator=(LLVMFrozenICFG &&) noexcept = default;
+  ~LLVMFrozenICFG() = default;
+
+  /// Same as getSuccsOf(), but skips the mapping from instruction to id
+  [[nodiscard]] llvm::ArrayRef<n_t> getSuccsOfId(size_t InstId) const noexcept {
+    return Succs.lookup(InstId);
+  }
+  /// Same as getPredsOf(), but skips the mapping from instruction to id
+  [[nodiscard]] llvm::ArrayRef<n_t> getPredsOfId(size_t InstId) const noexcept {
+    return Preds.lookup(InstId);
+  }
+
+  /// The ICFG that this snapshot was taken from
+  [[nodiscard]] const LLVMBasedICFG &getUnfrozenICFG() const noexcept {
+    return *ICF;
+  }
+  [[nodiscard]] const LLVMProjectIRDB *getIRDB() const noexcept {
+    return IRDB;
+  }
+
+  [[nodiscard]] size_t getApproxSizeInBytes() const noexcept;
+
+  using CFGBase::print;
+  using ICFGBase::print;
+
+  using ICFGBase::printAsJson;
+
+  using CFGBase::getAsJson;
+  using ICFGBase::getAsJson;
+
+private:
+  // --- CFG
+
+  [[nodiscard]] f_t getFunctionOfImpl(n_t Inst) const noexcept {
+    return Inst->getFunction();
+  }
+  [[nodiscard]] llvm::ArrayRef<n_t> getPredsOfImpl(n_t Inst) const noexcept;
+  [[nodiscard]] llvm::ArrayRef<n_t> getSuccsOfImpl(n_t Inst) const noexcept;
+  [[nodiscard]] llvm::ArrayRef<std::pair<n_t, n_t>>
+  getAllControlFlowEdgesImpl(f_t Fun) const noexcept {
+    return ControlFlowEdges.lookup(getFunctionIndex(Fun));
+  }
+  [[nodiscard]] decltype(auto) getAllInstructionsOfImpl(f_t Fun) const {
+    return ICF->getAllInstructionsOf(Fun);
+  }
+  [[nodiscard]] llvm::ArrayRef<n_t>
+  getStartPointsOfImpl(f_t Fun) const noexcept {
+    return StartPoints.lookup(getFunctionIndex(Fun));
+  }
+  [[nodiscard]] llvm::ArrayRef<n_t> getExitPointsOfImpl(f_t Fun) const noexcept {
+    return ExitPoints.lookup(getFunctionIndex(Fun));
+  }
+  [[nodiscard]] bool isCallSiteImpl(n_t Inst) const noexcept {
+    return ICF->isCallSite(Inst);
+  }
+  [[nodiscard]] bool isExitInstImpl(n_t Inst) const noexcept {
+    return ICF->isExitInst(Inst);
+  }
+  [[nodiscard]] bool isStartPointImpl(n_t Inst) const noexcept {
+    return ICF->isStartPoint(Inst);
+  }
+  [[nodiscard]] bool isFieldLoadImpl(n_t Inst) const noexcept {
+    return ICF->isFieldLoad(Inst);
+  }
+  [[nodiscard]] bool isFieldStoreImpl(n_t Inst) const noexcept {
+    return ICF->isFieldStore(Inst);
+  }
+  [[nodiscard]] bool isFallThroughSuccessorImpl(n_t Inst,
+                                                n_t Succ) const noexcept {
+    return ICF->isFallThroughSuccessor(Inst, Succ);
+  }
+  [[nodiscard]] bool isBranchTargetImpl(n_t Inst, n_t Succ) const noexcept {
+    return ICF->isBranchTarget(Inst, Succ);
+  }
+  [[nodiscard]] bool isHeapAllocatingFunctionImpl(f_t Fun) const {
+    return ICF->isHeapAllocatingFunction(Fun);
+  }
+  [[nodiscard]] bool isSpecialMemberFunctionImpl(f_t Fun) const {
+    return ICF->isSpecialMemberFunction(Fun);
+  }
+  [[nodiscard]] SpecialMemberFunctionType
+  getSpecialMemberFunctionTypeImpl(f_t Fun) const {
+    return ICF->getSpecialMemberFunctionType(Fun);
+  }
+  [[nodiscard]] std::string getStatementIdImpl(n_t Inst) const {
+    return ICF->getStatementId(Inst);
+  }
+  [[nodiscard]] llvm::StringRef getFunctionNameImpl(f_t Fun) const {
+    return Fun->getName();
+  }
+  [[nodiscard]] std::string getDemangledFunctionNameImpl(f_t Fun) const {
+    return ICF->getDemangledFunctionName(Fun);
+  }
+  void printImpl(f_t Fun, llvm::raw_ostream &OS) const { ICF->print(Fun, OS); }
+  [[nodiscard]] nlohmann::json getAsJsonImpl(f_t /*Fun*/) const { return ""; }
+
+  // --- ICFG
+
+  [[nodiscard]] FunctionRange getAllFunctionsImpl() const {
+    return ICF->getAllFunctions();
+  }
+  [[nodiscard]] f_t getFunctionImpl(llvm::StringRef Fun) const {
+    return ICF->getFunction(Fun);
+  }
+  [[nodiscard]] bool isIndirectFunctionCallImpl(n_t Inst) const {
+    return ICF->isIndirectFunctionCall(Inst);
+  }
+  [[nodiscard]] bool isVirtualFunctionCallImpl(n_t Inst) const {
+    return ICF->isVirtualFunctionCall(Inst);
+  }
+  [[nodiscard]] llvm::ArrayRef<n_t> allNonCallStartNodesImpl() const noexcept {
+    return NonCallStartNodes;
+  }
+  [[nodiscard]] llvm::ArrayRef<n_t>
+  getCallsFromWithinImpl(f_t Fun) const noexcept {
+    return CallsFromWithin.lookup(getFunctionIndex(Fun));
+  }
+  /// As in the LLVMBasedICFG, the return-sites are the successors
+  [[nodiscard]] llvm::ArrayRef<n_t>
+  getReturnSitesOfCallAtImpl(n_t Inst) const noexcept {
+    return getSuccsOfImpl(Inst);
+  }
+  void printImpl(llvm::raw_ostream &OS) const { ICF->print(OS); }
+  void printAsJsonImpl(llvm::raw_ostream &OS) const { ICF->printAsJson(OS); }
+  [[nodiscard]] nlohmann::json getAsJsonImpl() const;
+  [[nodiscard]] const LLVMBasedCallGraph &getCallGraphImpl() const noexcept {
+    return ICF->getCallGraph();
+  }
+
+  /// Returns an out-of-bounds index for functions that are not part of the IRDB
+  [[nodiscard]] size_t getFunctionIndex(f_t Fun) const noexcept {
+    auto It = FunctionIndices.find(Fun);
+    return It != FunctionIndices.end() ? It->second : SIZE_MAX;
+  }
+
+  // ---
+
+  const LLVMBasedICFG *ICF{};
+  const LLVMProjectIRDB *IRDB{};
+
+  // Indexed by instruction id
+  CompressedSparseRows<n_t> Succs;
+  CompressedSparseRows<n_t> Preds;
+
+  // Indexed by FunctionIndices
+  llvm::DenseMap<f_t, uint32_t> FunctionIndices;
+  CompressedSparseRows<n_t> StartPoints;
+  CompressedSparseRows<n_t> ExitPoints;
+  CompressedSparseRows<n_t> CallsFromWithin;
+  CompressedSparseRows<std::pair<n_t, n_t>> ControlFlowEdges;
+
+  std::vector<n_t> NonCallStartNodes;
+};
+
+extern template class ICFGBase<LLVMFrozenICFG>;
+} // namespace psr
+
+#endif // PHASAR_PHASARLLVM_CONTROLFLOW_LLVMFROZENICFG_H
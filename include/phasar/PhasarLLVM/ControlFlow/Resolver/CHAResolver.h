@@ -22,6 +22,8 @@
 
 namespace llvm {
 class CallBase;
+class Function;
+class StructType;
 } // namespace llvm
 
 namespace psr {
@@ -43,7 +45,16 @@ public:
   }
 
 protected:
+  /// Returns the non-pure-virtual functions at VtableIndex in the vtables of
+  /// all subtypes of ReceiverTy. Memoized per virtual-call slot. The returned
+  /// range is invalidated by the next call to this function.
+  [[nodiscard]] llvm::ArrayRef<const llvm::Function *>
+  getCHATargets(const llvm::StructType *ReceiverTy, unsigned VtableIndex);
+
   MaybeUniquePtr<const LLVMTypeHierarchy, true> TH;
+
+private:
+  VirtualCallTargetCacheTy CHATargets;
 };
 } // namespace psr
 
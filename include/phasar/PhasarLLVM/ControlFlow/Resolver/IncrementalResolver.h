@@ -0,0 +1,70 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_CONTROLFLOW_RESOLVER_INCREMENTALRESOLVER_H_
+#define PHASAR_PHASARLLVM_CONTROLFLOW_RESOLVER_INCREMENTALRESOLVER_H_
+
+#include "phasar/PhasarLLVM/ControlFlow/Resolver/Resolver.h"
+
+#include "llvm/ADT/DenseMap.h"
+
+namespace llvm {
+class CallBase;
+} // namespace llvm
+
+namespace psr {
+
+/// Resolves indirect calls, whose targets are already known from a previous
+/// run of the call-graph construction, without asking the underlying
+/// resolver again. All other call-sites, as well as all callbacks that may
+/// update helper analyses, are forwarded to the underlying resolver.
+class IncrementalResolver final : public Resolver {
+public:
+  using KnownTargetsTy = llvm::DenseMap<const llvm::CallBase *, FunctionSetTy>;
+
+  IncrementalResolver(const LLVMProjectIRDB *IRDB,
+                      const LLVMVFTableProvider *VTP, Resolver &Fallback,
+                      KnownTargetsTy KnownTargets);
+
+  ~IncrementalResolver() override = default;
+
+  void preCall(const llvm::Instruction *Inst) override;
+
+  void handlePossibleTargets(const llvm::CallBase *CallSite,
+                             FunctionSetTy &PossibleTargets) override;
+
+  void postCall(const llvm::Instruction *Inst) override;
+
+  FunctionSetTy resolveVirtualCall(const llvm::CallBase *CallSite) override;
+
+  FunctionSetTy resolveFunctionPointer(const llvm::CallBase *CallSite) override;
+
+  void otherInst(const llvm::Instruction *Inst) override;
+
+  [[nodiscard]] std::string str() const override;
+
+  [[nodiscard]] bool
+  mutatesHelperAnalysisInformation() const noexcept override {
+    return Fallback->mutatesHelperAnalysisInformation();
+  }
+
+  /// The number of indirect call-site resolutions that were answered from
+  /// the known targets
+  [[nodiscard]] size_t getNumReusedResolutions() const noexcept {
+    return NumReused;
+  }
+
+private:
+  Resolver *Fallback;
+  KnownTargetsTy KnownTargets;
+  size_t NumReused = 0;
+};
+} // namespace psr
+
+#endif
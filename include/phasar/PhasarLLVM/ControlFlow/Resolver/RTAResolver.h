@@ -23,6 +23,7 @@
 
 namespace llvm {
 class CallBase;
+class Function;
 class StructType;
 } // namespace llvm
 
@@ -46,7 +47,13 @@ public:
 private:
   void resolveAllocatedStructTypes();
 
+  /// Returns the non-pure-virtual functions at VtableIndex in the vtables of
+  /// all allocated subtypes of ReceiverTy. Memoized per virtual-call slot.
+  [[nodiscard]] llvm::ArrayRef<const llvm::Function *>
+  getRTATargets(const llvm::StructType *ReceiverTy, unsigned VtableIndex);
+
   std::vector<const llvm::StructType *> AllocatedStructTypes;
+  VirtualCallTargetCacheTy RTATargets;
 };
 } // namespace psr
 
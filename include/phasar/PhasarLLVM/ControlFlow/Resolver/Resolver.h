@@ -19,11 +19,15 @@
 
 #include "phasar/PhasarLLVM/Pointer/LLVMAliasInfo.h"
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/SmallVector.h"
 
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 
 namespace llvm {
 class Instruction;
@@ -61,6 +65,19 @@ protected:
   getNonPureVirtualVFTEntry(const llvm::StructType *T, unsigned Idx,
                             const llvm::CallBase *CallSite);
 
+  /// Same as above, but without checking the consistency with a concrete
+  /// call-site, such that the result can be shared between call-sites.
+  const llvm::Function *getNonPureVirtualVFTEntry(const llvm::StructType *T,
+                                                  unsigned Idx);
+
+  /// A virtual-call slot: The static receiver type and the vtable index
+  using VFTSlotTy = std::pair<const llvm::StructType *, unsigned>;
+  /// Maps virtual-call slots to their deduplicated possible callees. Many
+  /// call-sites share the same slot, so the resolvers memoize the callees per
+  /// slot and only check the consistency with each call-site separately.
+  using VirtualCallTargetCacheTy =
+      llvm::DenseMap<VFTSlotTy, llvm::SmallVector<const llvm::Function *, 4>>;
+
 public:
   using FunctionSetTy = llvm::SmallDenseSet<const llvm::Function *, 4>;
 
@@ -97,6 +114,12 @@ public:
                                           const LLVMVFTableProvider *VTP,
                                           const LLVMTypeHierarchy *TH,
                                           LLVMAliasInfoRef PT = nullptr);
+
+protected:
+  /// Returns all Candidates that are consistent with CallSite
+  [[nodiscard]] static FunctionSetTy
+  getConsistentTargets(const llvm::CallBase *CallSite,
+                       llvm::ArrayRef<const llvm::Function *> Candidates);
 };
 } // namespace psr
 
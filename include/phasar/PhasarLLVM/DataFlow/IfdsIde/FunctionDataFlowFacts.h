@@ -1,7 +1,11 @@
+#pragma once
+
 #include "phasar/Utils/DefaultValue.h"
 
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/Twine.h"
+#include "llvm/Support/raw_ostream.h"
 
 #include <cstdint>
 #include <unordered_map>
@@ -17,8 +21,8 @@ struct Parameter {
 struct ReturnValue {};
 
 struct DataFlowFact {
-  DataFlowFact(Parameter Param) noexcept : Fact(Param) {}
-  DataFlowFact(ReturnValue Ret) noexcept : Fact(Ret) {}
+  constexpr DataFlowFact(Parameter Param) noexcept : Fact(Param) {}
+  constexpr DataFlowFact(ReturnValue Ret) noexcept : Fact(Ret) {}
 
   std::variant<Parameter, ReturnValue> Fact;
 };
@@ -59,6 +63,19 @@ public:
   [[nodiscard]] size_t size() const noexcept { return Fdff.size(); }
   [[nodiscard]] bool empty() const noexcept { return size() == 0; }
 
+  /// Adds the facts of all functions from Other that are not yet contained in
+  /// this
+  void mergeWith(const FunctionDataFlowFacts &Other) {
+    for (const auto &Entry : Other.Fdff) {
+      Fdff.try_emplace(Entry.getKey(), Entry.getValue());
+    }
+  }
+
+  void printAsJson(llvm::raw_ostream &OS) const;
+
+  static FunctionDataFlowFacts deserializeJson(const llvm::Twine &Path);
+  static FunctionDataFlowFacts loadJsonString(llvm::StringRef JsonAsString);
+
 private:
   [[nodiscard]] const auto &
   getDataFlowFactsOrEmpty(llvm::StringRef FuncKey) const {
@@ -1,5 +1,8 @@
+#pragma once
+
 #include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/FunctionDataFlowFacts.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/StaticFunctionDataFlowFacts.h"
 #include "phasar/Utils/DefaultValue.h"
 
 #include "llvm/IR/Argument.h"
@@ -13,6 +16,11 @@ namespace psr::library_summary {
 class LLVMFunctionDataFlowFacts;
 [[nodiscard]] LLVMFunctionDataFlowFacts
 readFromFDFF(const FunctionDataFlowFacts &Fdff, const LLVMProjectIRDB &Irdb);
+/// Only looks up the functions that are actually present in Irdb, so the
+/// cost does not depend on the size of the summary
+[[nodiscard]] LLVMFunctionDataFlowFacts
+readFromFDFF(const StaticFunctionDataFlowFacts &Fdff,
+             const LLVMProjectIRDB &Irdb);
 
 class LLVMFunctionDataFlowFacts {
 public:
@@ -39,7 +47,7 @@ public:
     addElement(Fun, Arg->getArgNo(), Out);
   }
 
-  [[nodiscard]] bool contains(const llvm::Function *Fn) {
+  [[nodiscard]] bool contains(const llvm::Function *Fn) const {
     return LLVMFdff.count(Fn);
   }
 
@@ -57,7 +65,7 @@ public:
   }
 
   [[nodiscard]] const ParamaterMappingTy &
-  getFactsForFunction(const llvm::Function *Fun) {
+  getFactsForFunction(const llvm::Function *Fun) const {
     auto Iter = LLVMFdff.find(Fun);
     if (Iter != LLVMFdff.end()) {
       return Iter->second;
@@ -65,8 +73,19 @@ public:
     return getDefaultValue<ParamaterMappingTy>();
   }
 
+  /// Adds the facts of all functions from Other that are not yet contained in
+  /// this
+  void mergeWith(const LLVMFunctionDataFlowFacts &Other) {
+    for (const auto &[Fun, Facts] : Other.LLVMFdff) {
+      LLVMFdff.try_emplace(Fun, Facts);
+    }
+  }
+
   friend LLVMFunctionDataFlowFacts
   readFromFDFF(const FunctionDataFlowFacts &Fdff, const LLVMProjectIRDB &Irdb);
+  friend LLVMFunctionDataFlowFacts
+  readFromFDFF(const StaticFunctionDataFlowFacts &Fdff,
+               const LLVMProjectIRDB &Irdb);
 
 private:
   std::unordered_map<const llvm::Function *, ParamaterMappingTy> LLVMFdff;
@@ -0,0 +1,41 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_LLVMLIBRARYSUMMARYGENERATOR_H
+#define PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_LLVMLIBRARYSUMMARYGENERATOR_H
+
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/FunctionDataFlowFacts.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMFunctionDataFlowFacts.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasInfo.h"
+
+namespace psr {
+class LLVMProjectIRDB;
+class LLVMBasedICFG;
+} // namespace psr
+
+namespace psr::library_summary {
+
+/// Computes the taint summaries of all functions that IRDB exports to other
+/// modules, such that a module linking against IRDB can be analyzed without
+/// IRDB's function bodies.
+///
+/// The summary of a function states for each parameter, which other
+/// parameters and whether the return value become tainted, if the parameter
+/// is tainted at the call-site. It follows the propagation rules of the
+/// IFDSTaintAnalysis, but is flow-insensitive within each function. Calls to
+/// functions outside of IRDB are resolved with KnownFacts, if possible, and
+/// otherwise treated as identity.
+[[nodiscard]] FunctionDataFlowFacts
+generateLibrarySummary(const LLVMProjectIRDB &IRDB, const LLVMBasedICFG &ICF,
+                       LLVMAliasInfoRef PT,
+                       const LLVMFunctionDataFlowFacts &KnownFacts);
+
+} // namespace psr::library_summary
+
+#endif // PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_LLVMLIBRARYSUMMARYGENERATOR_H
@@ -2,8 +2,11 @@
 
 namespace psr {
 namespace library_summary {
-class FunctionDataFlowFacts;
+class StaticFunctionDataFlowFacts;
 } // namespace library_summary
 
-[[nodiscard]] const library_summary::FunctionDataFlowFacts &getLibCSummary();
+/// The data-flow summary of the C standard library. The summary is a
+/// compile-time constant table, see LibCSummary.spec
+[[nodiscard]] const library_summary::StaticFunctionDataFlowFacts &
+getLibCSummary() noexcept;
 } // namespace psr
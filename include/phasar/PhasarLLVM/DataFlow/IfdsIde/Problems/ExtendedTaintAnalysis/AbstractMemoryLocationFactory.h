@@ -19,6 +19,7 @@
 #include "llvm/Support/TrailingObjects.h"
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace llvm {
@@ -64,6 +65,9 @@ private:
                                        size_t Lifetime,
                                        llvm::ArrayRef<ptrdiff_t> Offsets);
 
+    /// Frees all blocks that were allocated so far
+    void clear() noexcept;
+
   private:
     constexpr static size_t ExpectedNumAmLsPerBlock = 1024;
     constexpr static size_t MinNumPointersPerAML =
@@ -80,6 +84,18 @@ private:
   llvm::DenseMap<const llvm::Value *,
                  const detail::AbstractMemoryLocationImpl *>
       Cache;
+  /// Memoizes withOffset() per (AML, GEP) pair, such that repeatedly
+  /// propagating the same fact over the same GEP does not need to re-compute
+  /// the offsets and to re-profile the result
+  llvm::DenseMap<std::pair<const AbstractMemoryLocationImpl *,
+                           const llvm::GetElementPtrInst *>,
+                 const AbstractMemoryLocationImpl *>
+      GepCache;
+  /// Memoizes withIndirectionOf() per (AML, offset) pair for the common case
+  /// of a single indirection offset
+  llvm::DenseMap<std::pair<const AbstractMemoryLocationImpl *, ptrdiff_t>,
+                 const AbstractMemoryLocationImpl *>
+      IndirectionCache;
 
 #ifdef XTAINT_DIAGNOSTICS
   llvm::DenseSet<const detail::AbstractMemoryLocationImpl *>
@@ -130,6 +146,20 @@ public:
 
   [[nodiscard]] inline size_t size() const { return Pool.size(); }
 
+  /// The number of memoized withOffset() and withIndirectionOf() results
+  [[nodiscard]] inline size_t getNumMemoizedDerivations() const noexcept {
+    return GepCache.size() + IndirectionCache.size();
+  }
+
+  /// Destroys all AbstractMemoryLocations that were created by this factory
+  /// and releases their memory. Use this to bound the peak memory, when
+  /// analyzing multiple entry points one after another.
+  ///
+  /// \note All AbstractMemoryLocations that were created by this factory
+  /// before are dangling afterwards, so make sure, no solver refers to them
+  /// anymore. The zero-value is not affected.
+  void reset();
+
 #ifdef XTAINT_DIAGNOSTICS
   inline size_t getNumOverApproximatedFacts() const {
     return overApproximatedAMLs.size();
@@ -12,40 +12,54 @@
 
 #include "llvm/ADT/APFloat.h"
 #include "llvm/ADT/APSInt.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/IR/Constant.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/Support/raw_os_ostream.h"
 #include "llvm/Support/raw_ostream.h"
 
-#include <variant>
+#include <cstdint>
+#include <functional>
+#include <string>
 
 namespace psr::glca {
 
 enum class Ordering { Less, Greater, Equal, Incomparable };
 
+/// A single constant value tracked by the IDEGeneralizedLCA.
+///
+/// Integers of up to 64 bits and floating-point numbers are stored inline;
+/// wider integers are not tracked and represented as Top. Strings are interned
+/// in a global string pool, such that copying and comparing EdgeValues never
+/// allocates.
 class EdgeValue {
 public:
-  enum Type { Top, Integer, String, FloatingPoint };
+  enum Type : uint8_t { Top, Integer, String, FloatingPoint };
 
 private:
-  std::variant<llvm::APInt, llvm::APFloat, std::string, std::nullptr_t>
-      ValVariant = nullptr;
-  Type VariantType;
+  union {
+    /// Sign-extended to 64 bits
+    int64_t IntVal;
+    double FPVal;
+    /// Points into the global string pool
+    const char *StrData;
+  };
+  /// The bit-width for integers and the length for strings
+  uint32_t Aux = 0;
+  Type VariantType = Top;
 
 public:
   EdgeValue(const llvm::Value *Val);
-  EdgeValue(const EdgeValue &EV);
-  EdgeValue(llvm::APInt &&VI);
   EdgeValue(const llvm::APInt &VI);
-  EdgeValue(llvm::APFloat &&VF);
+  EdgeValue(const llvm::APFloat &VF);
   EdgeValue(long long VI);
   EdgeValue(int VI);
   EdgeValue(double Double);
   EdgeValue(float Float);
-  EdgeValue(std::string &&VS);
-  EdgeValue(std::nullptr_t);
-  ~EdgeValue();
+  EdgeValue(llvm::StringRef VS);
+  EdgeValue(std::nullptr_t) noexcept : IntVal(0) {}
+
   const static EdgeValue TopValue;
   [[nodiscard]] bool tryGetInt(int64_t &Res) const;
   [[nodiscard]] bool tryGetFP(double &Res) const;
@@ -59,10 +73,21 @@ public:
   [[nodiscard]] EdgeValue performBinOp(llvm::BinaryOperator::BinaryOps Op,
                                        const EdgeValue &Other) const;
   [[nodiscard]] EdgeValue typecast(Type Dest, unsigned Bits) const;
-  EdgeValue &operator=(const EdgeValue &EV);
+
+  [[nodiscard]] size_t getHashCode() const noexcept;
+
+  /// A fixed strict weak ordering on the exact values. Used to keep
+  /// EdgeValueSets sorted. For floating-point values, it is finer than the
+  /// epsilon-comparison of operator==, which is not transitive; see
+  /// EdgeValueSet::find().
+  [[nodiscard]] static bool lessThan(const EdgeValue &Lhs,
+                                     const EdgeValue &Rhs) noexcept;
 
   operator bool();
   friend bool operator==(const EdgeValue &Lhs, const EdgeValue &Rhs);
+  friend bool operator!=(const EdgeValue &Lhs, const EdgeValue &Rhs) {
+    return !(Lhs == Rhs);
+  }
 
   // binary operators
   friend EdgeValue operator+(const EdgeValue &Lhs, const EdgeValue &Rhs);
@@ -90,7 +115,16 @@ public:
     ROS << EV;
     return Ret;
   }
+
+private:
+  /// Creates an integer of the given bit-width from the lowest Bits bits of
+  /// Val
+  static EdgeValue makeInt(uint64_t Val, unsigned Bits) noexcept;
+  [[nodiscard]] llvm::StringRef getStringRef() const noexcept {
+    return {StrData, Aux};
+  }
 };
+
 class EdgeValueSet;
 using ev_t = EdgeValueSet;
 
@@ -114,22 +148,8 @@ inline std::ostream &operator<<(std::ostream &Os, const ev_t &Val) {
 namespace std {
 
 template <> struct hash<psr::glca::EdgeValue> {
-  hash() = default;
-  size_t operator()(const psr::glca::EdgeValue &Val) const {
-    auto Hash = hash<int>()(Val.getKind());
-    int64_t AsInt;
-    double AsFloat;
-    string AsString;
-    if (Val.tryGetInt(AsInt)) {
-      return hash<int64_t>()(AsInt) * 31 + Hash;
-    }
-    if (Val.tryGetFP(AsFloat)) {
-      return hash<double>()(round(AsFloat)) * 31 + Hash;
-    }
-    if (Val.tryGetString(AsString)) {
-      return hash<string>()(AsString) * 31 + Hash;
-    }
-    return Hash;
+  size_t operator()(const psr::glca::EdgeValue &Val) const noexcept {
+    return Val.getHashCode();
   }
 };
 
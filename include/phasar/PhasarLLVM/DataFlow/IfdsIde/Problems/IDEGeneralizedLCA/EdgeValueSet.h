@@ -13,31 +13,47 @@
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEGeneralizedLCA/EdgeValue.h"
 #include "phasar/Utils/JoinLattice.h"
 
+#include "llvm/ADT/SmallVector.h"
+
 #include <initializer_list>
-#include <unordered_set>
+#include <utility>
 
 namespace psr::glca {
 
+/// A set of EdgeValues, stored as sorted array w.r.t. EdgeValue::lessThan().
+///
+/// The IDEGeneralizedLCA widens sets that exceed its maximum set size to
+/// {Top}, so with the default maximum set size all sets fit into the inline
+/// storage.
 class EdgeValueSet {
-  std::unordered_set<EdgeValue> Underlying;
+public:
+  /// The default maximum set size of the IDEGeneralizedLCA
+  static constexpr unsigned InlineCapacity = 2;
+
+  using iterator = const EdgeValue *;
+  using const_iterator = const EdgeValue *;
+
+private:
+  llvm::SmallVector<EdgeValue, InlineCapacity> Underlying;
 
 public:
   EdgeValueSet();
-  template <typename Iter>
-  EdgeValueSet(Iter Begin, Iter End) : Underlying(Begin, End) {}
+  template <typename Iter> EdgeValueSet(Iter Begin, Iter End) {
+    for (; Begin != End; ++Begin) {
+      insert(*Begin);
+    }
+  }
   EdgeValueSet(std::initializer_list<EdgeValue> IList);
-  auto begin() -> decltype(Underlying.begin());
-  auto end() -> decltype(Underlying.end());
-  auto begin() const -> decltype(Underlying.begin());
-  auto end() const -> decltype(Underlying.end());
-  int count(const EdgeValue &EV) const;
-  auto find(const EdgeValue &EV) -> decltype(Underlying.find(EV));
-  auto find(const EdgeValue &EV) const -> decltype(Underlying.find(EV));
-
-  size_t size() const;
-  auto insert(const EdgeValue &EV) -> decltype(Underlying.insert(EV));
-  auto insert(EdgeValue &&EV) -> decltype(Underlying.insert(EV));
-  bool empty() const;
+  [[nodiscard]] const_iterator begin() const noexcept {
+    return Underlying.begin();
+  }
+  [[nodiscard]] const_iterator end() const noexcept { return Underlying.end(); }
+  [[nodiscard]] int count(const EdgeValue &EV) const;
+  [[nodiscard]] const_iterator find(const EdgeValue &EV) const;
+
+  [[nodiscard]] size_t size() const noexcept { return Underlying.size(); }
+  std::pair<const_iterator, bool> insert(const EdgeValue &EV);
+  [[nodiscard]] bool empty() const noexcept { return Underlying.empty(); }
   bool operator==(const EdgeValueSet &Other) const;
   bool operator!=(const EdgeValueSet &Other) const;
 };
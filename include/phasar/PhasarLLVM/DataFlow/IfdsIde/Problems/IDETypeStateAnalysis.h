@@ -17,6 +17,7 @@
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedCFG.h"
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMFlowFunctions.h"
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMZeroValue.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/TypeStateDescriptions/TypeStateDescription.h"
 #include "phasar/PhasarLLVM/Domain/LLVMAnalysisDomain.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMAliasInfo.h"
 #include "phasar/PhasarLLVM/Utils/DataFlowAnalysisType.h"
@@ -26,8 +27,9 @@
 #include "phasar/Utils/Printer.h"
 #include "phasar/Utils/TypeTraits.h"
 
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringRef.h"
-#include "llvm/Demangle/Demangle.h"
 #include "llvm/IR/Function.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/Instructions.h"
@@ -61,7 +63,8 @@ public:
   virtual ~IDETypeStateAnalysisBase() = default;
 
 protected:
-  IDETypeStateAnalysisBase(LLVMAliasInfoRef PT) noexcept : PT(PT) {}
+  IDETypeStateAnalysisBase(LLVMAliasInfoRef PT,
+                           const TypeStateDescriptionBase *TSD);
 
   using typename IDETypeStateAnalysisBaseCommon::container_type;
   using typename IDETypeStateAnalysisBaseCommon::d_t;
@@ -69,6 +72,19 @@ protected:
   using typename IDETypeStateAnalysisBaseCommon::FlowFunctionPtrType;
   using typename IDETypeStateAnalysisBaseCommon::n_t;
 
+  using TokenTy = TypeStateDescriptionBase::TokenTy;
+
+  /// Everything the type-state description knows about a function. Computed
+  /// once per function, such that the flow- and edge functions neither need to
+  /// demangle function names nor look them up in the description.
+  struct TSFunctionInfo {
+    llvm::SmallVector<int, 2> ConsumerParamIdx{};
+    TokenTy Token = TypeStateDescriptionBase::NonAPIToken;
+    bool IsAPIFunction = false;
+    bool IsFactoryFunction = false;
+    bool IsConsumingFunction = false;
+  };
+
   // --- Flow Functions
 
   FlowFunctionPtrType getNormalFlowFunction(n_t Curr, n_t Succ);
@@ -81,12 +97,13 @@ protected:
 
   // --- Utilities
 
-  [[nodiscard]] virtual bool
-  isAPIFunction(llvm::StringRef Name) const noexcept = 0;
-  [[nodiscard]] virtual bool
-  isFactoryFunction(llvm::StringRef Name) const noexcept = 0;
-  [[nodiscard]] virtual bool
-  isTypeNameOfInterest(llvm::StringRef Name) const noexcept = 0;
+  /**
+   * @brief Returns what the type-state description says about F.
+   *
+   * The returned reference is invalidated by subsequent calls to
+   * getFunctionInfo().
+   */
+  const TSFunctionInfo &getFunctionInfo(const llvm::Function *F);
 
   /**
    * @brief Returns all alloca's that are (indirect) aliases of V.
@@ -132,10 +149,14 @@ private:
 
   bool hasMatchingTypeName(const llvm::Type *Ty);
 
-  std::map<const llvm::Value *, LLVMAliasInfo::AliasSetTy> AliasCache;
+  const TypeStateDescriptionBase *TSD{};
+  std::string TypeNameOfInterest;
   LLVMAliasInfoRef PT{};
-  std::map<const llvm::Value *, std::set<const llvm::Value *>>
-      RelevantAllocaCache;
+
+  llvm::DenseMap<const llvm::Function *, TSFunctionInfo> FunctionInfos;
+  llvm::DenseMap<const llvm::Type *, bool> MatchingTypeNameCache;
+  llvm::DenseMap<const llvm::Value *, LLVMAliasInfo::AliasSetPtrTy> AliasCache;
+  llvm::DenseMap<const llvm::Value *, container_type> RelevantAllocaCache;
 };
 } // namespace detail
 
@@ -220,9 +241,7 @@ private:
   struct TSEdgeFunction {
     using l_t = l_t;
     const TypeStateDescriptionTy *TSD{};
-    // XXX: Do we really need a string here? Can't we just use an integer or sth
-    // else that is cheap?
-    std::string Token;
+    TokenTy Token{};
     const llvm::CallBase *CallSite{};
 
     [[nodiscard]] l_t computeTarget(l_t Source) const {
@@ -230,7 +249,7 @@ private:
       // assert((Source != TSD->top()) && "Error: call computeTarget with
       // TOP\n");
 
-      auto CurrentState = TSD->getNextState(
+      auto CurrentState = TSD->getNextStateOfToken(
           Token, Source == TSD->top() ? TSD->uninit() : Source, CallSite);
       PHASAR_LOG_LEVEL(DEBUG, "State machine transition: ("
                                   << Token << " , " << LToString(Source)
@@ -349,7 +368,7 @@ public:
                        const TypeStateDescriptionTy *TSD,
                        std::vector<std::string> EntryPoints = {"main"})
       : IDETabProblemType(IRDB, std::move(EntryPoints), createZeroValue()),
-        IDETypeStateAnalysisBase(PT), TSD(TSD) {
+        IDETypeStateAnalysisBase(PT, TSD), TSD(TSD) {
     assert(TSD != nullptr);
     assert(PT);
   }
@@ -434,28 +453,29 @@ public:
                            llvm::ArrayRef<f_t> Callees) override {
     const auto *CS = llvm::cast<llvm::CallBase>(CallSite);
     for (const auto *Callee : Callees) {
-      std::string DemangledFname = llvm::demangle(Callee->getName().str());
+      // Copy, as getWMAliasesAndAllocas() must not invalidate it
+      const auto Info = getFunctionInfo(Callee);
 
       // For now we assume that we can only generate from the return value.
       // We apply the same edge function for the return value, i.e. callsite.
-      if (TSD->isFactoryFunction(DemangledFname)) {
+      if (Info.IsFactoryFunction) {
         PHASAR_LOG_LEVEL(DEBUG, "Processing factory function");
         if (isZeroValue(CallNode) && RetSiteNode == CS) {
           return TSConstant{
-              TSD->getNextState(DemangledFname, TSD->uninit(), CS), TSD};
+              TSD->getNextStateOfToken(Info.Token, TSD->uninit(), CS), TSD};
         }
       }
 
       // For every consuming parameter and all its aliases and relevant alloca's
       // we apply the same edge function.
-      if (TSD->isConsumingFunction(DemangledFname)) {
+      if (Info.IsConsumingFunction) {
         PHASAR_LOG_LEVEL(DEBUG, "Processing consuming function");
-        for (auto Idx : TSD->getConsumerParamIdx(DemangledFname)) {
+        for (auto Idx : Info.ConsumerParamIdx) {
           const auto &AliasAndAllocas =
               getWMAliasesAndAllocas(CS->getArgOperand(Idx));
 
           if (CallNode == RetSiteNode && AliasAndAllocas.count(CallNode)) {
-            return TSEdgeFunction{TSD, DemangledFname, CS};
+            return TSEdgeFunction{TSD, Info.Token, CS};
           }
         }
       }
@@ -502,18 +522,16 @@ public:
     }
   }
 
-  [[nodiscard]] bool
-  isAPIFunction(llvm::StringRef Name) const noexcept override {
+  [[nodiscard]] bool isAPIFunction(llvm::StringRef Name) const noexcept {
     return TSD->isAPIFunction(Name);
   }
 
-  [[nodiscard]] bool
-  isFactoryFunction(llvm::StringRef Name) const noexcept override {
+  [[nodiscard]] bool isFactoryFunction(llvm::StringRef Name) const noexcept {
     return TSD->isFactoryFunction(Name);
   }
 
   [[nodiscard]] bool
-  isTypeNameOfInterest(llvm::StringRef Name) const noexcept override {
+  isTypeNameOfInterest(llvm::StringRef Name) const noexcept {
     return Name.contains(TSD->getTypeNameOfInterest());
   }
 
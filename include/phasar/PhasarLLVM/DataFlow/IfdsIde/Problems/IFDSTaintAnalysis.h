@@ -52,11 +52,16 @@ public:
    * @param icfg
    * @param TSF
    * @param EntryPoints
+   * @param ModuleSummaries Summaries of functions that are declared in IRDB,
+   * but defined in other modules, see generateLibrarySummary(). They take
+   * precedence over the summary of the C standard library.
    */
-  IFDSTaintAnalysis(const LLVMProjectIRDB *IRDB, LLVMAliasInfoRef PT,
-                    const LLVMTaintConfig *Config,
-                    std::vector<std::string> EntryPoints = {"main"},
-                    bool TaintMainArgs = true);
+  IFDSTaintAnalysis(
+      const LLVMProjectIRDB *IRDB, LLVMAliasInfoRef PT,
+      const LLVMTaintConfig *Config,
+      std::vector<std::string> EntryPoints = {"main"},
+      bool TaintMainArgs = true,
+      const library_summary::FunctionDataFlowFacts *ModuleSummaries = nullptr);
 
   ~IFDSTaintAnalysis() override = default;
 
@@ -76,6 +81,8 @@ public:
 
   InitialSeeds<n_t, d_t, l_t> initialSeeds() override;
 
+  [[nodiscard]] bool isIrrelevantStmt(n_t Stmt) const override;
+
   [[nodiscard]] d_t createZeroValue() const;
 
   bool isZeroValue(d_t FlowFact) const noexcept override;
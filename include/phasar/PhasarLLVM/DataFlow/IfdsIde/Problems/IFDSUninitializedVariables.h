@@ -58,6 +58,8 @@ public:
 
   InitialSeeds<n_t, d_t, l_t> initialSeeds() override;
 
+  [[nodiscard]] bool isIrrelevantStmt(n_t Stmt) const override;
+
   [[nodiscard]] d_t createZeroValue() const;
 
   [[nodiscard]] bool isZeroValue(d_t Fact) const noexcept override;
@@ -92,6 +92,10 @@ public:
   [[nodiscard]] State
   getNextState(llvm::StringRef Tok, State S,
                const llvm::CallBase *CallSite) const override;
+  [[nodiscard]] TokenTy getToken(llvm::StringRef F) const override;
+  [[nodiscard]] State
+  getNextStateOfToken(TokenTy Tok, State S,
+                      const llvm::CallBase *CallSite) const override;
   [[nodiscard]] std::string getTypeNameOfInterest() const override;
   [[nodiscard]] std::set<int>
   getConsumerParamIdx(llvm::StringRef F) const override;
@@ -68,6 +68,12 @@ public:
   getNextState(llvm::StringRef Tok,
                TypeStateDescription::State S) const override;
 
+  [[nodiscard]] TokenTy getToken(llvm::StringRef F) const override;
+
+  [[nodiscard]] TypeStateDescription::State
+  getNextStateOfToken(TokenTy Tok, TypeStateDescription::State S,
+                      const llvm::CallBase *CallSite) const override;
+
   [[nodiscard]] std::string getTypeNameOfInterest() const override;
 
   [[nodiscard]] std::set<int>
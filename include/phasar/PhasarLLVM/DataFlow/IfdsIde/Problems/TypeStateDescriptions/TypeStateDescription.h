@@ -12,14 +12,25 @@
 
 #include "phasar/PhasarLLVM/Utils/DataFlowAnalysisType.h"
 
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
 #include "llvm/IR/InstrTypes.h"
 
+#include <cassert>
+#include <cstdint>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace psr {
 
 struct TypeStateDescriptionBase {
+  /// Small integer that identifies an API function within a type-state
+  /// description. Used as row-index into the description's transition table.
+  using TokenTy = uint32_t;
+  /// Token for functions that do not belong to the API of interest
+  static constexpr TokenTy NonAPIToken = UINT32_MAX;
+
   virtual ~TypeStateDescriptionBase() = default;
 
   [[nodiscard]] virtual bool isFactoryFunction(llvm::StringRef F) const = 0;
@@ -31,6 +42,34 @@ struct TypeStateDescriptionBase {
   [[nodiscard]] virtual std::set<int>
   getFactoryParamIdx(llvm::StringRef F) const = 0;
   [[nodiscard]] virtual DataFlowAnalysisType analysisType() const = 0;
+
+  /// Maps the (demangled) name of a function to its token. The analysis calls
+  /// this at most once per function, so all subsequent state transitions can
+  /// be computed without any string processing.
+  ///
+  /// The default implementation interns F and is only meant as a fallback for
+  /// descriptions that only implement the string-based getNextState(). When
+  /// overriding getToken(), also override
+  /// TypeStateDescription::getNextStateOfToken().
+  [[nodiscard]] virtual TokenTy getToken(llvm::StringRef F) const {
+    auto [It, Inserted] =
+        InternedTokens.try_emplace(F, TokenTy(TokenNames.size()));
+    if (Inserted) {
+      TokenNames.push_back(It->first());
+    }
+    return It->second;
+  }
+
+protected:
+  /// Inverse of the default implementation of getToken()
+  [[nodiscard]] llvm::StringRef getInternedTokenName(TokenTy Tok) const {
+    assert(Tok < TokenNames.size() && "Token was not created by getToken()");
+    return TokenNames[Tok];
+  }
+
+private:
+  mutable llvm::StringMap<TokenTy> InternedTokens;
+  mutable std::vector<llvm::StringRef> TokenNames;
 };
 
 /**
@@ -65,6 +104,17 @@ struct TypeStateDescription : public TypeStateDescriptionBase {
     return getNextState(Tok, S);
   }
 
+  /**
+   * @brief Same as getNextState(), but for a token that was obtained from
+   * getToken(). This is what the IDETypeStateAnalysis uses in its edge
+   * functions.
+   */
+  [[nodiscard]] virtual State
+  getNextStateOfToken(TokenTy Tok, State S,
+                      const llvm::CallBase *CallSite) const {
+    return getNextState(getInternedTokenName(Tok), S, CallSite);
+  }
+
   [[nodiscard]] virtual State bottom() const = 0;
   [[nodiscard]] virtual State top() const = 0;
 
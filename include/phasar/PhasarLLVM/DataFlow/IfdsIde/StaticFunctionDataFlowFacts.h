@@ -0,0 +1,125 @@
+#ifndef PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_STATICFUNCTIONDATAFLOWFACTS_H
+#define PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_STATICFUNCTIONDATAFLOWFACTS_H
+
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/FunctionDataFlowFacts.h"
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+
+#include <cstdint>
+#include <string_view>
+
+namespace psr::library_summary {
+
+/// The data-flow facts of one parameter of a summarized function. The facts
+/// are the range [FactsBegin, FactsEnd) in the fact-table of the owning
+/// StaticFunctionDataFlowFacts
+struct StaticParameterFacts {
+  uint32_t Index{};
+  uint32_t FactsBegin{};
+  uint32_t FactsEnd{};
+};
+
+/// A summarized function. Its parameters are the range [ParamsBegin,
+/// ParamsEnd) in the parameter-table of the owning StaticFunctionDataFlowFacts
+struct StaticFunctionSummary {
+  llvm::StringLiteral Name;
+  uint32_t ParamsBegin{};
+  uint32_t ParamsEnd{};
+};
+
+/// A read-only library summary that can be fully evaluated at compile-time.
+///
+/// In contrast to FunctionDataFlowFacts, no hash-map needs to be populated at
+/// startup. The function-table is indexed by a minimal perfect hash
+/// (hash-and-displace) over the function names, such that a lookup costs two
+/// hash computations and one string comparison.
+///
+/// The tables are not meant to be written by hand; use
+/// utils/phasar-gen-library-summary.py to generate them from a summary spec.
+class StaticFunctionDataFlowFacts {
+public:
+  constexpr StaticFunctionDataFlowFacts(
+      llvm::ArrayRef<StaticFunctionSummary> Functions,
+      llvm::ArrayRef<int32_t> Displacements,
+      llvm::ArrayRef<StaticParameterFacts> Params,
+      llvm::ArrayRef<DataFlowFact> Facts) noexcept
+      : Functions(Functions), Displacements(Displacements), Params(Params),
+        Facts(Facts) {}
+
+  /// The hash function used for building the perfect hash. Must be kept in
+  /// sync with psr_hash() in utils/phasar-gen-library-summary.py
+  [[nodiscard]] static constexpr uint32_t hash(std::string_view Name,
+                                               uint32_t Seed) noexcept {
+    uint32_t Hash = 2166136261U ^ (Seed * 0x9E3779B9U);
+    for (char C : Name) {
+      Hash ^= uint8_t(C);
+      Hash *= 16777619U;
+    }
+    Hash ^= Hash >> 16;
+    Hash *= 0x85EBCA6BU;
+    Hash ^= Hash >> 13;
+    Hash *= 0xC2B2AE35U;
+    Hash ^= Hash >> 16;
+    return Hash;
+  }
+
+  /// Finds the summary of the function with the given name. Returns nullptr,
+  /// if there is no such summary
+  [[nodiscard]] const StaticFunctionSummary *
+  find(llvm::StringRef FuncKey) const noexcept {
+    if (Functions.empty()) {
+      return nullptr;
+    }
+
+    auto Disp = Displacements[hash(FuncKey, 0) % Displacements.size()];
+    size_t Slot = Disp < 0 ? size_t(-int64_t(Disp) - 1)
+                           : hash(FuncKey, uint32_t(Disp)) % Functions.size();
+
+    const auto &Fun = Functions[Slot];
+    return Fun.Name == FuncKey ? &Fun : nullptr;
+  }
+
+  [[nodiscard]] bool contains(llvm::StringRef FuncKey) const noexcept {
+    return find(FuncKey) != nullptr;
+  }
+
+  [[nodiscard]] llvm::ArrayRef<StaticParameterFacts>
+  getParameters(const StaticFunctionSummary &Fun) const noexcept {
+    return Params.slice(Fun.ParamsBegin, Fun.ParamsEnd - Fun.ParamsBegin);
+  }
+
+  [[nodiscard]] llvm::ArrayRef<DataFlowFact>
+  getDataFlowFacts(const StaticParameterFacts &Param) const noexcept {
+    return Facts.slice(Param.FactsBegin, Param.FactsEnd - Param.FactsBegin);
+  }
+
+  /// Get outset for a function and the parameter index
+  [[nodiscard]] llvm::ArrayRef<DataFlowFact>
+  getDataFlowFacts(llvm::StringRef FuncKey, uint32_t Index) const noexcept {
+    if (const auto *Fun = find(FuncKey)) {
+      for (const auto &Param : getParameters(*Fun)) {
+        if (Param.Index == Index) {
+          return getDataFlowFacts(Param);
+        }
+      }
+    }
+    return {};
+  }
+
+  [[nodiscard]] auto begin() const noexcept { return Functions.begin(); }
+  [[nodiscard]] auto end() const noexcept { return Functions.end(); }
+
+  [[nodiscard]] size_t size() const noexcept { return Functions.size(); }
+  [[nodiscard]] bool empty() const noexcept { return Functions.empty(); }
+
+private:
+  llvm::ArrayRef<StaticFunctionSummary> Functions;
+  llvm::ArrayRef<int32_t> Displacements;
+  llvm::ArrayRef<StaticParameterFacts> Params;
+  llvm::ArrayRef<DataFlowFact> Facts;
+};
+
+} // namespace psr::library_summary
+
+#endif // PHASAR_PHASARLLVM_DATAFLOW_IFDSIDE_STATICFUNCTIONDATAFLOWFACTS_H
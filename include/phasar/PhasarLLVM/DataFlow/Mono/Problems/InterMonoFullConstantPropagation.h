@@ -57,6 +57,8 @@ public:
 
   mono_container_t normalFlow(n_t Inst, const mono_container_t &In) override;
 
+  bool isIdentityNormalFlow(n_t Inst) override;
+
   mono_container_t callFlow(n_t CallSite, f_t Callee,
                             const mono_container_t &In) override;
 
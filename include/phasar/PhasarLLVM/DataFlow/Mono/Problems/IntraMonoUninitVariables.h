@@ -10,7 +10,7 @@
 #ifndef PHASAR_PHASARLLVM_DATAFLOW_MONO_PROBLEMS_INTRAMONOUNINITVARIABLES_H
 #define PHASAR_PHASARLLVM_DATAFLOW_MONO_PROBLEMS_INTRAMONOUNINITVARIABLES_H
 
-#include "phasar/DataFlow/Mono/IntraMonoProblem.h"
+#include "phasar/DataFlow/Mono/IntraMonoGenKillProblem.h"
 #include "phasar/PhasarLLVM/Domain/LLVMAnalysisDomain.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMAliasInfo.h"
 
@@ -37,7 +37,7 @@ struct IntraMonoUninitVariablesDomain : LLVMAnalysisDomainDefault {
 };
 
 class IntraMonoUninitVariables
-    : public IntraMonoProblem<IntraMonoUninitVariablesDomain> {
+    : public IntraMonoGenKillProblem<IntraMonoUninitVariablesDomain> {
 public:
   using n_t = IntraMonoUninitVariablesDomain::n_t;
   using d_t = IntraMonoUninitVariablesDomain::d_t;
@@ -54,16 +54,13 @@ public:
 
   ~IntraMonoUninitVariables() override = default;
 
-  mono_container_t merge(const mono_container_t &Lhs,
-                         const mono_container_t &Rhs) override;
+  void genKill(n_t Inst, llvm::SmallVectorImpl<d_t> &Gen,
+               llvm::SmallVectorImpl<d_t> &Kill) override;
 
-  bool equal_to(const mono_container_t &Lhs,
-                const mono_container_t &Rhs) override;
+  [[nodiscard]] bool isMustAnalysis() const override { return true; }
 
   mono_container_t allTop() override;
 
-  mono_container_t normalFlow(n_t Inst, const mono_container_t &In) override;
-
   std::unordered_map<n_t, mono_container_t> initialSeeds() override;
 };
 
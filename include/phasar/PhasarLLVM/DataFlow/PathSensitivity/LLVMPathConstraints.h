@@ -10,13 +10,17 @@
 #ifndef PHASAR_PHASARLLVM_PATHSENSITIVITY_LLVMPATHCONSTRAINTS_H
 #define PHASAR_PHASARLLVM_PATHSENSITIVITY_LLVMPATHCONSTRAINTS_H
 
+#include "phasar/PhasarLLVM/DataFlow/PathSensitivity/Z3ConstraintSolver.h"
 #include "phasar/Utils/MaybeUniquePtr.h"
 
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/SmallVector.h"
 
 #include "z3++.h"
 
 #include <optional>
+#include <unordered_map>
+#include <utility>
 
 namespace llvm {
 class Value;
@@ -45,6 +49,11 @@ public:
   z3::context &getContext() noexcept { return *Z3Ctx; }
   const z3::context &getContext() const noexcept { return *Z3Ctx; }
 
+  /// The caching constraint-solver that is shared by all path-queries using
+  /// this LLVMPathConstraints object
+  Z3ConstraintSolver &getSolver() noexcept { return Solver; }
+  const Z3ConstraintSolver &getSolver() const noexcept { return Solver; }
+
   std::optional<z3::expr> getConstraintFromEdge(const llvm::Instruction *Curr,
                                                 const llvm::Instruction *Succ);
 
@@ -89,7 +98,13 @@ private:
   friend class LoopGuardCheck;
 
   MaybeUniquePtr<z3::context> Z3Ctx;
+  Z3ConstraintSolver Solver;
   std::unordered_map<const llvm::Value *, ConstraintAndVariables> Z3Expr;
+  /// The constraints of all control-flow edges queried so far; the variables
+  /// are already deduplicated
+  llvm::DenseMap<std::pair<const llvm::Instruction *, const llvm::Instruction *>,
+                 std::optional<ConstraintAndVariables>>
+      EdgeConstraints;
   bool IgnoreDebugInstructions;
 };
 } // namespace psr
@@ -13,12 +13,15 @@
 #include "phasar/DataFlow/PathSensitivity/FlowPath.h"
 #include "phasar/DataFlow/PathSensitivity/PathSensitivityManagerBase.h"
 #include "phasar/DataFlow/PathSensitivity/PathSensitivityManagerMixin.h"
+#include "phasar/PhasarLLVM/DataFlow/PathSensitivity/LLVMPathConstraints.h"
 #include "phasar/PhasarLLVM/DataFlow/PathSensitivity/Z3BasedPathSensitivityConfig.h"
+#include "phasar/PhasarLLVM/DataFlow/PathSensitivity/Z3ConstraintSolver.h"
 #include "phasar/PhasarLLVM/Utils/LLVMIRToSrc.h"
 #include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
 #include "phasar/Utils/GraphTraits.h"
 #include "phasar/Utils/Logger.h"
 #include "phasar/Utils/MaybeUniquePtr.h"
+#include "phasar/Utils/Utilities.h"
 
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/STLExtras.h"
@@ -27,18 +30,71 @@
 
 #include "z3++.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <filesystem>
 #include <memory>
+#include <optional>
 #include <system_error>
+#include <thread>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace llvm {
 class Instruction;
 } // namespace llvm
 
 namespace psr {
-class LLVMPathConstraints;
+
+/// The order in which a FlowPathGenerator yields the valid paths
+enum class FlowPathOrder {
+  /// Plain depth-first order over the path-DAG. This is the order that
+  /// pathsTo() uses
+  DepthFirst,
+  /// Depth-first, but always descend into the successor that leads to the
+  /// shortest remaining path first. The first yielded path is a shortest one
+  BestFirst,
+  /// Strictly by increasing path length. Re-traverses the path-DAG once per
+  /// distinct path length (iterative deepening)
+  ShortestFirst,
+};
+
+/// Lazily enumerates the valid paths of a path-DAG, one at a time.
+///
+/// In contrast to pathsTo(), no path is computed before it is requested, so
+/// clients that only need a few witnesses can stop early. Apart from the DAG
+/// itself, the memory consumption is proportional to the depth of the DAG
+/// rather than to the number of paths.
+///
+/// The generator refers to the LLVMPathConstraints of the manager that
+/// created it, so it must not outlive that manager.
+class FlowPathGenerator {
+public:
+  using n_t = const llvm::Instruction *;
+
+  /// An exhausted generator
+  FlowPathGenerator() noexcept;
+  FlowPathGenerator(FlowPathGenerator &&) noexcept;
+  FlowPathGenerator &operator=(FlowPathGenerator &&) noexcept;
+  ~FlowPathGenerator();
+
+  /// Computes the next valid path. Returns std::nullopt, if all valid paths
+  /// have already been yielded
+  [[nodiscard]] std::optional<FlowPath<n_t>> next();
+
+  /// The number of paths yielded so far
+  [[nodiscard]] size_t getNumPathsYielded() const noexcept;
+
+private:
+  friend class Z3BasedPathSensitivityManagerBase;
+  struct Impl;
+
+  explicit FlowPathGenerator(std::unique_ptr<Impl> PImpl) noexcept;
+
+  std::unique_ptr<Impl> PImpl;
+};
 
 class Z3BasedPathSensitivityManagerBase
     : public PathSensitivityManagerBase<const llvm::Instruction *> {
@@ -58,7 +114,19 @@ protected:
                          const Z3BasedPathSensitivityConfig &Config,
                          LLVMPathConstraints &LPC) const;
 
+  [[nodiscard]] static FlowPathGenerator
+  makePathGenerator(graph_type RevDAG, vertex_t Leaf, n_t FinalInst,
+                    const Z3BasedPathSensitivityConfig &Config,
+                    LLVMPathConstraints &LPC, FlowPathOrder Order);
+
+  [[nodiscard]] static vertex_t getLeaf(const graph_type &Dag);
+
   static void deduplicatePaths(FlowPathSequence<n_t> &Paths);
+
+  [[nodiscard]] static z3::expr translateExpr(const z3::expr &Expr,
+                                              z3::context &To);
+  /// Moves the constraints and models of all Paths into the context To
+  static void translatePaths(FlowPathSequence<n_t> &Paths, z3::context &To);
 };
 
 template <typename AnalysisDomainTy,
@@ -99,6 +167,156 @@ public:
           "please call the pathsOrConstraintTo function instead!");
     }
 
+    auto StatsBefore = LPC->getSolver().getStats();
+    scope_exit RecordStats = [this, &StatsBefore] {
+      LastQueryStats = LPC->getSolver().getStats() - StatsBefore;
+      PHASAR_LOG_LEVEL_CAT(INFO, "PathSensitivityManager",
+                           "Z3 statistics of the path query: "
+                               << LastQueryStats);
+    };
+
+    return pathsToImpl(Inst, std::move(Fact), Config, *LPC);
+  }
+
+  /// Like pathsTo(), but yields the paths one at a time in the given Order
+  /// instead of materializing all of them up front. The NumPathsThreshold of
+  /// the config is not applied; just stop calling next() instead.
+  ///
+  /// The returned generator must not outlive this manager.
+  [[nodiscard]] FlowPathGenerator
+  pathsGeneratorTo(n_t Inst, d_t Fact,
+                   FlowPathOrder Order = FlowPathOrder::BestFirst) const {
+    graph_type Dag = this->pathsDagTo(Inst, std::move(Fact), Config);
+    auto Leaf = getLeaf(Dag);
+
+    if (filterOutUnreachableNodes(Dag, Leaf, Config, *LPC).is_false()) {
+      PHASAR_LOG_LEVEL_CAT(INFO, "PathSensitivityManager",
+                           "The query position is unreachable");
+      return {};
+    }
+
+    return makePathGenerator(std::move(Dag), Leaf, Inst, Config, *LPC, Order);
+  }
+
+  /// Computes the paths to all given (instruction, fact) leaves, as if
+  /// calling pathsTo() for each of them, but processes the leaves
+  /// concurrently on up to NumThreads threads. The I-th result belongs to the
+  /// I-th leaf.
+  ///
+  /// Each worker-thread uses its own Z3 context and LLVMPathConstraints, while
+  /// the ExplodedSuperGraph is shared read-only. The constraints and models of
+  /// the returned paths are translated back into the context of this
+  /// manager's LLVMPathConstraints.
+  [[nodiscard]] std::vector<FlowPathSequence<n_t>>
+  pathsToAll(llvm::ArrayRef<std::pair<n_t, d_t>> Leaves,
+             unsigned NumThreads = std::thread::hardware_concurrency()) const {
+    std::vector<FlowPathSequence<n_t>> Ret(Leaves.size());
+    NumThreads = std::max(1U, unsigned(std::min<size_t>(NumThreads,
+                                                        Leaves.size())));
+
+    if (NumThreads == 1) {
+      auto StatsBefore = LPC->getSolver().getStats();
+      for (size_t I = 0, End = Leaves.size(); I != End; ++I) {
+        Ret[I] = pathsToImpl(Leaves[I].first, Leaves[I].second, Config, *LPC);
+      }
+      LastQueryStats = LPC->getSolver().getStats() - StatsBefore;
+      return Ret;
+    }
+
+    struct Worker {
+      LLVMPathConstraints WorkerLPC{};
+      Z3BasedPathSensitivityConfig WorkerConfig{};
+    };
+
+    // Z3 contexts are not thread-safe, so set up everything that touches more
+    // than one context on this thread
+    std::vector<std::unique_ptr<Worker>> Workers;
+    Workers.reserve(NumThreads);
+    for (unsigned I = 0; I != NumThreads; ++I) {
+      auto &W = Workers.emplace_back(std::make_unique<Worker>());
+      W->WorkerConfig = Config;
+      if (Config.AdditionalConstraint) {
+        W->WorkerConfig.AdditionalConstraint = translateExpr(
+            *Config.AdditionalConstraint, W->WorkerLPC.getContext());
+      }
+    }
+
+    std::atomic_size_t NextLeaf = 0;
+    std::vector<std::thread> Threads;
+    Threads.reserve(NumThreads);
+    for (auto &W : Workers) {
+      Threads.emplace_back([this, &W = *W, &NextLeaf, &Ret, Leaves] {
+        for (size_t I = NextLeaf++; I < Leaves.size(); I = NextLeaf++) {
+          Ret[I] = pathsToImpl(Leaves[I].first, Leaves[I].second,
+                               W.WorkerConfig, W.WorkerLPC,
+                               /*DumpDag*/ false);
+        }
+      });
+    }
+    for (auto &Thread : Threads) {
+      Thread.join();
+    }
+
+    LastQueryStats = {};
+    for (const auto &W : Workers) {
+      LastQueryStats += W->WorkerLPC.getSolver().getStats();
+    }
+    PHASAR_LOG_LEVEL_CAT(INFO, "PathSensitivityManager",
+                         "Z3 statistics of the " << Leaves.size()
+                                                 << " path queries: "
+                                                 << LastQueryStats);
+
+    // Release all references into the workers' contexts before destroying
+    // them
+    for (auto &Paths : Ret) {
+      translatePaths(Paths, LPC->getContext());
+    }
+    return Ret;
+  }
+
+  /// The number of Z3 invocations, cache hits and the time spent in Z3 during
+  /// the most recent call to pathsTo() or pathsToAll()
+  [[nodiscard]] const Z3SolverStats &getLastQueryStats() const noexcept {
+    return LastQueryStats;
+  }
+
+private:
+#ifndef NDEBUG
+  static void dumpDag(const graph_type &Dag, n_t Inst) {
+    std::error_code EC;
+    llvm::raw_fd_stream ROS(
+        "dag-" +
+            std::filesystem::path(psr::getFilePathFromIR(Inst))
+                .filename()
+                .string() +
+            "-" + psr::getMetaDataID(Inst) + ".dot",
+        EC);
+    if (EC) {
+      llvm::errs() << "Cannot dump the paths DAG: " << EC.message() << '\n';
+      return;
+    }
+    printGraph(Dag, ROS, "DAG", [](llvm::ArrayRef<n_t> PartialPath) {
+      std::string Buf;
+      llvm::raw_string_ostream ROS(Buf);
+      ROS << "[ ";
+      llvm::interleaveComma(PartialPath, ROS, [&ROS](const auto *Inst) {
+        ROS << psr::getMetaDataID(Inst);
+      });
+      ROS << " ]";
+      ROS.flush();
+      return Buf;
+    });
+
+    llvm::errs() << "Paths DAG has " << Dag.Roots.size() << " roots\n";
+  }
+#endif
+
+  /// Set DumpDag to false, when running concurrently with other queries: The
+  /// DAGs of different leaves may be dumped to the same file.
+  FlowPathSequence<n_t> pathsToImpl(n_t Inst, d_t Fact,
+                                    const Z3BasedPathSensitivityConfig &Config,
+                                    LLVMPathConstraints &LPC,
+                                    bool DumpDag = true) const {
     graph_type Dag = this->pathsDagTo(Inst, std::move(Fact), Config);
 
     PHASAR_LOG_LEVEL_CAT(
@@ -106,42 +324,16 @@ public:
         "PathsTo with MaxDAGDepth: " << Config.DAGDepthThreshold);
 
 #ifndef NDEBUG
-    {
-      std::error_code EC;
-      llvm::raw_fd_stream ROS(
-          "dag-" +
-              std::filesystem::path(psr::getFilePathFromIR(Inst))
-                  .filename()
-                  .string() +
-              "-" + psr::getMetaDataID(Inst) + ".dot",
-          EC);
-      assert(!EC);
-      printGraph(Dag, ROS, "DAG", [](llvm::ArrayRef<n_t> PartialPath) {
-        std::string Buf;
-        llvm::raw_string_ostream ROS(Buf);
-        ROS << "[ ";
-        llvm::interleaveComma(PartialPath, ROS, [&ROS](const auto *Inst) {
-          ROS << psr::getMetaDataID(Inst);
-        });
-        ROS << " ]";
-        ROS.flush();
-        return Buf;
-      });
-
-      llvm::errs() << "Paths DAG has " << Dag.Roots.size() << " roots\n";
+    if (DumpDag) {
+      dumpDag(Dag, Inst);
     }
+#else
+    (void)DumpDag;
 #endif
 
-    vertex_t Leaf = [&Dag] {
-      for (auto Vtx : graph_traits_t::vertices(Dag)) {
-        if (graph_traits_t::outDegree(Dag, Vtx) == 0) {
-          return Vtx;
-        }
-      }
-      llvm_unreachable("Expect the DAG to have a leaf node!");
-    }();
+    vertex_t Leaf = getLeaf(Dag);
 
-    z3::expr Constraint = filterOutUnreachableNodes(Dag, Leaf, Config, *LPC);
+    z3::expr Constraint = filterOutUnreachableNodes(Dag, Leaf, Config, LPC);
 
     if (Constraint.is_false()) {
       PHASAR_LOG_LEVEL_CAT(INFO, "PathSensitivityManager",
@@ -149,7 +341,7 @@ public:
       return FlowPathSequence<n_t>();
     }
 
-    auto Ret = filterAndFlattenRevDag(Dag, Leaf, Inst, Config, *LPC);
+    auto Ret = filterAndFlattenRevDag(Dag, Leaf, Inst, Config, LPC);
 
     deduplicatePaths(Ret);
 
@@ -176,10 +368,10 @@ public:
     return Ret;
   }
 
-private:
   Z3BasedPathSensitivityConfig Config{};
   /// FIXME: Not using 'mutable' here
   mutable MaybeUniquePtr<LLVMPathConstraints, true> LPC{};
+  mutable Z3SolverStats LastQueryStats{};
 };
 } // namespace psr
 
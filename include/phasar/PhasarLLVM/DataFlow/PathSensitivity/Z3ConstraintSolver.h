@@ -0,0 +1,155 @@
+/******************************************************************************
+ * Copyright (c) 2024 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_DATAFLOW_PATHSENSITIVITY_Z3CONSTRAINTSOLVER_H
+#define PHASAR_PHASARLLVM_DATAFLOW_PATHSENSITIVITY_Z3CONSTRAINTSOLVER_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "z3++.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace psr {
+
+/// Statistics of a Z3ConstraintSolver. Subtract two snapshots to get the
+/// statistics of a single query
+struct Z3SolverStats {
+  /// Number of satisfiability checks requested
+  size_t NumQueries = 0;
+  /// Number of checks that actually invoked Z3
+  size_t NumSolverCalls = 0;
+  /// Number of checks answered from the result-cache
+  size_t NumCacheHits = 0;
+  /// Number of checks answered by a previously learned unsat core
+  size_t NumUnsatCoreHits = 0;
+  /// Total time spent inside Z3
+  std::chrono::nanoseconds SolverTime{};
+
+  friend Z3SolverStats operator-(const Z3SolverStats &Lhs,
+                                 const Z3SolverStats &Rhs) noexcept {
+    return {
+        Lhs.NumQueries - Rhs.NumQueries,
+        Lhs.NumSolverCalls - Rhs.NumSolverCalls,
+        Lhs.NumCacheHits - Rhs.NumCacheHits,
+        Lhs.NumUnsatCoreHits - Rhs.NumUnsatCoreHits,
+        Lhs.SolverTime - Rhs.SolverTime,
+    };
+  }
+
+  Z3SolverStats &operator+=(const Z3SolverStats &Other) noexcept {
+    NumQueries += Other.NumQueries;
+    NumSolverCalls += Other.NumSolverCalls;
+    NumCacheHits += Other.NumCacheHits;
+    NumUnsatCoreHits += Other.NumUnsatCoreHits;
+    SolverTime += Other.SolverTime;
+    return *this;
+  }
+
+  friend llvm::raw_ostream &operator<<(llvm::raw_ostream &OS,
+                                       const Z3SolverStats &S);
+};
+
+/// Checks conjunctions of path-constraints for satisfiability and memoizes
+/// the results.
+///
+/// Each conjunction is flattened into its conjuncts, which are identified by
+/// their (hash-consed) Z3 AST-ids. The sorted set of ids serves as canonical
+/// key for the result-cache, such that the same conjunction is never solved
+/// twice, independent of the order in which its parts were collected.
+///
+/// Instead of push()/pop(), every conjunct is asserted once to a single
+/// incremental solver, guarded by a fresh tracking literal. A query then only
+/// passes the tracking literals of its conjuncts as assumptions, so the solver
+/// keeps everything it learned between queries. The unsat cores of refuted
+/// queries are recorded, so any later query that contains a known core is
+/// rejected without invoking Z3 at all.
+///
+/// All expressions must belong to the context that was passed to the
+/// constructor.
+class Z3ConstraintSolver {
+public:
+  explicit Z3ConstraintSolver(z3::context &Z3Ctx);
+
+  /// Checks the conjunction of all Constraints for satisfiability
+  [[nodiscard]] z3::check_result check(llvm::ArrayRef<z3::expr> Constraints);
+
+  /// Returns a model of the conjunction of all Constraints. Requires that
+  /// check(Constraints) did not return unsat. The model does not contain the
+  /// internal tracking literals.
+  [[nodiscard]] z3::model getModel(llvm::ArrayRef<z3::expr> Constraints);
+
+  [[nodiscard]] const Z3SolverStats &getStats() const noexcept {
+    return Stats;
+  }
+
+  [[nodiscard]] size_t getNumCachedResults() const noexcept {
+    return Results.size();
+  }
+  [[nodiscard]] size_t getNumUnsatCores() const noexcept {
+    return UnsatCores.size();
+  }
+
+  [[nodiscard]] z3::context &getContext() const noexcept { return *Z3Ctx; }
+
+private:
+  using key_t = llvm::SmallVector<unsigned, 8>;
+
+  struct KeyHash {
+    size_t operator()(const key_t &Key) const noexcept;
+  };
+
+  struct CachedResult {
+    z3::check_result Result{};
+    /// Only computed on demand
+    std::optional<z3::model> Model;
+  };
+
+  /// Returns false, iff one of the conjuncts is trivially false
+  bool canonicalize(llvm::ArrayRef<z3::expr> Constraints, key_t &Key);
+  void addConjunct(const z3::expr &Constr, key_t &Key);
+
+  [[nodiscard]] bool containsKnownUnsatCore(const key_t &Key) const;
+  void recordUnsatCore();
+
+  z3::check_result solve(const key_t &Key);
+  [[nodiscard]] z3::model extractModel();
+
+  z3::context *Z3Ctx;
+  z3::solver Solver;
+
+  /// For each conjunct (by AST-id): The conjunct itself (to keep its id
+  /// alive) and its tracking literal
+  std::unordered_map<unsigned, std::pair<z3::expr, z3::expr>> Conjuncts;
+  /// Maps the AST-id of each tracking literal back to the id of its conjunct
+  llvm::DenseMap<unsigned, unsigned> TrackerToConjunct;
+
+  std::unordered_map<key_t, CachedResult, KeyHash> Results;
+  /// The key of the most recent query that the solver found satisfiable
+  key_t LastSatKey;
+
+  /// All learned unsat cores as sorted sets of conjunct-ids
+  std::vector<key_t> UnsatCores;
+  /// Maps the smallest conjunct-id of each core to the indices of these cores
+  llvm::DenseMap<unsigned, llvm::SmallVector<uint32_t, 2>> UnsatCoresByFirst;
+
+  Z3SolverStats Stats;
+};
+
+} // namespace psr
+
+#endif // PHASAR_PHASARLLVM_DATAFLOW_PATHSENSITIVITY_Z3CONSTRAINTSOLVER_H
@@ -29,7 +29,10 @@ class LLVMProjectIRDB;
 class LLVMTypeHierarchy;
 class LLVMBasedICFG;
 class LLVMBasedCFG;
+class LLVMFrozenICFG;
 class LLVMAliasSet;
+struct LLVMIncrementalSnapshot;
+class LLVMIncrementalUpdateAnalysis;
 
 class HelperAnalyses { // NOLINT(cppcoreguidelines-special-member-functions)
 public:
@@ -63,13 +66,37 @@ public:
   [[nodiscard]] LLVMTypeHierarchy &getTypeHierarchy();
   [[nodiscard]] LLVMBasedICFG &getICFG();
   [[nodiscard]] LLVMBasedCFG &getCFG();
+  /// A precomputed snapshot of getICFG(). The IR must not be modified
+  /// afterwards
+  [[nodiscard]] LLVMFrozenICFG &getFrozenICFG();
+
+  /// Eagerly constructs all helper analyses and completes all information
+  /// that they would otherwise compute lazily on demand. Afterwards, the
+  /// helper analyses are only read, so multiple data-flow analyses can share
+  /// them concurrently.
+  void freeze();
+
+  /// Reuses the alias sets and resolved indirect calls of all functions that
+  /// did not change since Baseline was taken. Must be called before the alias
+  /// information or the ICFG are constructed. Baseline must outlive this
+  /// object.
+  LLVMIncrementalUpdateAnalysis &
+  setIncrementalBaseline(const LLVMIncrementalSnapshot &Baseline);
+
+  /// Takes a snapshot of the helper analyses that have been constructed so
+  /// far, to be used as baseline for the next incremental update
+  [[nodiscard]] LLVMIncrementalSnapshot takeIncrementalSnapshot() const;
 
 private:
+  std::unique_ptr<LLVMAliasSet> createAliasSet();
+  std::unique_ptr<LLVMBasedICFG> createICFG();
+
   std::unique_ptr<LLVMProjectIRDB> IRDB;
   std::unique_ptr<LLVMAliasSet> PT;
   std::unique_ptr<LLVMTypeHierarchy> TH;
   std::unique_ptr<LLVMBasedICFG> ICF;
   std::unique_ptr<LLVMBasedCFG> CFG;
+  std::unique_ptr<LLVMFrozenICFG> FrozenICF;
 
   // IRDB
   std::string IRFile;
@@ -85,6 +112,8 @@ private:
   CallGraphAnalysisType CGTy{};
   Soundness SoundnessLevel{};
   bool AutoGlobalSupport{};
+
+  std::unique_ptr<LLVMIncrementalUpdateAnalysis> Incremental;
 };
 } // namespace psr
 
@@ -0,0 +1,102 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_LLVMINCREMENTALUPDATE_H
+#define PHASAR_PHASARLLVM_LLVMINCREMENTALUPDATE_H
+
+#include "phasar/AnalysisStrategy/IncrementalUpdateAnalysis.h"
+#include "phasar/ControlFlow/CallGraphAnalysisType.h"
+#include "phasar/PhasarLLVM/ControlFlow/Resolver/IncrementalResolver.h"
+#include "phasar/PhasarLLVM/Utils/LLVMIRDiff.h"
+#include "phasar/Pointer/AliasAnalysisType.h"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/Twine.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "nlohmann/json.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace psr {
+class LLVMProjectIRDB;
+class LLVMAliasSet;
+class LLVMBasedICFG;
+class LLVMVFTableProvider;
+
+/// The helper-analysis results that an incremental-update run persists, such
+/// that the next run on a modified version of the same program can reuse
+/// them. All values are identified by their LLVMStableValueIds.
+struct LLVMIncrementalSnapshot {
+  ModuleFingerprint Fingerprint;
+  std::vector<std::vector<std::string>> AliasSets;
+  std::vector<std::string> AnalyzedFunctions;
+  /// The alias analysis that has computed the AliasSets
+  AliasAnalysisType PATy = AliasAnalysisType::Invalid;
+  /// Maps each indirect call-site to the names of its resolved callees
+  std::map<std::string, std::vector<std::string>> IndirectCallTargets;
+  /// The call-graph analysis that has resolved the IndirectCallTargets
+  CallGraphAnalysisType CGTy = CallGraphAnalysisType::Invalid;
+
+  LLVMIncrementalSnapshot() noexcept = default;
+
+  /// Takes a snapshot of the given helper analyses. PT and ICF may be null,
+  /// if they have not been computed.
+  [[nodiscard]] static LLVMIncrementalSnapshot
+  create(const LLVMProjectIRDB &IRDB, const LLVMAliasSet *PT,
+         const LLVMBasedICFG *ICF, CallGraphAnalysisType CGTy);
+
+  void printAsJson(llvm::raw_ostream &OS) const;
+
+  static LLVMIncrementalSnapshot deserializeJson(const llvm::Twine &Path);
+  static LLVMIncrementalSnapshot loadJsonString(llvm::StringRef JsonAsString);
+};
+
+/// Diffs the current version of a program against an LLVMIncrementalSnapshot
+/// and carries over the helper-analysis results of all functions that did not
+/// change. Data-flow results are not part of the snapshot.
+class LLVMIncrementalUpdateAnalysis : public IncrementalUpdateAnalysis {
+public:
+  /// Baseline must outlive this object
+  LLVMIncrementalUpdateAnalysis(const LLVMIncrementalSnapshot &Baseline,
+                                const LLVMProjectIRDB &IRDB);
+
+  /// Returns the baseline alias sets restricted to globals and values of
+  /// unchanged functions in the format expected by LLVMAliasSet. All other
+  /// functions are left for the alias analysis to compute on demand. Nothing
+  /// is reused, if the baseline was computed by another alias analysis than
+  /// PATy.
+  [[nodiscard]] nlohmann::json
+  getReusableAliasSets(AliasAnalysisType PATy) const;
+
+  /// Returns the baseline targets of all indirect call-sites in unchanged
+  /// functions that a call-graph analysis of type CGTy would resolve in the
+  /// same way, given that it is based on alias information computed by PATy.
+  ///
+  /// All targets can be reused, if nothing has changed at all. Otherwise,
+  /// only virtual call-sites resolved by CHA are reused (as long as no type or
+  /// vtable has changed); the results of all other analyses depend on the
+  /// bodies of other (possibly changed) functions.
+  [[nodiscard]] IncrementalResolver::KnownTargetsTy
+  getReusableCallTargets(CallGraphAnalysisType CGTy, AliasAnalysisType PATy,
+                         const LLVMVFTableProvider &VTP) const;
+
+private:
+  [[nodiscard]] bool isReusable(const llvm::Value *V) const;
+
+  const LLVMIncrementalSnapshot *Baseline{};
+  const LLVMProjectIRDB *IRDB{};
+  LLVMStableValueIds Ids;
+};
+
+} // namespace psr
+
+#endif // PHASAR_PHASARLLVM_LLVMINCREMENTALUPDATE_H
@@ -24,6 +24,8 @@
 
 #include "nlohmann/json.hpp"
 
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 
 namespace llvm {
@@ -62,8 +64,12 @@ public:
   explicit LLVMAliasSet(LLVMProjectIRDB *IRDB, bool UseLazyEvaluation = true,
                         AliasAnalysisType PATy = AliasAnalysisType::CFLAnders);
 
+  /// Loads precomputed alias sets. The alias sets of all functions that are
+  /// not listed as analyzed in SerializedPTS are computed on the fly using
+  /// PATy.
   explicit LLVMAliasSet(LLVMProjectIRDB *IRDB,
-                        const nlohmann::json &SerializedPTS);
+                        const nlohmann::json &SerializedPTS,
+                        AliasAnalysisType PATy = AliasAnalysisType::Basic);
 
   [[nodiscard]] inline bool isInterProcedural() const noexcept {
     return false;
@@ -90,6 +96,16 @@ public:
 
   void mergeWith(const LLVMAliasSet &OtherPTI);
 
+  /// Eagerly computes the alias sets of all functions, globals and their
+  /// values in IRDB and freezes this alias info: Afterwards, queries only look
+  /// up the precomputed alias sets and never modify this alias info, so it can
+  /// be queried from multiple threads concurrently. Values that are not part
+  /// of IRDB only alias with themselves. Introducing new aliases is no longer
+  /// allowed.
+  void computeAllAliasSets(const LLVMProjectIRDB &IRDB);
+
+  [[nodiscard]] bool isFrozen() const noexcept { return Frozen; }
+
   void introduceAlias(const llvm::Value *V1, const llvm::Value *V2,
                       const llvm::Instruction *I = nullptr,
                       AliasResult Kind = AliasResult::MustAlias);
@@ -153,6 +169,9 @@ private:
 
   [[nodiscard]] static BoxedPtr<AliasSetTy> getEmptyAliasSet();
 
+  /// The singleton alias set of a value that is not part of the frozen IRDB
+  [[nodiscard]] BoxedPtr<AliasSetTy> getExternalAliasSet(const llvm::Value *V);
+
   LLVMBasedAliasAnalysis PTA;
   llvm::DenseSet<const llvm::Function *> AnalyzedFunctions;
 
@@ -160,6 +179,17 @@ private:
   AliasSetOwner<AliasSetTy> Owner{&MRes};
 
   AliasSetMap AliasSets;
+  bool Frozen = false;
+
+  struct ExternalAliasSetEntry {
+    AliasSetTy Set{};
+    AliasSetTy *Ptr = &Set;
+  };
+  /// Lazily created by getExternalAliasSet(). These are the only alias sets
+  /// that are added after freezing, so they are guarded separately.
+  std::mutex ExternalAliasSetsMtx;
+  std::unordered_map<const llvm::Value *, ExternalAliasSetEntry>
+      ExternalAliasSets;
 };
 
 static_assert(IsAliasInfo<LLVMAliasSet>);
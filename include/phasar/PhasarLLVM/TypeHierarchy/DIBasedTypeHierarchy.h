@@ -42,10 +42,10 @@ public:
     return TypeToVertex.count(Type);
   }
 
+  /// Checks whether SubType is a (reflexive-transitive) subtype of Type in
+  /// constant time.
   [[nodiscard]] bool isSubType(ClassType Type,
-                               ClassType SubType) const override {
-    return llvm::is_contained(subTypesOf(Type), SubType);
-  }
+                               ClassType SubType) const override;
 
   [[nodiscard]] std::set<ClassType> getSubTypes(ClassType Type) const override {
     const auto &Range = subTypesOf(Type);
@@ -104,6 +104,7 @@ private:
   [[nodiscard]] DIBasedTypeHierarchyData getTypeHierarchyData() const;
   [[nodiscard]] llvm::iterator_range<const ClassType *>
   subTypesOf(size_t TypeIdx) const noexcept;
+  void buildSubTypeRows();
 
   // ---
 
@@ -121,6 +122,14 @@ private:
   // without ever storing it explicitly. This only works, because the type-graph
   // is known to never contain loops
   std::vector<ClassType> Hierarchy;
+  // If the type-graph is a tree, each type occurs exactly once in Hierarchy,
+  // such that a type is a subtype of another iff its position lies within the
+  // other's TransitiveDerivedIndex. With multiple inheritance, this is only
+  // sufficient, so we additionally store the transitive closure as bitsets
+  // indexed by TypeToVertex. Only the types that have proper subtypes get a
+  // row. Empty for trees.
+  std::vector<uint32_t> SubTypeRow;
+  std::vector<llvm::BitVector> SubTypeRows;
 
   // The VTables of the polymorphic types in the TH. default-constructed if not
   // exists
@@ -21,12 +21,15 @@
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMVFTable.h"
 #include "phasar/TypeHierarchy/TypeHierarchy.h"
 
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include "boost/graph/adjacency_list.hpp"
 #include "boost/graph/graph_traits.hpp"
 
+#include <cstdint>
 #include <optional>
 #include <set>
 #include <string>
@@ -62,7 +65,6 @@ public:
 
     const llvm::StructType *Type = nullptr;
     std::optional<LLVMVFTable> VFT = std::nullopt;
-    std::set<const llvm::StructType *> ReachableTypes;
   };
 
   /// Edges in the class hierarchy graph doesn't hold any additional
@@ -110,12 +112,30 @@ private:
   // map from clearname to vtable variable
   std::unordered_map<std::string, const llvm::GlobalVariable *> ClearNameTVMap;
 
+  static constexpr uint32_t NoSubTypeRow = UINT32_MAX;
+
+  // The transitive closure of the subtype-relation, flattened into one array.
+  // SubTypeRanges[V] is the range of the (reflexive) subtypes of vertex V
+  // within SubTypeStorage, sorted by vertex.
+  std::vector<const llvm::StructType *> SubTypeStorage;
+  std::vector<std::pair<uint32_t, uint32_t>> SubTypeRanges;
+  // The same closure as bitsets indexed by vertex, such that isSubType() is a
+  // single bit-test. Only the types that have proper subtypes get a row;
+  // SubTypeRow[V] is the row of vertex V or NoSubTypeRow.
+  std::vector<uint32_t> SubTypeRow;
+  std::vector<llvm::BitVector> SubTypeRows;
+
   std::vector<const llvm::StructType *>
   getSubTypes(const llvm::Module &M, const llvm::StructType &Type) const;
 
   std::vector<const llvm::Function *>
   getVirtualFunctions(const llvm::Module &M, const llvm::StructType &Type);
 
+  void buildSubTypeClosure();
+
+  [[nodiscard]] llvm::ArrayRef<const llvm::StructType *>
+  subTypesOf(vertex_t Vtx) const noexcept;
+
 protected:
   void buildLLVMTypeHierarchy(const llvm::Module &M);
 
@@ -162,16 +182,19 @@ public:
     return TypeVertexMap.count(Type);
   }
 
-  [[nodiscard]] inline bool
-  isSubType(const llvm::StructType *Type,
-            const llvm::StructType *SubType) const override {
-    auto ReachableTypes = getSubTypes(Type);
-    return ReachableTypes.count(SubType);
-  }
+  /// Checks whether SubType is a (reflexive-transitive) subtype of Type in
+  /// constant time.
+  [[nodiscard]] bool isSubType(const llvm::StructType *Type,
+                               const llvm::StructType *SubType) const override;
 
   std::set<const llvm::StructType *>
   getSubTypes(const llvm::StructType *Type) const override;
 
+  /// A more efficient version of getSubTypes() that does not allocate. The
+  /// returned types are ordered by their insertion into the type hierarchy.
+  [[nodiscard]] llvm::ArrayRef<const llvm::StructType *>
+  subTypesOf(const llvm::StructType *Type) const noexcept;
+
   [[nodiscard]] const llvm::StructType *
   getType(llvm::StringRef TypeName) const override;
 
@@ -15,7 +15,9 @@
 #include "phasar/PhasarLLVM/Utils/DataFlowAnalysisType.h"
 #include "phasar/PhasarLLVM/Utils/LLVMBasedContainerConfig.h"
 #include "phasar/PhasarLLVM/Utils/LLVMCXXShorthands.h"
+#include "phasar/PhasarLLVM/Utils/LLVMIRDiff.h"
 #include "phasar/PhasarLLVM/Utils/LLVMIRToSrc.h"
+#include "phasar/PhasarLLVM/Utils/LLVMModuleInterface.h"
 #include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
 
 #endif // PHASAR_PHASARLLVM_UTILS_H
@@ -0,0 +1,66 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_UTILS_LLVMIRDIFF_H
+#define PHASAR_PHASARLLVM_UTILS_LLVMIRDIFF_H
+
+#include "phasar/AnalysisStrategy/IncrementalUpdateAnalysis.h"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringRef.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace llvm {
+class Function;
+class Instruction;
+class Module;
+class Value;
+} // namespace llvm
+
+namespace psr {
+
+/// Computes a hash of the body of F that is stable across runs and
+/// compilations. The hash ignores debug information, PhASAR's metadata-ids
+/// and the names of local values, which are identified by their position
+/// instead.
+[[nodiscard]] uint64_t computeFunctionHash(const llvm::Function &F);
+
+/// Computes the hashes of all function definitions in M and the hash over
+/// M's global variables and named struct types.
+[[nodiscard]] ModuleFingerprint computeModuleFingerprint(const llvm::Module &M);
+
+/// Names values by their position, such that values of functions that did
+/// not change keep their ids across two versions of the same module, even if
+/// their metadata-ids have shifted.
+///
+/// The id of a global is "@<name>", the id of the N-th argument of F is
+/// "<F>#a<N>" and the id of the N-th (non-debug) instruction of F is "<F>#<N>".
+class LLVMStableValueIds {
+public:
+  explicit LLVMStableValueIds(const llvm::Module &M);
+
+  /// Returns the stable id of V, or the empty string if V has none
+  [[nodiscard]] std::string getId(const llvm::Value *V) const;
+
+  /// Returns the value with the stable id Id, or nullptr if there is none
+  [[nodiscard]] const llvm::Value *getValue(llvm::StringRef Id) const;
+
+private:
+  const llvm::Module *M{};
+  llvm::DenseMap<const llvm::Instruction *, uint32_t> InstIndex;
+  llvm::DenseMap<const llvm::Function *, std::vector<const llvm::Instruction *>>
+      Insts;
+};
+
+} // namespace psr
+
+#endif // PHASAR_PHASARLLVM_UTILS_LLVMIRDIFF_H
@@ -0,0 +1,36 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_UTILS_LLVMMODULEINTERFACE_H
+#define PHASAR_PHASARLLVM_UTILS_LLVMMODULEINTERFACE_H
+
+#include "phasar/AnalysisStrategy/ModuleWiseAnalysis.h"
+
+#include "llvm/ADT/StringRef.h"
+
+namespace llvm {
+class Function;
+class Module;
+} // namespace llvm
+
+namespace psr {
+
+/// True, iff F is defined in its module and other modules may call exactly
+/// this definition. Inline and weak definitions are excluded, since every
+/// module that uses them may bring its own copy.
+[[nodiscard]] bool isExportedDefinition(const llvm::Function &F) noexcept;
+
+/// Computes the functions that M exports and the ones that it imports from
+/// other modules
+[[nodiscard]] ModuleInterface computeModuleInterface(const llvm::Module &M,
+                                                     llvm::StringRef Name);
+
+} // namespace psr
+
+#endif // PHASAR_PHASARLLVM_UTILS_LLVMMODULEINTERFACE_H
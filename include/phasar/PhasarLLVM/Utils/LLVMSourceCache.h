@@ -0,0 +1,105 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_PHASARLLVM_UTILS_LLVMSOURCECACHE_H
+#define PHASAR_PHASARLLVM_UTILS_LLVMSOURCECACHE_H
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace llvm {
+class DIFile;
+} // namespace llvm
+
+namespace psr {
+
+/// A source file that is referenced from the debug-info of the analyzed IR.
+/// The file contents are memory-mapped (for larger files) and indexed by the
+/// offsets of the line starts, such that retrieving a line is O(1).
+class LLVMSourceFile {
+public:
+  explicit LLVMSourceFile(std::unique_ptr<llvm::MemoryBuffer> Buffer);
+
+  /// Returns the line with the 1-based number LineNr without the line
+  /// terminator, or an empty string, if the file has no such line.
+  [[nodiscard]] llvm::StringRef getLine(unsigned LineNr) const noexcept;
+
+  [[nodiscard]] size_t getNumLines() const noexcept {
+    return LineOffsets.size();
+  }
+
+  [[nodiscard]] const llvm::MemoryBuffer &getBuffer() const noexcept {
+    return *Buffer;
+  }
+
+  [[nodiscard]] llvm::StringRef getPath() const noexcept {
+    return Buffer->getBufferIdentifier();
+  }
+
+private:
+  std::unique_ptr<llvm::MemoryBuffer> Buffer;
+  /// The offsets of the first characters of each line into Buffer
+  std::vector<size_t> LineOffsets;
+};
+
+/// Loads each source file at most once and serves the lines from the
+/// in-memory LLVMSourceFile afterwards. The cache is shared between all
+/// users of getSrcCodeFromIR(), the LLVMSourceManager and the ICFG exporters,
+/// and it is safe to use from multiple threads.
+///
+/// Files that cannot be loaded are remembered as well, such that
+/// repeatedly asking for them does not touch the file system again.
+class LLVMSourceCache {
+public:
+  /// The process-wide cache
+  [[nodiscard]] static LLVMSourceCache &getInstance();
+
+  /// Returns the source file that DIF refers to, or nullptr, if it cannot be
+  /// loaded.
+  [[nodiscard]] const LLVMSourceFile *getFile(const llvm::DIFile *DIF);
+  /// Returns the source file at Path, or nullptr, if it cannot be loaded.
+  [[nodiscard]] const LLVMSourceFile *getFile(llvm::StringRef Path);
+
+  /// Returns the line with the 1-based number LineNr from the source file that
+  /// DIF refers to. Returns an empty string if the file cannot be loaded, or
+  /// it has no such line.
+  [[nodiscard]] llvm::StringRef getLine(const llvm::DIFile *DIF,
+                                        unsigned LineNr);
+
+  /// Releases all loaded files. Invalidates all LLVMSourceFile pointers and
+  /// lines that have been retrieved from this cache.
+  void clear();
+
+private:
+  struct DIFileEntry {
+    const LLVMSourceFile *File{};
+    // A DIFile may be destroyed together with its LLVMContext and its address
+    // may be reused by a different DIFile later, so we compare the names on
+    // each lookup.
+    std::string FileName;
+    std::string Directory;
+  };
+
+  [[nodiscard]] const LLVMSourceFile *getFileImpl(llvm::StringRef Path);
+
+  std::mutex Mtx;
+  llvm::StringMap<std::unique_ptr<LLVMSourceFile>> FilesByPath;
+  llvm::DenseMap<const llvm::DIFile *, DIFileEntry> FilesByDIFile;
+};
+
+} // namespace psr
+
+#endif // PHASAR_PHASARLLVM_UTILS_LLVMSOURCECACHE_H
@@ -0,0 +1,101 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#ifndef PHASAR_UTILS_COMPRESSEDSPARSEROWS_H
+#define PHASAR_UTILS_COMPRESSEDSPARSEROWS_H
+
+#include "llvm/ADT/ArrayRef.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace psr {
+
+/// An immutable jagged array that stores all rows back-to-back in one
+/// contiguous buffer (compressed sparse row format). Row i consists of the
+/// elements [Offsets[i], Offsets[i+1]).
+///
+/// Build it by calling startRow() with ascending row indices, each followed by
+/// the push_back()s for that row, and finish it with finalize(). Rows that are
+/// skipped stay empty.
+template <typename T> class CompressedSparseRows {
+public:
+  CompressedSparseRows() = default;
+
+  void reserve(size_t NumRows, size_t NumElements) {
+    Offsets.reserve(NumRows + 1);
+    Elements.reserve(NumElements);
+  }
+
+  void startRow(size_t Row) {
+    assert(Offsets.size() <= Row + 1 && "Rows must be added in order");
+    assert(Elements.size() <= std::numeric_limits<uint32_t>::max());
+    Offsets.resize(Row + 1, uint32_t(Elements.size()));
+  }
+
+  void push_back(T Elem) { // NOLINT(readability-identifier-naming)
+    assert(!Offsets.empty() && "Call startRow() first");
+    Elements.push_back(std::move(Elem));
+  }
+
+  template <typename RangeT> void append(const RangeT &Range) {
+    assert(!Offsets.empty() && "Call startRow() first");
+    Elements.insert(Elements.end(), Range.begin(), Range.end());
+  }
+
+  /// Terminates the last row; Ensures that there are at least NumRows rows
+  void finalize(size_t NumRows = 0) {
+    assert(Elements.size() <= std::numeric_limits<uint32_t>::max());
+    Offsets.resize(std::max(Offsets.size(), NumRows) + 1,
+                   uint32_t(Elements.size()));
+    Offsets.shrink_to_fit();
+    Elements.shrink_to_fit();
+  }
+
+  [[nodiscard]] llvm::ArrayRef<T> operator[](size_t Row) const noexcept {
+    assert(Row + 1 < Offsets.size() && "Row out of bounds");
+    return llvm::makeArrayRef(Elements.data() + Offsets[Row],
+                              Elements.data() + Offsets[Row + 1]);
+  }
+
+  /// Like operator[], but returns an empty row, if Row is out of bounds
+  [[nodiscard]] llvm::ArrayRef<T> lookup(size_t Row) const noexcept {
+    if (Row >= getNumRows()) {
+      return {};
+    }
+    return (*this)[Row];
+  }
+
+  [[nodiscard]] size_t getNumRows() const noexcept {
+    return Offsets.empty() ? 0 : Offsets.size() - 1;
+  }
+  [[nodiscard]] size_t getNumElements() const noexcept {
+    return Elements.size();
+  }
+  [[nodiscard]] llvm::ArrayRef<T> getAllElements() const noexcept {
+    return Elements;
+  }
+
+  [[nodiscard]] size_t getApproxSizeInBytes() const noexcept {
+    return Offsets.capacity() * sizeof(uint32_t) +
+           Elements.capacity() * sizeof(T);
+  }
+
+private:
+  std::vector<uint32_t> Offsets;
+  std::vector<T> Elements;
+};
+
+} // namespace psr
+
+#endif // PHASAR_UTILS_COMPRESSEDSPARSEROWS_H
@@ -16,6 +16,7 @@
 #include "llvm/Support/Compiler.h" // LLVM_UNLIKELY
 #include "llvm/Support/raw_ostream.h"
 
+#include <mutex>
 #include <optional>
 #include <string>
 
@@ -76,7 +77,15 @@ public:
       const std::optional<std::string> &Category = std::nullopt,
       bool Append = false);
 
+  /// The mutex that the PHASAR_LOG* macros hold while writing a message, such
+  /// that messages from concurrently running analyses do not interleave.
+  /// Recursive, because computing a message may log itself.
+  [[nodiscard]] static std::recursive_mutex &getLogMutex() noexcept {
+    return LogMutex;
+  }
+
 private:
+  static inline std::recursive_mutex LogMutex{};
   static inline bool LoggingEnabled = false;
   static inline SeverityLevel LogFilterLevel = CRITICAL;
 };
@@ -105,6 +114,8 @@ private:
 #define PHASAR_LOG_LEVEL(level, message)                                       \
   do {                                                                         \
     IF_LOG_ENABLED_BOOL(IS_LOG_LEVEL_ENABLED(level), {                         \
+      const std::lock_guard<std::recursive_mutex> PsrLogLock(                  \
+          ::psr::Logger::getLogMutex());                                       \
       auto &Stream = ::psr::Logger::getLogStreamWithLinePrefix(                \
           ::psr::SeverityLevel::level, std::nullopt);                          \
       /* NOLINTNEXTLINE(bugprone-macro-parentheses) */                         \
@@ -120,6 +131,8 @@ private:
         IS_LOG_LEVEL_ENABLED(level) &&                                         \
             ::psr::Logger::logCategory(cat, ::psr::SeverityLevel::level),      \
         {                                                                      \
+          const std::lock_guard<std::recursive_mutex> PsrLogLock(              \
+              ::psr::Logger::getLogMutex());                                   \
           auto &Stream = ::psr::Logger::getLogStreamWithLinePrefix(            \
               ::psr::SeverityLevel::level, cat);                               \
           /* NOLINTNEXTLINE(bugprone-macro-parentheses) */                     \
@@ -132,6 +145,8 @@ private:
     IF_LOG_ENABLED_BOOL(::psr::Logger::isLoggingEnabled() &&                   \
                             ::psr::Logger::logCategory(cat, std::nullopt),     \
                         {                                                      \
+                          const std::lock_guard<std::recursive_mutex>          \
+                              PsrLogLock(::psr::Logger::getLogMutex());        \
                           auto &Stream =                                       \
                               ::psr::Logger::getLogStreamWithLinePrefix(       \
                                   std::nullopt, cat);                          \
@@ -36,6 +36,7 @@ protected:
       Data{};
 
   constexpr MaybeUniquePtrBase(T *Ptr, bool Owns) noexcept : Data{Ptr, Owns} {}
+  constexpr MaybeUniquePtrBase(decltype(Data) Data) noexcept : Data(Data) {}
   constexpr MaybeUniquePtrBase() noexcept = default;
 };
 
@@ -48,6 +49,7 @@ protected:
   llvm::PointerIntPair<T *, 1, bool, PointerTraits> Data{};
 
   constexpr MaybeUniquePtrBase(T *Ptr, bool Owns) noexcept : Data{Ptr, Owns} {}
+  constexpr MaybeUniquePtrBase(decltype(Data) Data) noexcept : Data(Data) {}
   constexpr MaybeUniquePtrBase() noexcept = default;
 };
 } // namespace detail
@@ -20,14 +20,22 @@
 #include "phasar/Utils/TypeTraits.h"
 
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Compiler.h"
 
+#include <atomic>
 #include <chrono> // high_resolution_clock::time_point, milliseconds
+#include <cstdint>
 #include <initializer_list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <set>    // set
 #include <string> // string
+#include <thread>
 #include <vector> // vector
 
 namespace llvm {
@@ -51,6 +59,12 @@ namespace psr {
 /// For better compile times it is advised to include @see PAMMMacros.h instead
 /// of PAMM.h.
 ///
+/// PAMM is thread-safe. Counters are identified by CounterHandles that are
+/// resolved from the counter id once; each thread accumulates its counter
+/// updates locally, and the per-thread values are only summed up when a
+/// counter is read or reported. Timers are tracked per thread, such that
+/// multiple threads can run the same timer concurrently.
+///
 /// @brief This class offers functionality to assist a performance analysis of
 /// the PhASAR framework.
 /// @note This class implements the Singleton Pattern - use the
@@ -61,8 +75,52 @@ public:
   using TimePoint_t = std::chrono::high_resolution_clock::time_point;
   using Duration_t = std::chrono::milliseconds;
 
-  PAMM() noexcept = default;
-  ~PAMM() = default;
+  /// Identifies a counter by its index. Handles are valid for all PAMM
+  /// instances, so they can be resolved once and cached, e.g., in a
+  /// function-local static variable.
+  class CounterHandle {
+  public:
+    [[nodiscard]] constexpr uint32_t getIndex() const noexcept { return Index; }
+
+  private:
+    friend class PAMM;
+    explicit constexpr CounterHandle(uint32_t Index) noexcept : Index(Index) {}
+
+    uint32_t Index{};
+  };
+
+  /// Adds the time between its construction and its destruction as a new
+  /// interval to the repeating timer TimerId - associated macro:
+  /// SCOPED_TIMER(TIMER_ID, SEV_LVL).
+  /// \note TimerId must outlive the ScopedTimer.
+  class ScopedTimer {
+  public:
+    ScopedTimer(PAMM &P, llvm::StringRef TimerId, bool Enabled = true) noexcept
+        : P(Enabled ? &P : nullptr), TimerId(TimerId) {
+      if (Enabled) {
+        Start = std::chrono::high_resolution_clock::now();
+      }
+    }
+    ~ScopedTimer() {
+      if (P) {
+        P->addTimerInterval(TimerId, Start,
+                            std::chrono::high_resolution_clock::now());
+      }
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer &operator=(const ScopedTimer &) = delete;
+    ScopedTimer(ScopedTimer &&) = delete;
+    ScopedTimer &operator=(ScopedTimer &&) = delete;
+
+  private:
+    PAMM *P{};
+    llvm::StringRef TimerId;
+    TimePoint_t Start{};
+  };
+
+  PAMM() noexcept;
+  ~PAMM();
   // PAMM is used as singleton.
   PAMM(const PAMM &PM) = delete;
   PAMM(PAMM &&PM) = delete;
@@ -75,7 +133,8 @@ public:
 
   /// \brief Resets PAMM, i.e. discards all gathered information (timer, counter
   /// etc.) - associated macro: RESET_PAMM.
-  /// \note Only used for unit testing to reset PAMM in between test runs.
+  /// \note Only used for unit testing to reset PAMM in between test runs. Must
+  /// not run concurrently with counter updates.
   void reset();
 
   /// \brief Starts a timer under the given timer id - associated macro:
@@ -126,28 +185,44 @@ public:
   /// \param timerId Unique timer id.
   [[nodiscard]] static std::string getPrintableDuration(uint64_t Duration);
 
+  /// Adds the interval [Start, End] to the repeating timer TimerId.
+  void addTimerInterval(llvm::StringRef TimerId, TimePoint_t Start,
+                        TimePoint_t End);
+
+  /// \brief Returns the handle of the counter with the given id. Creates the
+  /// handle on the first request.
+  [[nodiscard]] static CounterHandle getCounterHandle(llvm::StringRef CounterId);
+
   /// \brief Registers a new counter under the given counter id - associated
   /// macro: REG_COUNTER(COUNTER_ID, INIT_VALUE, SEV_LVL).
   /// \param CounterId Unique counter id.
-  void regCounter(llvm::StringRef CounterId, unsigned IntialValue = 0);
+  void regCounter(llvm::StringRef CounterId, uint64_t IntialValue = 0);
 
   /// \brief Increases the count for the given counter - associated macro:
   /// INC_COUNTER(COUNTER_ID, VALUE, SEV_LVL).
   /// \param CounterId Unique counter id.
   /// \param CValue to be added to the current counter.
-  void incCounter(llvm::StringRef CounterId, unsigned CValue = 1);
+  void incCounter(llvm::StringRef CounterId, uint64_t CValue = 1);
+  void incCounter(CounterHandle Counter, uint64_t CValue = 1) {
+    addToCounter(Counter, CValue);
+  }
 
   /// \brief Decreases the count for the given counter - associated macro:
   /// DEC_COUNTER(COUNTER_ID, VALUE, SEV_LVL).
   /// \param CounterId Unique counter id.
   /// \param CValue to be subtracted from the current counter.
-  void decCounter(llvm::StringRef CounterId, unsigned CValue = 1);
+  void decCounter(llvm::StringRef CounterId, uint64_t CValue = 1);
+  void decCounter(CounterHandle Counter, uint64_t CValue = 1) {
+    // Counters wrap around, so adding the two's complement subtracts
+    addToCounter(Counter, -CValue);
+  }
 
   /// The associated macro does not check PAMM's severity level explicitly.
-  /// \brief Returns the current count for the given counter - associated macro:
-  /// GET_COUNTER(COUNTER_ID).
+  /// \brief Returns the current count for the given counter, summed up over all
+  /// threads - associated macro: GET_COUNTER(COUNTER_ID).
   /// \param CounterId Unique counter id.
-  std::optional<unsigned> getCounter(llvm::StringRef CounterId);
+  std::optional<uint64_t> getCounter(llvm::StringRef CounterId);
+  std::optional<uint64_t> getCounter(CounterHandle Counter);
 
   /// The associated macro does not check PAMM's severity level explicitly.
   /// \brief Sums the counts for the given counter ids - associated macro:
@@ -195,14 +270,74 @@ public:
       const std::vector<std::string> *Modules = nullptr,
       const std::vector<std::string> *DataFlowAnalyses = nullptr);
 
+  /// \note Not synchronized with concurrent calls to addToHistogram()
   [[nodiscard]] const auto &getHistogram() const noexcept { return Histogram; }
 
 private:
-  llvm::StringMap<TimePoint_t> RunningTimer;
-  llvm::StringMap<std::pair<TimePoint_t, TimePoint_t>> StoppedTimer;
+  /// The counter values that one thread has accumulated. Only the owning
+  /// thread writes to them; other threads only read them while holding Mtx.
+  struct ThreadCounters {
+    std::unique_ptr<std::atomic<uint64_t>[]> Values;
+    uint32_t Capacity = 0;
+  };
+
+  struct ThreadTimers {
+    llvm::StringMap<TimePoint_t> RunningTimer;
+    llvm::StringMap<std::pair<TimePoint_t, TimePoint_t>> StoppedTimer;
+  };
+
+  void addToCounter(CounterHandle Counter, uint64_t CValue) {
+    auto &Local = getThreadCounters();
+    if (LLVM_UNLIKELY(Counter.Index >= Local.Capacity)) {
+      growThreadCounters(Local, Counter.Index + 1);
+    }
+    auto &Slot = Local.Values[Counter.Index];
+    // No other thread writes to Slot, so there is no need for an (expensive)
+    // atomic read-modify-write
+    Slot.store(Slot.load(std::memory_order_relaxed) + CValue,
+               std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] ThreadCounters &getThreadCounters() {
+    struct CacheEntry {
+      uint64_t Instance = 0;
+      ThreadCounters *Counters = nullptr;
+    };
+    static thread_local CacheEntry Cache;
+    if (LLVM_UNLIKELY(Cache.Instance != InstanceId)) {
+      Cache = {InstanceId, &getThreadCountersSlow()};
+    }
+    return *Cache.Counters;
+  }
+
+  [[nodiscard]] ThreadCounters &getThreadCountersSlow();
+  void growThreadCounters(ThreadCounters &Local, uint32_t MinCapacity);
+
+  [[nodiscard]] std::optional<uint64_t> getCounterImpl(uint32_t Index) const;
+  [[nodiscard]] std::optional<uint64_t>
+  getCounterImpl(llvm::StringRef CounterId) const;
+  void regCounterImpl(uint32_t Index, uint64_t InitialValue);
+  void stopTimerImpl(ThreadTimers &Timers, llvm::StringRef TimerId,
+                     bool PauseTimer);
+  void stopAllTimersImpl();
+  [[nodiscard]] std::optional<std::pair<TimePoint_t, TimePoint_t>>
+  getStoppedTimerImpl(llvm::StringRef TimerId) const;
+  [[nodiscard]] std::map<std::string, uint64_t> elapsedTimeOfSingleTimer() const;
+  [[nodiscard]] std::map<std::string, uint64_t> getRegisteredCounters() const;
+  void printTimersImpl(llvm::raw_ostream &OS);
+  void printCountersImpl(llvm::raw_ostream &OS) const;
+  void printHistogramsImpl(llvm::raw_ostream &OS) const;
+
+  /// Distinguishes the thread-local counter caches of different PAMM objects
+  const uint64_t InstanceId;
+
+  mutable std::mutex Mtx;
+  std::map<std::thread::id, ThreadTimers> Timers;
   llvm::StringMap<std::vector<std::pair<TimePoint_t, TimePoint_t>>>
       RepeatingTimer;
-  llvm::StringMap<unsigned> Counter;
+  std::map<std::thread::id, std::unique_ptr<ThreadCounters>> Counters;
+  llvm::BitVector RegisteredCounters;
+  std::vector<uint64_t> InitialCounterValues;
   llvm::StringMap<llvm::StringMap<uint64_t>> Histogram;
 };
 
@@ -64,18 +64,27 @@ static constexpr PAMM_SEVERITY_LEVEL PAMM_CURR_SEV_LEVEL =
   }
 #define PRINT_TIMER(TIMER_ID)                                                  \
   pamm.getPrintableDuration(pamm.elapsedTime(TIMER_ID))
+#define PAMM_CONCAT_IMPL(A, B) A##B
+#define PAMM_CONCAT(A, B) PAMM_CONCAT_IMPL(A, B)
+#define SCOPED_TIMER(TIMER_ID, SEV_LVL)                                        \
+  PAMM::ScopedTimer PAMM_CONCAT(PammScopedTimer, __LINE__)(                    \
+      pamm, TIMER_ID,                                                          \
+      PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::SEV_LVL)
 
 #define REG_COUNTER(COUNTER_ID, INIT_VALUE, SEV_LVL)                           \
   if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::SEV_LVL) {         \
     pamm.regCounter(COUNTER_ID, INIT_VALUE);                                   \
   }
+// COUNTER_ID must be a constant: Its handle is resolved only once per use
 #define INC_COUNTER(COUNTER_ID, VALUE, SEV_LVL)                                \
   if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::SEV_LVL) {         \
-    pamm.incCounter(COUNTER_ID, VALUE);                                        \
+    static const auto PammCounterHandle = PAMM::getCounterHandle(COUNTER_ID);  \
+    pamm.incCounter(PammCounterHandle, VALUE);                                 \
   }
 #define DEC_COUNTER(COUNTER_ID, VALUE, SEV_LVL)                                \
   if constexpr (PAMM_CURR_SEV_LEVEL >= PAMM_SEVERITY_LEVEL::SEV_LVL) {         \
-    pamm.decCounter(COUNTER_ID, VALUE);                                        \
+    static const auto PammCounterHandle = PAMM::getCounterHandle(COUNTER_ID);  \
+    pamm.decCounter(PammCounterHandle, VALUE);                                 \
   }
 #define GET_COUNTER(COUNTER_ID) pamm.getCounter(COUNTER_ID)
 #define GET_SUM_COUNT(...) pamm.getSumCount(__VA_ARGS__)
@@ -100,6 +109,7 @@ static constexpr PAMM_SEVERITY_LEVEL PAMM_CURR_SEV_LEVEL =
 #define RESET_TIMER(TIMER_ID, SEV_LVL)
 #define PAUSE_TIMER(TIMER_ID, SEV_LVL)
 #define STOP_TIMER(TIMER_ID, SEV_LVL)
+#define SCOPED_TIMER(TIMER_ID, SEV_LVL)
 #define REG_COUNTER(COUNTER_ID, INIT_VALUE, SEV_LVL)
 #define INC_COUNTER(COUNTER_ID, VALUE, SEV_LVL)
 #define DEC_COUNTER(COUNTER_ID, VALUE, SEV_LVL)
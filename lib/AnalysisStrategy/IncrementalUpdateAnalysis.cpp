@@ -0,0 +1,69 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include "phasar/AnalysisStrategy/IncrementalUpdateAnalysis.h"
+
+#include <algorithm>
+
+namespace psr {
+
+ModuleDiff ModuleDiff::compute(const ModuleFingerprint &Baseline,
+                               const ModuleFingerprint &Current) {
+  ModuleDiff Ret;
+  Ret.GlobalsChanged = Baseline.GlobalsHash != Current.GlobalsHash;
+
+  for (const auto &Entry : Current.FunctionHashes) {
+    auto It = Baseline.FunctionHashes.find(Entry.getKey());
+    if (It == Baseline.FunctionHashes.end()) {
+      Ret.Added.push_back(Entry.getKey().str());
+    } else if (It->second != Entry.second) {
+      Ret.Changed.push_back(Entry.getKey().str());
+    }
+  }
+
+  for (const auto &Entry : Baseline.FunctionHashes) {
+    if (!Current.FunctionHashes.count(Entry.getKey())) {
+      Ret.Removed.push_back(Entry.getKey().str());
+    }
+  }
+
+  // StringMap iteration order is unspecified
+  std::sort(Ret.Added.begin(), Ret.Added.end());
+  std::sort(Ret.Removed.begin(), Ret.Removed.end());
+  std::sort(Ret.Changed.begin(), Ret.Changed.end());
+  return Ret;
+}
+
+void ModuleDiff::print(llvm::raw_ostream &OS) const {
+  auto PrintFuns = [&OS](llvm::StringRef Title,
+                         const std::vector<std::string> &Funs) {
+    OS << Title << " functions: " << Funs.size() << '\n';
+    for (const auto &Fun : Funs) {
+      OS << "  " << Fun << '\n';
+    }
+  };
+
+  PrintFuns("Added", Added);
+  PrintFuns("Removed", Removed);
+  PrintFuns("Changed", Changed);
+  OS << "Globals changed: " << (GlobalsChanged ? "yes" : "no") << '\n';
+}
+
+IncrementalUpdateAnalysis::IncrementalUpdateAnalysis(
+    const ModuleFingerprint &Baseline, const ModuleFingerprint &Current)
+    : Diff(ModuleDiff::compute(Baseline, Current)) {
+  for (const auto &Entry : Current.FunctionHashes) {
+    auto It = Baseline.FunctionHashes.find(Entry.getKey());
+    if (It != Baseline.FunctionHashes.end() && It->second == Entry.second) {
+      Unchanged.insert(Entry.getKey());
+    }
+  }
+}
+
+} // namespace psr
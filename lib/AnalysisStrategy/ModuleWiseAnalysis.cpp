@@ -0,0 +1,199 @@
+/******************************************************************************
+ * Copyright (c) 2019 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Philipp Schubert and others
+ *****************************************************************************/
+
+#include "phasar/AnalysisStrategy/ModuleWiseAnalysis.h"
+
+#include "llvm/ADT/StringMap.h"
+
+#include <algorithm>
+
+namespace psr {
+
+ModuleWiseAnalysis::ModuleWiseAnalysis(std::vector<ModuleInterface> Modules)
+    : Modules(std::move(Modules)) {
+  computeDependencies();
+  computeStages();
+}
+
+void ModuleWiseAnalysis::computeDependencies() {
+  llvm::StringMap<llvm::SmallVector<uint32_t, 1>> Definers;
+  for (uint32_t Mod = 0, End = Modules.size(); Mod != End; ++Mod) {
+    for (const auto &Fun : Modules[Mod].Defines) {
+      Definers[Fun].push_back(Mod);
+    }
+  }
+
+  Deps.resize(Modules.size());
+  for (uint32_t Mod = 0, End = Modules.size(); Mod != End; ++Mod) {
+    auto &ModDeps = Deps[Mod];
+    for (const auto &Fun : Modules[Mod].Declares) {
+      auto It = Definers.find(Fun);
+      if (It == Definers.end()) {
+        // Defined outside of the analyzed program, e.g., in libc
+        continue;
+      }
+      for (auto Dep : It->second) {
+        if (Dep != Mod) {
+          ModDeps.push_back(Dep);
+        }
+      }
+    }
+    std::sort(ModDeps.begin(), ModDeps.end());
+    ModDeps.erase(std::unique(ModDeps.begin(), ModDeps.end()), ModDeps.end());
+  }
+}
+
+void ModuleWiseAnalysis::computeStages() {
+  // Tarjan's algorithm. It completes each SCC only after all SCCs that are
+  // reachable from it, so the dependencies of an SCC always get their stage
+  // first
+  static constexpr uint32_t Unvisited = UINT32_MAX;
+
+  const auto NumMods = uint32_t(Modules.size());
+  std::vector<uint32_t> Index(NumMods, Unvisited);
+  std::vector<uint32_t> LowLink(NumMods);
+  std::vector<bool> OnStack(NumMods);
+  std::vector<uint32_t> SCCStack;
+  std::vector<uint32_t> StageOf(NumMods);
+  Cyclic.assign(NumMods, false);
+
+  struct Frame {
+    uint32_t Mod;
+    uint32_t NextDep;
+  };
+  std::vector<Frame> CallStack;
+  uint32_t NextIndex = 0;
+
+  auto Visit = [&](uint32_t Mod) {
+    Index[Mod] = LowLink[Mod] = NextIndex++;
+    SCCStack.push_back(Mod);
+    OnStack[Mod] = true;
+    CallStack.push_back({Mod, 0});
+  };
+
+  auto CompleteSCC = [&](uint32_t Root) {
+    auto RootPos = std::find(SCCStack.rbegin(), SCCStack.rend(), Root);
+    auto Begin = std::prev(RootPos.base());
+    auto Members = llvm::makeArrayRef(SCCStack).drop_front(
+        std::distance(SCCStack.begin(), Begin));
+
+    size_t Stage = 0;
+    for (auto Mod : Members) {
+      OnStack[Mod] = false;
+    }
+    for (auto Mod : Members) {
+      for (auto Dep : Deps[Mod]) {
+        if (!llvm::is_contained(Members, Dep)) {
+          Stage = std::max(Stage, size_t(StageOf[Dep]) + 1);
+        }
+      }
+    }
+
+    if (Stage >= Stages.size()) {
+      Stages.resize(Stage + 1);
+    }
+    for (auto Mod : Members) {
+      StageOf[Mod] = Stage;
+      Cyclic[Mod] = Members.size() > 1;
+      Stages[Stage].push_back(Mod);
+    }
+
+    SCCStack.erase(Begin, SCCStack.end());
+  };
+
+  for (uint32_t Root = 0; Root != NumMods; ++Root) {
+    if (Index[Root] != Unvisited) {
+      continue;
+    }
+
+    Visit(Root);
+    while (!CallStack.empty()) {
+      auto &Curr = CallStack.back();
+      auto Mod = Curr.Mod;
+
+      if (Curr.NextDep != Deps[Mod].size()) {
+        auto Dep = Deps[Mod][Curr.NextDep++];
+        if (Index[Dep] == Unvisited) {
+          // Invalidates Curr
+          Visit(Dep);
+        } else if (OnStack[Dep]) {
+          LowLink[Mod] = std::min(LowLink[Mod], Index[Dep]);
+        }
+        continue;
+      }
+
+      if (LowLink[Mod] == Index[Mod]) {
+        CompleteSCC(Mod);
+      }
+
+      CallStack.pop_back();
+      if (!CallStack.empty()) {
+        auto Parent = CallStack.back().Mod;
+        LowLink[Parent] = std::min(LowLink[Parent], LowLink[Mod]);
+      }
+    }
+  }
+
+  for (auto &Stage : Stages) {
+    std::sort(Stage.begin(), Stage.end());
+  }
+}
+
+std::vector<uint32_t>
+ModuleWiseAnalysis::getTransitiveDependencies(size_t Mod) const {
+  std::vector<uint32_t> Ret;
+  std::vector<bool> Seen(Modules.size());
+  Seen[Mod] = true;
+
+  auto Push = [&](uint32_t Dep) {
+    if (!Seen[Dep]) {
+      Seen[Dep] = true;
+      Ret.push_back(Dep);
+    }
+  };
+
+  for (auto Dep : Deps[Mod]) {
+    Push(Dep);
+  }
+  // Ret grows while we iterate over it
+  for (size_t I = 0; I != Ret.size(); ++I) {
+    for (auto Dep : Deps[Ret[I]]) {
+      Push(Dep);
+    }
+  }
+
+  std::sort(Ret.begin(), Ret.end());
+  return Ret;
+}
+
+void ModuleWiseAnalysis::print(llvm::raw_ostream &OS) const {
+  for (size_t Stage = 0, End = Stages.size(); Stage != End; ++Stage) {
+    OS << "Stage " << Stage << ":\n";
+    for (auto Mod : Stages[Stage]) {
+      OS << "  " << Modules[Mod].Name;
+      if (Cyclic[Mod]) {
+        OS << " (cyclic)";
+      }
+      if (!Deps[Mod].empty()) {
+        OS << " <- ";
+        bool First = true;
+        for (auto Dep : Deps[Mod]) {
+          if (!First) {
+            OS << ", ";
+          }
+          First = false;
+          OS << Modules[Dep].Name;
+        }
+      }
+      OS << '\n';
+    }
+  }
+}
+
+} // namespace psr
@@ -11,101 +11,365 @@
 
 #include "phasar/DB/Queries.h"
 
-#include "boost/format.hpp"
 #include "sqlite3.h"
 
+#include <cassert>
+#include <utility>
+
 namespace psr {
 
+static llvm::StringRef getColumnText(sqlite3_stmt *Stmt, int Col) noexcept {
+  if (!Stmt) {
+    return {};
+  }
+  const auto *Text =
+      reinterpret_cast<const char *>(sqlite3_column_text(Stmt, Col));
+  return {Text, size_t(sqlite3_column_bytes(Stmt, Col))};
+}
+
+//===----------------------------------------------------------------------===//
+// HSCursor
+
+HSCursor::HSCursor(HSCursor &&Other) noexcept
+    : HS(std::exchange(Other.HS, nullptr)), StmtIdx(Other.StmtIdx),
+      Stmt(std::exchange(Other.Stmt, nullptr)) {}
+
+HSCursor &HSCursor::operator=(HSCursor &&Other) noexcept {
+  if (this != &Other) {
+    release();
+    HS = std::exchange(Other.HS, nullptr);
+    StmtIdx = Other.StmtIdx;
+    Stmt = std::exchange(Other.Stmt, nullptr);
+  }
+  return *this;
+}
+
+HSCursor::~HSCursor() { release(); }
+
+void HSCursor::release() noexcept {
+  if (Stmt) {
+    HS->releaseStmt(StmtIdx, Stmt);
+    Stmt = nullptr;
+  }
+}
+
+bool HSCursor::next() {
+  if (!Stmt) {
+    return false;
+  }
+
+  auto Ret = sqlite3_step(Stmt);
+  if (Ret == SQLITE_ROW) {
+    return true;
+  }
+  if (Ret != SQLITE_DONE) {
+    HS->reportError("query");
+  }
+  release();
+  return false;
+}
+
+llvm::StringRef HSCursor::subject() const noexcept {
+  return getColumnText(Stmt, 0);
+}
+llvm::StringRef HSCursor::predicate() const noexcept {
+  return getColumnText(Stmt, 1);
+}
+llvm::StringRef HSCursor::object() const noexcept {
+  return getColumnText(Stmt, 2);
+}
+
+//===----------------------------------------------------------------------===//
+// Hexastore
+
+static int markAsFound(void *Found, int /*Argc*/, char ** /*Argv*/,
+                       char ** /*ColNames*/) {
+  *static_cast<bool *>(Found) = true;
+  return 0;
+}
+
 Hexastore::Hexastore(const std::string &Filename) {
-  sqlite3_open(Filename.c_str(), &HSInternalDB);
-  const std::string &Query = INIT;
-  char *Err;
-  sqlite3_exec(HSInternalDB, Query.c_str(), callback, nullptr, &Err);
+  if (sqlite3_open(Filename.c_str(), &HSInternalDB) != SQLITE_OK) {
+    reportError("open");
+    sqlite3_close(HSInternalDB);
+    HSInternalDB = nullptr;
+    return;
+  }
+
+  bool IsLegacy = false;
+  char *Err = nullptr;
+  sqlite3_exec(HSInternalDB, DetectLegacySchema.c_str(), markAsFound,
+               &IsLegacy, &Err);
+  if (IsLegacy) {
+    llvm::errs() << "Hexastore " << Filename
+                 << " was created by an old version of PhASAR and is not "
+                    "compatible with the current layout. Please delete it "
+                    "and rebuild it.\n";
+    sqlite3_close(HSInternalDB);
+    HSInternalDB = nullptr;
+    return;
+  }
+
+  if (Err == nullptr) {
+    sqlite3_exec(HSInternalDB, INIT.c_str(), nullptr, nullptr, &Err);
+  }
   if (Err != nullptr) {
-    llvm::outs() << Err << "\n\n";
+    llvm::errs() << Err << "\n\n";
+    sqlite3_free(Err);
+  }
+}
+
+Hexastore::~Hexastore() {
+  if (InTransaction) {
+    commitTransaction();
   }
+  for (auto *Stmt : Stmts) {
+    sqlite3_finalize(Stmt);
+  }
+  sqlite3_close(HSInternalDB);
 }
 
-Hexastore::~Hexastore() { sqlite3_close(HSInternalDB); }
+const std::string &Hexastore::getStmtQuery(size_t Kind) {
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+  static const std::string *const SearchQueries[] = {
+      &SearchXXX, &SearchXXO, &SearchXPX, &SearchXPO,
+      &SearchSXX, &SearchSXO, &SearchSPX, &SearchSPO,
+  };
 
-int Hexastore::callback(void * /*NotUsed*/, int Argc, char **Argv,
-                        char **AzColName) {
-  for (int Idx = 0; Idx < Argc; ++Idx) {
-    llvm::outs() << AzColName[Idx] << " " << (Argv[Idx] ? Argv[Idx] : "NULL")
-                 << '\n';
+  switch (Kind) {
+  case BeginStmt:
+    return BeginTransaction;
+  case CommitStmt:
+    return CommitTransaction;
+  case RollbackStmt:
+    return RollbackTransaction;
+  case LookupTermStmt:
+    return LookupTerm;
+  case InsertTermStmt:
+    return InsertTerm;
+  case InsertTripleStmt:
+    return InsertTriple;
+  default:
+    assert(Kind >= SearchStmtBase && Kind < NumStmts);
+    return *SearchQueries[Kind - SearchStmtBase];
   }
-  return 0;
 }
 
-void Hexastore::put(const std::array<std::string, 3> &Edge) {
-  doPut(SPOInsert, Edge);
-  doPut(SOPInsert, Edge);
-  doPut(PSOInsert, Edge);
-  doPut(POSInsert, Edge);
-  doPut(OSPInsert, Edge);
-  doPut(OPSInsert, Edge);
+void Hexastore::reportError(llvm::StringRef Context) const {
+  llvm::errs() << "Hexastore " << Context
+               << " failed: " << sqlite3_errmsg(HSInternalDB) << '\n';
 }
 
-void Hexastore::doPut(const std::string &Query,
-                      std::array<std::string, 3> Edge) {
-  std::string CompiledQuery =
-      str(boost::format(Query) % Edge[0] % Edge[1] % Edge[2]);
-  char *Err;
-  sqlite3_exec(HSInternalDB, CompiledQuery.c_str(), callback, nullptr, &Err);
-  if (Err != nullptr) {
-    llvm::outs() << Err;
+sqlite3_stmt *Hexastore::acquireStmt(size_t Kind) {
+  if (auto *Stmt = std::exchange(Stmts[Kind], nullptr)) {
+    return Stmt;
+  }
+  if (!HSInternalDB) {
+    return nullptr;
+  }
+
+  const auto &Query = getStmtQuery(Kind);
+  sqlite3_stmt *Stmt = nullptr;
+  if (sqlite3_prepare_v3(HSInternalDB, Query.c_str(), int(Query.size() + 1),
+                         SQLITE_PREPARE_PERSISTENT, &Stmt,
+                         nullptr) != SQLITE_OK) {
+    reportError("prepare");
+    sqlite3_finalize(Stmt);
+    return nullptr;
+  }
+  return Stmt;
+}
+
+void Hexastore::releaseStmt(size_t Kind, sqlite3_stmt *Stmt) noexcept {
+  sqlite3_reset(Stmt);
+  sqlite3_clear_bindings(Stmt);
+  if (!Stmts[Kind]) {
+    Stmts[Kind] = Stmt;
+  } else {
+    // Another user of the same kind of statement was faster
+    sqlite3_finalize(Stmt);
+  }
+}
+
+bool Hexastore::execute(size_t Kind) {
+  auto *Stmt = acquireStmt(Kind);
+  if (!Stmt) {
+    return false;
+  }
+  auto Ret = sqlite3_step(Stmt);
+  releaseStmt(Kind, Stmt);
+  if (Ret != SQLITE_DONE) {
+    reportError("statement");
+    return false;
+  }
+  return true;
+}
+
+void Hexastore::beginTransaction() {
+  assert(!InTransaction && "Transactions do not nest");
+  InTransaction = execute(BeginStmt);
+}
+
+bool Hexastore::commitTransaction() {
+  assert(InTransaction && "No transaction to commit");
+  InTransaction = false;
+  if (execute(CommitStmt)) {
+    return true;
   }
+
+  // A failed commit may leave the transaction open, e.g., if the database is
+  // locked by a reader
+  if (!sqlite3_get_autocommit(HSInternalDB)) {
+    execute(RollbackStmt);
+  }
+  // The cache may refer to terms that have been interned within the
+  // transaction
+  TermIds.clear();
+  return false;
+}
+
+void Hexastore::cacheTermId(llvm::StringRef Term, int64_t Id) {
+  if (TermIds.size() >= MaxCachedTerms) {
+    TermIds.clear();
+  }
+  TermIds.try_emplace(Term, Id);
+}
+
+std::optional<int64_t> Hexastore::lookupTerm(llvm::StringRef Term) {
+  if (auto It = TermIds.find(Term); It != TermIds.end()) {
+    return It->second;
+  }
+
+  auto *Stmt = acquireStmt(LookupTermStmt);
+  if (!Stmt) {
+    return std::nullopt;
+  }
+
+  std::optional<int64_t> Ret;
+  sqlite3_bind_text(Stmt, 1, Term.data(), int(Term.size()), SQLITE_STATIC);
+  if (sqlite3_step(Stmt) == SQLITE_ROW) {
+    Ret = sqlite3_column_int64(Stmt, 0);
+    cacheTermId(Term, *Ret);
+  }
+  releaseStmt(LookupTermStmt, Stmt);
+  return Ret;
+}
+
+std::optional<int64_t> Hexastore::internTerm(llvm::StringRef Term) {
+  if (auto Id = lookupTerm(Term)) {
+    return Id;
+  }
+
+  auto *Stmt = acquireStmt(InsertTermStmt);
+  if (!Stmt) {
+    return std::nullopt;
+  }
+
+  std::optional<int64_t> Ret;
+  sqlite3_bind_text(Stmt, 1, Term.data(), int(Term.size()), SQLITE_STATIC);
+  if (sqlite3_step(Stmt) == SQLITE_DONE) {
+    Ret = sqlite3_last_insert_rowid(HSInternalDB);
+    cacheTermId(Term, *Ret);
+  } else {
+    reportError("intern");
+  }
+  releaseStmt(InsertTermStmt, Stmt);
+  return Ret;
+}
+
+void Hexastore::doPut(llvm::StringRef Subject, llvm::StringRef Predicate,
+                      llvm::StringRef Object) {
+  auto SId = internTerm(Subject);
+  auto PId = internTerm(Predicate);
+  auto OId = internTerm(Object);
+  if (!SId || !PId || !OId) {
+    return;
+  }
+
+  auto *Stmt = acquireStmt(InsertTripleStmt);
+  if (!Stmt) {
+    return;
+  }
+  sqlite3_bind_int64(Stmt, 1, *SId);
+  sqlite3_bind_int64(Stmt, 2, *PId);
+  sqlite3_bind_int64(Stmt, 3, *OId);
+  if (sqlite3_step(Stmt) != SQLITE_DONE) {
+    reportError("put");
+  }
+  releaseStmt(InsertTripleStmt, Stmt);
+}
+
+void Hexastore::put(llvm::StringRef Subject, llvm::StringRef Predicate,
+                    llvm::StringRef Object) {
+  if (InTransaction) {
+    doPut(Subject, Predicate, Object);
+    return;
+  }
+
+  // Commit the interned terms together with the triple
+  beginTransaction();
+  doPut(Subject, Predicate, Object);
+  if (InTransaction) {
+    commitTransaction();
+  }
+}
+
+bool Hexastore::putAll(llvm::ArrayRef<std::array<std::string, 3>> Edges) {
+  bool OwnsTransaction = !InTransaction;
+  if (OwnsTransaction) {
+    beginTransaction();
+    if (!InTransaction) {
+      return false;
+    }
+  }
+
+  for (const auto &Edge : Edges) {
+    doPut(Edge[0], Edge[1], Edge[2]);
+  }
+
+  return !OwnsTransaction || commitTransaction();
+}
+
+HSCursor Hexastore::query(const std::array<std::string, 3> &EdgeQuery) {
+  // The bits of the fixed elements; see StmtKind
+  size_t FixedBits = 0;
+  std::array<int64_t, 3> Ids{};
+  for (size_t Idx = 0; Idx < 3; ++Idx) {
+    if (EdgeQuery[Idx] == "?") {
+      continue;
+    }
+
+    auto Id = lookupTerm(EdgeQuery[Idx]);
+    if (!Id) {
+      // An unknown term cannot match anything
+      return {};
+    }
+    Ids[Idx] = *Id;
+    FixedBits |= size_t(4) >> Idx;
+  }
+
+  auto Kind = SearchStmtBase + FixedBits;
+  auto *Stmt = acquireStmt(Kind);
+  if (!Stmt) {
+    return {};
+  }
+  for (size_t Idx = 0; Idx < 3; ++Idx) {
+    if (EdgeQuery[Idx] != "?") {
+      sqlite3_bind_int64(Stmt, int(Idx + 1), Ids[Idx]);
+    }
+  }
+  return {this, Kind, Stmt};
 }
 
 std::vector<HSResult> Hexastore::get(std::array<std::string, 3> EdgeQuery,
                                      size_t ResultSizeHint) {
   std::vector<HSResult> Result;
   Result.reserve(ResultSizeHint);
-  std::string QueryString;
-  if (EdgeQuery[0] == "?") {
-    if (EdgeQuery[1] == "?") {
-      if (EdgeQuery[2] == "?") {
-        QueryString = SearchXXX;
-      } else {
-        QueryString = SearchXXO;
-      }
-    } else {
-      if (EdgeQuery[2] == "?") {
-        QueryString = SearchXPX;
-      } else {
-        QueryString = SearchXPO;
-      }
-    }
-  } else {
-    if (EdgeQuery[1] == "?") {
-      if (EdgeQuery[2] == "?") {
-        QueryString = SearchSXX;
-      } else {
-        QueryString = SearchSXO;
-      }
-    } else {
-      if (EdgeQuery[2] == "?") {
-        QueryString = SearchSPX;
-      } else {
-        QueryString = SearchSPO;
-      }
-    }
-  }
-  std::string CompiledQuery = str(boost::format(QueryString) % EdgeQuery[0] %
-                                  EdgeQuery[1] % EdgeQuery[2]);
-  // this lambda will collect all of our results, since it is called on every
-  // row of the result set
-  auto SqliteCBResultCollector = [](void *CB, int /*Argc*/, char **Argv,
-                                    char ** /*AzColName*/) {
-    auto *Res = static_cast<std::vector<HSResult> *>(CB);
-    Res->emplace_back(Argv[0], Argv[1], Argv[2]);
-    return 0;
-  };
-  char *Err;
-  sqlite3_exec(HSInternalDB, CompiledQuery.c_str(), SqliteCBResultCollector,
-               &Result, &Err);
-  if (Err != nullptr) {
-    llvm::outs() << Err;
+
+  auto Cursor = query(EdgeQuery);
+  while (Cursor.next()) {
+    Result.emplace_back(Cursor.subject().str(), Cursor.predicate().str(),
+                        Cursor.object().str());
   }
   return Result;
 }
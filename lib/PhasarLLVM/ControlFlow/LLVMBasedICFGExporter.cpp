@@ -0,0 +1,344 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFGExporter.h"
+
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/Utils/LLVMIRToSrc.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
+#include "phasar/Utils/Utilities.h"
+
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/Support/EndianStream.h"
+#include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/JSON.h"
+
+#include <cassert>
+#include <limits>
+
+using namespace psr;
+
+static constexpr llvm::StringLiteral ICFGBinaryMagic = "PSRICFG\1";
+static constexpr size_t ICFGBinaryRecordSize = 2 * sizeof(uint32_t) + 1;
+
+llvm::StringRef psr::to_string(ICFGEdgeKind Kind) noexcept {
+  switch (Kind) {
+  case ICFGEdgeKind::Intra:
+    return "intra";
+  case ICFGEdgeKind::Call:
+    return "call";
+  case ICFGEdgeKind::Return:
+    return "return";
+  case ICFGEdgeKind::CallToReturn:
+    return "call-to-return";
+  }
+  llvm_unreachable("All ICFGEdgeKinds should be handled in the switch above");
+}
+
+/// Collects the functions to export in the order of the ICFG's vertex
+/// functions
+static std::vector<const llvm::Function *>
+getFunctionsToExport(const LLVMBasedICFG &ICF,
+                     llvm::ArrayRef<const llvm::Function *> ReachableFrom) {
+  std::vector<const llvm::Function *> Ret;
+  if (ReachableFrom.empty()) {
+    Ret.reserve(ICF.getNumVertexFunctions());
+    for (const auto *Fun : ICF.getAllVertexFunctions()) {
+      Ret.push_back(Fun);
+    }
+    return Ret;
+  }
+
+  llvm::DenseSet<const llvm::Function *> Reachable;
+  llvm::SmallVector<const llvm::Function *> WorkList;
+  for (const auto *Fun : ReachableFrom) {
+    if (Reachable.insert(Fun).second) {
+      WorkList.push_back(Fun);
+    }
+  }
+
+  while (!WorkList.empty()) {
+    const auto *Fun = WorkList.pop_back_val();
+    for (const auto *CS : ICF.getCallsFromWithin(Fun)) {
+      for (const auto *Callee : ICF.getCalleesOfCallAt(CS)) {
+        if (Reachable.insert(Callee).second) {
+          WorkList.push_back(Callee);
+        }
+      }
+    }
+  }
+
+  Ret.reserve(Reachable.size());
+  for (const auto *Fun : ICF.getAllVertexFunctions()) {
+    if (Reachable.count(Fun)) {
+      Ret.push_back(Fun);
+    }
+  }
+  return Ret;
+}
+
+namespace {
+
+/// Enumerates the nodes and edges of the ICFG in the same way as
+/// LLVMBasedICFG::exportICFGAsDot(): Calls to functions with a body are
+/// split into a call- and return edges; Calls to declarations or unresolved
+/// calls get a call-to-return edge.
+template <typename NodeHandler, typename EdgeHandler>
+void forEachNodeAndEdge(const LLVMBasedICFG &ICF, const llvm::Function *Fun,
+                        NodeHandler OnNode, EdgeHandler OnEdge) {
+  auto IgnoreDbgInstructions = ICF.getIgnoreDbgInstructions();
+
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  auto createInterEdges = [&ICF, &OnEdge, IgnoreDbgInstructions](
+                              const llvm::Instruction *CS,
+                              const llvm::Instruction *To,
+                              llvm::StringRef Label) {
+    bool NeedCTREdge = false;
+    const auto &Callees = ICF.getCalleesOfCallAt(CS);
+    for (const auto *Callee : Callees) {
+      if (Callee->isDeclaration()) {
+        NeedCTREdge = true;
+        continue;
+      }
+
+      const auto *InterTo = &Callee->front().front();
+      if (IgnoreDbgInstructions && llvm::isa<llvm::DbgInfoIntrinsic>(InterTo)) {
+        InterTo = InterTo->getNextNonDebugInstruction(false);
+      }
+      OnEdge(CS, InterTo, ICFGEdgeKind::Call, "");
+
+      for (const auto *ExitInst : getAllExitPoints(Callee)) {
+        OnEdge(ExitInst, To, ICFGEdgeKind::Return, Label);
+      }
+    }
+
+    if (NeedCTREdge || Callees.empty()) {
+      OnEdge(CS, To, ICFGEdgeKind::CallToReturn, Label);
+    }
+  };
+
+  for (const auto &Inst : llvm::instructions(Fun)) {
+    if (IgnoreDbgInstructions && llvm::isa<llvm::DbgInfoIntrinsic>(Inst)) {
+      continue;
+    }
+
+    OnNode(&Inst);
+  }
+
+  for (const auto &Inst : llvm::instructions(Fun)) {
+    if (IgnoreDbgInstructions && llvm::isa<llvm::DbgInfoIntrinsic>(Inst)) {
+      continue;
+    }
+    if (llvm::isa<llvm::UnreachableInst>(Inst)) {
+      continue;
+    }
+
+    auto Successors = ICF.getSuccsOf(&Inst);
+    if (Successors.size() == 2) {
+      if (llvm::isa<llvm::InvokeInst>(Inst)) {
+        createInterEdges(&Inst, Successors[0], "normal");
+        createInterEdges(&Inst, Successors[1], "unwind");
+      } else {
+        OnEdge(&Inst, Successors[0], ICFGEdgeKind::Intra, "true");
+        OnEdge(&Inst, Successors[1], ICFGEdgeKind::Intra, "false");
+      }
+      continue;
+    }
+
+    for (const auto *Successor : Successors) {
+      if (llvm::isa<llvm::CallBase>(Inst)) {
+        createInterEdges(&Inst, Successor, "");
+      } else {
+        OnEdge(&Inst, Successor, ICFGEdgeKind::Intra, "");
+      }
+    }
+  }
+}
+
+void writeDotLabel(llvm::raw_ostream &OS, const llvm::Instruction *Inst,
+                   bool WithSourceCodeInfo) {
+  if (!WithSourceCodeInfo) {
+    OS.write_escaped(llvmIRToStableString(Inst));
+    return;
+  }
+
+  auto SCI = getSrcCodeInfoFromIR(Inst);
+  OS << "File: ";
+  OS.write_escaped(SCI.SourceCodeFilename);
+  OS << "\nFunction: ";
+  OS.write_escaped(SCI.SourceCodeFunctionName);
+  OS << "\nIR: ";
+  OS.write_escaped(llvmIRToStableString(Inst));
+
+  if (SCI.Line) {
+    OS << "\nLine: " << SCI.Line << "\nColumn: " << SCI.Column;
+  }
+}
+
+void exportAsDot(const LLVMBasedICFG &ICF, llvm::raw_ostream &OS,
+                 llvm::ArrayRef<const llvm::Function *> Funs,
+                 bool WithSourceCodeInfo) {
+  const auto *IRDB = ICF.getIRDB();
+
+  OS << "digraph ICFG{\n";
+  for (const auto *Fun : Funs) {
+    forEachNodeAndEdge(
+        ICF, Fun,
+        [&](const llvm::Instruction *Inst) {
+          OS << IRDB->getInstructionId(Inst) << "[label=\"";
+          writeDotLabel(OS, Inst, WithSourceCodeInfo);
+          OS << "\"];\n";
+        },
+        [&](const llvm::Instruction *From, const llvm::Instruction *To,
+            ICFGEdgeKind /*Kind*/, llvm::StringRef Label) {
+          OS << IRDB->getInstructionId(From) << "->"
+             << IRDB->getInstructionId(To);
+          if (!Label.empty()) {
+            OS << "[label=\"" << Label << "\"]";
+          }
+          OS << ";\n";
+        });
+  }
+  OS << "}\n";
+}
+
+void exportAsJsonl(const LLVMBasedICFG &ICF, llvm::raw_ostream &OS,
+                   llvm::ArrayRef<const llvm::Function *> Funs,
+                   bool WithSourceCodeInfo) {
+  const auto *IRDB = ICF.getIRDB();
+
+  for (const auto *Fun : Funs) {
+    forEachNodeAndEdge(
+        ICF, Fun,
+        [&](const llvm::Instruction *Inst) {
+          llvm::json::OStream JOS(OS);
+          JOS.object([&] {
+            JOS.attribute("kind", "node");
+            JOS.attribute("id", int64_t(IRDB->getInstructionId(Inst)));
+            JOS.attribute("function", Fun->getName());
+            JOS.attribute("ir", llvmIRToStableString(Inst));
+            if (WithSourceCodeInfo) {
+              auto SCI = getSrcCodeInfoFromIR(Inst);
+              JOS.attribute("file", SCI.SourceCodeFilename);
+              JOS.attribute("line", int64_t(SCI.Line));
+              JOS.attribute("column", int64_t(SCI.Column));
+              JOS.attribute("src", SCI.SourceCodeLine);
+            }
+          });
+          OS << '\n';
+        },
+        [&](const llvm::Instruction *From, const llvm::Instruction *To,
+            ICFGEdgeKind Kind, llvm::StringRef Label) {
+          llvm::json::OStream JOS(OS);
+          JOS.object([&] {
+            JOS.attribute("kind", "edge");
+            JOS.attribute("from", int64_t(IRDB->getInstructionId(From)));
+            JOS.attribute("to", int64_t(IRDB->getInstructionId(To)));
+            JOS.attribute("type", to_string(Kind));
+            if (!Label.empty()) {
+              JOS.attribute("label", Label);
+            }
+          });
+          OS << '\n';
+        });
+  }
+}
+
+void exportAsBinary(const LLVMBasedICFG &ICF, llvm::raw_ostream &OS,
+                    llvm::ArrayRef<const llvm::Function *> Funs) {
+  const auto *IRDB = ICF.getIRDB();
+  assert(IRDB->getNumInstructions() < std::numeric_limits<uint32_t>::max() &&
+         "The instruction ids must fit into 32 bits");
+
+  OS << ICFGBinaryMagic;
+  llvm::support::endian::Writer Writer(OS, llvm::support::little);
+  for (const auto *Fun : Funs) {
+    forEachNodeAndEdge(
+        ICF, Fun, [](const llvm::Instruction * /*Inst*/) {},
+        [&](const llvm::Instruction *From, const llvm::Instruction *To,
+            ICFGEdgeKind Kind, llvm::StringRef /*Label*/) {
+          Writer.write(uint32_t(IRDB->getInstructionId(From)));
+          Writer.write(uint32_t(IRDB->getInstructionId(To)));
+          Writer.write(uint8_t(Kind));
+        });
+  }
+}
+
+} // namespace
+
+void psr::exportICFG(const LLVMBasedICFG &ICF, llvm::raw_ostream &OS,
+                     const ICFGExportOptions &Opts) {
+  auto Funs = getFunctionsToExport(ICF, Opts.ReachableFrom);
+
+  switch (Opts.Format) {
+  case ICFGExportFormat::Jsonl:
+    exportAsJsonl(ICF, OS, Funs, Opts.WithSourceCodeInfo);
+    return;
+  case ICFGExportFormat::Dot:
+    exportAsDot(ICF, OS, Funs, Opts.WithSourceCodeInfo);
+    return;
+  case ICFGExportFormat::Binary:
+    exportAsBinary(ICF, OS, Funs);
+    return;
+  }
+  llvm_unreachable("All ICFGExportFormats should be handled in the switch");
+}
+
+void psr::exportCallGraphAsJsonl(
+    const LLVMBasedICFG &ICF, llvm::raw_ostream &OS,
+    llvm::ArrayRef<const llvm::Function *> ReachableFrom) {
+  const auto *IRDB = ICF.getIRDB();
+
+  for (const auto *Fun : getFunctionsToExport(ICF, ReachableFrom)) {
+    for (const auto *CS : ICF.getCallsFromWithin(Fun)) {
+      llvm::json::OStream JOS(OS);
+      JOS.object([&] {
+        JOS.attribute("caller", Fun->getName());
+        JOS.attribute("cs", int64_t(IRDB->getInstructionId(CS)));
+        JOS.attributeArray("callees", [&] {
+          for (const auto *Callee : ICF.getCalleesOfCallAt(CS)) {
+            JOS.value(Callee->getName());
+          }
+        });
+      });
+      OS << '\n';
+    }
+  }
+}
+
+std::optional<std::vector<ICFGBinaryEdge>>
+psr::readICFGBinaryEdgeList(llvm::StringRef Data) {
+  if (!Data.consume_front(ICFGBinaryMagic) ||
+      Data.size() % ICFGBinaryRecordSize != 0) {
+    return std::nullopt;
+  }
+
+  std::vector<ICFGBinaryEdge> Ret;
+  Ret.reserve(Data.size() / ICFGBinaryRecordSize);
+
+  const auto *Ptr = Data.bytes_begin();
+  const auto *End = Data.bytes_end();
+  while (Ptr != End) {
+    auto From = llvm::support::endian::read32le(Ptr);
+    auto To = llvm::support::endian::read32le(Ptr + sizeof(uint32_t));
+    auto Kind = Ptr[2 * sizeof(uint32_t)];
+    if (Kind > uint8_t(ICFGEdgeKind::CallToReturn)) {
+      return std::nullopt;
+    }
+
+    Ret.push_back({From, To, ICFGEdgeKind(Kind)});
+    Ptr += ICFGBinaryRecordSize;
+  }
+
+  return Ret;
+}
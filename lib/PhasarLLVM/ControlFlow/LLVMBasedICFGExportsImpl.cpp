@@ -9,6 +9,7 @@
 
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedCFG.h"
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFGExporter.h"
 #include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
 #include "phasar/PhasarLLVM/Utils/LLVMIRToSrc.h"
 #include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
@@ -31,108 +32,10 @@ LLVMBasedICFG::exportICFGAsDot(bool WithSourceCodeInfo) const {
   Ret.reserve(IRDB->getNumInstructions() * ApproxNumCharsPerInst);
   llvm::raw_string_ostream OS(Ret);
 
-  OS << "digraph ICFG{\n";
-  scope_exit CloseBrace = [&OS]() { OS << "}\n"; };
-
-  // NOLINTNEXTLINE(readability-identifier-naming)
-  auto writeSCI = [WithSourceCodeInfo](llvm::raw_ostream &OS,
-                                       const llvm::Instruction *Inst) {
-    if (WithSourceCodeInfo) {
-      auto SCI = getSrcCodeInfoFromIR(Inst);
-
-      OS << "File: ";
-      OS.write_escaped(SCI.SourceCodeFilename);
-      OS << "\nFunction: ";
-      OS.write_escaped(SCI.SourceCodeFunctionName);
-      OS << "\nIR: ";
-      OS.write_escaped(llvmIRToStableString(Inst));
-
-      if (SCI.Line) {
-        OS << "\nLine: " << SCI.Line << "\nColumn: " << SCI.Column;
-      }
-    } else {
-      OS.write_escaped(llvmIRToStableString(Inst));
-    }
-  };
-
-  auto IgnoreDbgInstructions = this->IgnoreDbgInstructions;
-
-  // NOLINTNEXTLINE(readability-identifier-naming)
-  auto createInterEdges = [&OS, this, IgnoreDbgInstructions](
-                              const llvm::Instruction *CS, intptr_t To,
-                              llvm::StringRef Label) {
-    bool HasDecl = false;
-    const auto &Callees = getCalleesOfCallAt(CS);
-
-    for (const auto *Callee : Callees) {
-      if (Callee->isDeclaration()) {
-        HasDecl = true;
-        continue;
-      }
-
-      // Call Edge
-      const auto *BB = &Callee->front();
-      assert(BB && !BB->empty());
-      const auto *InterTo = &BB->front();
-
-      if (IgnoreDbgInstructions && llvm::isa<llvm::DbgInfoIntrinsic>(InterTo)) {
-        InterTo = InterTo->getNextNonDebugInstruction(false);
-      }
-      // createEdge(From, InterTo);
-      OS << intptr_t(CS) << "->" << intptr_t(InterTo) << ";\n";
-
-      // Return Edges
-      for (const auto *ExitInst : getAllExitPoints(Callee)) {
-        /// TODO: Be return/resume aware!
-        OS << intptr_t(ExitInst) << "->" << To << Label << ";\n";
-      }
-    }
-
-    if (HasDecl || Callees.empty()) {
-      OS << intptr_t(CS) << "->" << To << Label << ";\n";
-    }
-  };
-
-  for (const auto *Fun : getAllVertexFunctions()) {
-    for (const auto &Inst : llvm::instructions(Fun)) {
-      if (IgnoreDbgInstructions && llvm::isa<llvm::DbgInfoIntrinsic>(Inst)) {
-        continue;
-      }
-
-      OS << intptr_t(&Inst) << "[label=\"";
-      writeSCI(OS, &Inst);
-      OS << "\"];\n";
-
-      if (llvm::isa<llvm::UnreachableInst>(Inst)) {
-        continue;
-      }
-
-      auto Successors = getSuccsOf(&Inst);
-
-      if (Successors.size() == 2) {
-        if (llvm::isa<llvm::InvokeInst>(Inst)) {
-          createInterEdges(&Inst, intptr_t(Successors[0]),
-                           "[label=\"normal\"]");
-          createInterEdges(&Inst, intptr_t(Successors[1]),
-                           "[label=\"unwind\"]");
-        } else {
-          OS << intptr_t(&Inst) << "->" << intptr_t(Successors[0])
-             << "[label=\"true\"];\n";
-          OS << intptr_t(&Inst) << "->" << intptr_t(Successors[1])
-             << "[label=\"false\"];\n";
-        }
-        continue;
-      }
-
-      for (const auto *Successor : Successors) {
-        if (llvm::isa<llvm::CallBase>(Inst)) {
-          createInterEdges(&Inst, intptr_t(Successor), "");
-        } else {
-          OS << intptr_t(&Inst) << "->" << intptr_t(Successor) << ";\n";
-        }
-      }
-    }
-  }
+  ICFGExportOptions Opts;
+  Opts.Format = ICFGExportFormat::Dot;
+  Opts.WithSourceCodeInfo = WithSourceCodeInfo;
+  exportICFG(*this, OS, Opts);
 
   OS.flush();
   return Ret;
@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/ControlFlow/LLVMFrozenICFG.h"
+
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/Utils/Logger.h"
+
+#include <cassert>
+
+namespace psr {
+
+LLVMFrozenICFG::LLVMFrozenICFG(const LLVMBasedICFG &ICF)
+    : ICF(&ICF), IRDB(ICF.getIRDB()) {
+  assert(IRDB != nullptr);
+
+  auto NumInsts = IRDB->getNumInstructions();
+  Succs.reserve(NumInsts, NumInsts);
+  Preds.reserve(NumInsts, NumInsts);
+
+  // getAllInstructions() enumerates the instructions in ascending id order
+  size_t MaxId = 0;
+  for (const auto *Inst : IRDB->getAllInstructions()) {
+    auto Id = IRDB->getInstructionId(Inst);
+    MaxId = std::max(MaxId, Id);
+
+    Succs.startRow(Id);
+    Succs.append(ICF.getSuccsOf(Inst));
+    Preds.startRow(Id);
+    Preds.append(ICF.getPredsOf(Inst));
+  }
+  Succs.finalize(MaxId + 1);
+  Preds.finalize(MaxId + 1);
+
+  auto NumFuns = IRDB->getNumFunctions();
+  FunctionIndices.reserve(NumFuns);
+  StartPoints.reserve(NumFuns, NumFuns);
+  ExitPoints.reserve(NumFuns, NumFuns);
+
+  uint32_t FunIdx = 0;
+  for (const auto *Fun : IRDB->getAllFunctions()) {
+    FunctionIndices[Fun] = FunIdx;
+
+    StartPoints.startRow(FunIdx);
+    ExitPoints.startRow(FunIdx);
+    CallsFromWithin.startRow(FunIdx);
+    ControlFlowEdges.startRow(FunIdx);
+    if (!Fun->isDeclaration()) {
+      StartPoints.append(ICF.getStartPointsOf(Fun));
+      ExitPoints.append(ICF.getExitPointsOf(Fun));
+      CallsFromWithin.append(ICF.getCallsFromWithin(Fun));
+      ControlFlowEdges.append(ICF.getAllControlFlowEdges(Fun));
+    }
+    ++FunIdx;
+  }
+  StartPoints.finalize(FunIdx);
+  ExitPoints.finalize(FunIdx);
+  CallsFromWithin.finalize(FunIdx);
+  ControlFlowEdges.finalize(FunIdx);
+
+  NonCallStartNodes = ICF.allNonCallStartNodes();
+  NonCallStartNodes.shrink_to_fit();
+
+  PHASAR_LOG_LEVEL_CAT(INFO, "LLVMFrozenICFG",
+                       "Froze the ICFG of " << NumInsts << " instructions and "
+                                            << FunIdx << " functions into "
+                                            << getApproxSizeInBytes()
+                                            << " bytes");
+}
+
+auto LLVMFrozenICFG::getPredsOfImpl(n_t Inst) const noexcept
+    -> llvm::ArrayRef<n_t> {
+  return Preds.lookup(IRDB->getInstructionId(Inst));
+}
+
+auto LLVMFrozenICFG::getSuccsOfImpl(n_t Inst) const noexcept
+    -> llvm::ArrayRef<n_t> {
+  return Succs.lookup(IRDB->getInstructionId(Inst));
+}
+
+size_t LLVMFrozenICFG::getApproxSizeInBytes() const noexcept {
+  return Succs.getApproxSizeInBytes() + Preds.getApproxSizeInBytes() +
+         FunctionIndices.getMemorySize() + StartPoints.getApproxSizeInBytes() +
+         ExitPoints.getApproxSizeInBytes() +
+         CallsFromWithin.getApproxSizeInBytes() +
+         ControlFlowEdges.getApproxSizeInBytes() +
+         NonCallStartNodes.capacity() * sizeof(n_t);
+}
+
+nlohmann::json LLVMFrozenICFG::getAsJsonImpl() const {
+  return ICF->getCallGraph().getAsJson(
+      [](f_t F) { return F->getName().str(); },
+      [this](n_t Inst) { return IRDB->getInstructionId(Inst); });
+}
+
+template class ICFGBase<LLVMFrozenICFG>;
+
+} // namespace psr
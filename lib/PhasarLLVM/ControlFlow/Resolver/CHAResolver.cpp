@@ -66,18 +66,25 @@ auto CHAResolver::resolveVirtualCall(const llvm::CallBase *CallSite)
   const auto *ReceiverTy = getReceiverType(CallSite);
 
   // also insert all possible subtypes vtable entries
-  auto FallbackTys = TH->getSubTypes(ReceiverTy);
+  return getConsistentTargets(CallSite, getCHATargets(ReceiverTy, VtableIndex));
+}
 
-  FunctionSetTy PossibleCallees;
+auto CHAResolver::getCHATargets(const llvm::StructType *ReceiverTy,
+                                unsigned VtableIndex)
+    -> llvm::ArrayRef<const llvm::Function *> {
+  auto [It, Inserted] = CHATargets.try_emplace({ReceiverTy, VtableIndex});
+  if (!Inserted) {
+    return It->second;
+  }
 
-  for (const auto &FallbackTy : FallbackTys) {
-    const auto *Target =
-        getNonPureVirtualVFTEntry(FallbackTy, VtableIndex, CallSite);
-    if (Target) {
-      PossibleCallees.insert(Target);
+  llvm::SmallDenseSet<const llvm::Function *, 4> Seen;
+  for (const auto *SubTy : TH->subTypesOf(ReceiverTy)) {
+    const auto *Target = getNonPureVirtualVFTEntry(SubTy, VtableIndex);
+    if (Target && Seen.insert(Target).second) {
+      It->second.push_back(Target);
     }
   }
-  return PossibleCallees;
+  return It->second;
 }
 
 std::string CHAResolver::str() const { return "CHA"; }
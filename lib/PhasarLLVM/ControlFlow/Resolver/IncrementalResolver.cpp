@@ -0,0 +1,58 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/ControlFlow/Resolver/IncrementalResolver.h"
+
+using namespace psr;
+
+IncrementalResolver::IncrementalResolver(const LLVMProjectIRDB *IRDB,
+                                         const LLVMVFTableProvider *VTP,
+                                         Resolver &Fallback,
+                                         KnownTargetsTy KnownTargets)
+    : Resolver(IRDB, VTP), Fallback(&Fallback),
+      KnownTargets(std::move(KnownTargets)) {}
+
+void IncrementalResolver::preCall(const llvm::Instruction *Inst) {
+  Fallback->preCall(Inst);
+}
+
+void IncrementalResolver::handlePossibleTargets(
+    const llvm::CallBase *CallSite, FunctionSetTy &PossibleTargets) {
+  Fallback->handlePossibleTargets(CallSite, PossibleTargets);
+}
+
+void IncrementalResolver::postCall(const llvm::Instruction *Inst) {
+  Fallback->postCall(Inst);
+}
+
+auto IncrementalResolver::resolveVirtualCall(const llvm::CallBase *CallSite)
+    -> FunctionSetTy {
+  if (auto It = KnownTargets.find(CallSite); It != KnownTargets.end()) {
+    ++NumReused;
+    return It->second;
+  }
+  return Fallback->resolveVirtualCall(CallSite);
+}
+
+auto IncrementalResolver::resolveFunctionPointer(const llvm::CallBase *CallSite)
+    -> FunctionSetTy {
+  if (auto It = KnownTargets.find(CallSite); It != KnownTargets.end()) {
+    ++NumReused;
+    return It->second;
+  }
+  return Fallback->resolveFunctionPointer(CallSite);
+}
+
+void IncrementalResolver::otherInst(const llvm::Instruction *Inst) {
+  Fallback->otherInst(Inst);
+}
+
+std::string IncrementalResolver::str() const {
+  return "IncrementalResolver(" + Fallback->str() + ")";
+}
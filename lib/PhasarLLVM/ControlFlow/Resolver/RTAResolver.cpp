@@ -44,9 +44,6 @@ RTAResolver::RTAResolver(const LLVMProjectIRDB *IRDB,
 
 auto RTAResolver::resolveVirtualCall(const llvm::CallBase *CallSite)
     -> FunctionSetTy {
-
-  FunctionSetTy PossibleCallTargets;
-
   PHASAR_LOG_LEVEL(DEBUG,
                    "Call virtual function: " << llvmIRToString(CallSite));
 
@@ -67,23 +64,8 @@ auto RTAResolver::resolveVirtualCall(const llvm::CallBase *CallSite)
   const auto *ReceiverType = getReceiverType(CallSite);
 
   // also insert all possible subtypes vtable entries
-  auto ReachableTypes = TH->getSubTypes(ReceiverType);
-
-  // also insert all possible subtypes vtable entries
-
-  auto EndIt = ReachableTypes.end();
-  for (const auto *PossibleType : AllocatedStructTypes) {
-    if (const auto *PossibleTypeStruct =
-            llvm::dyn_cast<llvm::StructType>(PossibleType)) {
-      if (ReachableTypes.find(PossibleTypeStruct) != EndIt) {
-        const auto *Target = getNonPureVirtualVFTEntry(PossibleTypeStruct,
-                                                       VtableIndex, CallSite);
-        if (Target) {
-          PossibleCallTargets.insert(Target);
-        }
-      }
-    }
-  }
+  auto PossibleCallTargets =
+      getConsistentTargets(CallSite, getRTATargets(ReceiverType, VtableIndex));
 
   if (PossibleCallTargets.empty()) {
     return CHAResolver::resolveVirtualCall(CallSite);
@@ -92,6 +74,27 @@ auto RTAResolver::resolveVirtualCall(const llvm::CallBase *CallSite)
   return PossibleCallTargets;
 }
 
+auto RTAResolver::getRTATargets(const llvm::StructType *ReceiverTy,
+                                unsigned VtableIndex)
+    -> llvm::ArrayRef<const llvm::Function *> {
+  auto [It, Inserted] = RTATargets.try_emplace({ReceiverTy, VtableIndex});
+  if (!Inserted) {
+    return It->second;
+  }
+
+  llvm::SmallDenseSet<const llvm::Function *, 4> Seen;
+  for (const auto *PossibleType : AllocatedStructTypes) {
+    if (!TH->isSubType(ReceiverTy, PossibleType)) {
+      continue;
+    }
+    const auto *Target = getNonPureVirtualVFTEntry(PossibleType, VtableIndex);
+    if (Target && Seen.insert(Target).second) {
+      It->second.push_back(Target);
+    }
+  }
+  return It->second;
+}
+
 std::string RTAResolver::str() const { return "RTA"; }
 
 /// More or less copied from GeneralStatisticsAnalysis
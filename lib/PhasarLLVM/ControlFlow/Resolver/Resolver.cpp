@@ -137,19 +137,39 @@ Resolver::Resolver(const LLVMProjectIRDB *IRDB, const LLVMVFTableProvider *VTP)
 const llvm::Function *
 Resolver::getNonPureVirtualVFTEntry(const llvm::StructType *T, unsigned Idx,
                                     const llvm::CallBase *CallSite) {
+  const auto *Target = getNonPureVirtualVFTEntry(T, Idx);
+  if (Target && isConsistentCall(CallSite, Target)) {
+    return Target;
+  }
+  return nullptr;
+}
+
+const llvm::Function *
+Resolver::getNonPureVirtualVFTEntry(const llvm::StructType *T, unsigned Idx) {
   if (!VTP) {
     return nullptr;
   }
   if (const auto *VT = VTP->getVFTableOrNull(T)) {
     const auto *Target = VT->getFunction(Idx);
-    if (Target && Target->getName() != LLVMTypeHierarchy::PureVirtualCallName &&
-        isConsistentCall(CallSite, Target)) {
+    if (Target && Target->getName() != LLVMTypeHierarchy::PureVirtualCallName) {
       return Target;
     }
   }
   return nullptr;
 }
 
+auto Resolver::getConsistentTargets(
+    const llvm::CallBase *CallSite,
+    llvm::ArrayRef<const llvm::Function *> Candidates) -> FunctionSetTy {
+  FunctionSetTy Targets;
+  for (const auto *Candidate : Candidates) {
+    if (isConsistentCall(CallSite, Candidate)) {
+      Targets.insert(Candidate);
+    }
+  }
+  return Targets;
+}
+
 void Resolver::preCall(const llvm::Instruction *Inst) {}
 
 void Resolver::handlePossibleTargets(const llvm::CallBase *CallSite,
@@ -0,0 +1,70 @@
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/FunctionDataFlowFacts.h"
+
+#include "phasar/Utils/IO.h"
+#include "phasar/Utils/NlohmannLogging.h"
+
+#include <algorithm>
+#include <string>
+
+using namespace psr;
+using namespace psr::library_summary;
+
+/// The facts are stored as array of parameter-indices, where -1 denotes the
+/// return value
+void FunctionDataFlowFacts::printAsJson(llvm::raw_ostream &OS) const {
+  nlohmann::json JSON = nlohmann::json::object();
+
+  for (const auto &Entry : Fdff) {
+    auto &FunJson = JSON[Entry.getKey().str()];
+    FunJson = nlohmann::json::object();
+
+    for (const auto &[Index, Facts] : Entry.getValue()) {
+      std::vector<int32_t> Out;
+      Out.reserve(Facts.size());
+      for (const auto &Fact : Facts) {
+        if (const auto *Param = std::get_if<Parameter>(&Fact.Fact)) {
+          Out.push_back(Param->Index);
+        } else {
+          Out.push_back(-1);
+        }
+      }
+      std::sort(Out.begin(), Out.end());
+      FunJson[std::to_string(Index)] = std::move(Out);
+    }
+  }
+
+  OS << JSON << '\n';
+}
+
+static FunctionDataFlowFacts getDataFromJson(const nlohmann::json &Json) {
+  FunctionDataFlowFacts Data;
+
+  for (const auto &[FunName, FunJson] : Json.items()) {
+    for (const auto &[IndexStr, FactsJson] : FunJson.items()) {
+      std::vector<DataFlowFact> Facts;
+      for (const auto &Fact : FactsJson) {
+        auto Idx = Fact.get<int32_t>();
+        if (Idx < 0) {
+          Facts.emplace_back(ReturnValue{});
+        } else {
+          Facts.emplace_back(Parameter{uint16_t(Idx)});
+        }
+      }
+      Data.insertSet(FunName, std::stoul(IndexStr), std::move(Facts));
+    }
+  }
+
+  return Data;
+}
+
+FunctionDataFlowFacts
+FunctionDataFlowFacts::deserializeJson(const llvm::Twine &Path) {
+  return getDataFromJson(readJsonFile(Path));
+}
+
+FunctionDataFlowFacts
+FunctionDataFlowFacts::loadJsonString(llvm::StringRef JsonAsString) {
+  nlohmann::json Data =
+      nlohmann::json::parse(JsonAsString.begin(), JsonAsString.end());
+  return getDataFromJson(Data);
+}
@@ -37,6 +37,12 @@ bool IFDSIDESolverConfig::emitESG() const {
 bool IFDSIDESolverConfig::computePersistedSummaries() const {
   return hasFlag(Options, SolverConfigOptions::ComputePersistedSummaries);
 }
+bool IFDSIDESolverConfig::profile() const {
+  return hasFlag(Options, SolverConfigOptions::Profile);
+}
+bool IFDSIDESolverConfig::sparseESG() const {
+  return hasFlag(Options, SolverConfigOptions::SparseESG);
+}
 
 void IFDSIDESolverConfig::setFollowReturnsPastSeeds(bool Set) {
   setFlag(Options, SolverConfigOptions::FollowReturnsPastSeeds, Set);
@@ -56,6 +62,12 @@ void IFDSIDESolverConfig::setEmitESG(bool Set) {
 void IFDSIDESolverConfig::setComputePersistedSummaries(bool Set) {
   setFlag(Options, SolverConfigOptions::ComputePersistedSummaries, Set);
 }
+void IFDSIDESolverConfig::setProfile(bool Set) {
+  setFlag(Options, SolverConfigOptions::Profile, Set);
+}
+void IFDSIDESolverConfig::setSparseESG(bool Set) {
+  setFlag(Options, SolverConfigOptions::SparseESG, Set);
+}
 
 void IFDSIDESolverConfig::setConfig(SolverConfigOptions Opt) { Options = Opt; }
 
@@ -68,7 +80,9 @@ ostream &operator<<(ostream &OS, const IFDSIDESolverConfig &SC) {
             << "\trecordEdges: " << SC.recordEdges() << "\n"
             << "\tcomputePersistedSummaries: " << SC.computePersistedSummaries()
             << "\n"
-            << "\temitESG: " << SC.emitESG();
+            << "\temitESG: " << SC.emitESG() << "\n"
+            << "\tprofile: " << SC.profile() << "\n"
+            << "\tsparseESG: " << SC.sparseESG();
 }
 
 } // namespace psr
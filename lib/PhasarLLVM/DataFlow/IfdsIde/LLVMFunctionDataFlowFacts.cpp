@@ -16,3 +16,23 @@ library_summary::readFromFDFF(const FunctionDataFlowFacts &Fdff,
   }
   return Llvmfdff;
 }
+
+LLVMFunctionDataFlowFacts
+library_summary::readFromFDFF(const StaticFunctionDataFlowFacts &Fdff,
+                              const LLVMProjectIRDB &Irdb) {
+  LLVMFunctionDataFlowFacts Llvmfdff;
+
+  for (const auto *Fun : Irdb.getAllFunctions()) {
+    const auto *Summary = Fdff.find(Fun->getName());
+    if (!Summary) {
+      continue;
+    }
+
+    auto &FunFacts = Llvmfdff.LLVMFdff[Fun];
+    for (const auto &Param : Fdff.getParameters(*Summary)) {
+      auto Facts = Fdff.getDataFlowFacts(Param);
+      FunFacts.try_emplace(Param.Index, Facts.begin(), Facts.end());
+    }
+  }
+  return Llvmfdff;
+}
@@ -0,0 +1,299 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMLibrarySummaryGenerator.h"
+
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/Utils/LLVMModuleInterface.h"
+#include "phasar/Utils/Logger.h"
+
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallBitVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/Analysis/ValueTracking.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+
+#include <deque>
+
+namespace psr::library_summary {
+
+namespace {
+
+/// The effect of a function on its caller, if one parameter is tainted
+struct ParamEffect {
+  llvm::SmallBitVector TaintedParams;
+  bool TaintsReturn = false;
+
+  [[nodiscard]] bool empty() const noexcept {
+    return TaintedParams.none() && !TaintsReturn;
+  }
+
+  friend bool operator==(const ParamEffect &Lhs,
+                         const ParamEffect &Rhs) noexcept {
+    return Lhs.TaintsReturn == Rhs.TaintsReturn &&
+           Lhs.TaintedParams == Rhs.TaintedParams;
+  }
+};
+
+using FunctionEffectTy = std::vector<ParamEffect>;
+using TaintSetTy = llvm::SmallPtrSet<const llvm::Value *, 16>;
+
+class SummaryGenerator {
+public:
+  SummaryGenerator(const LLVMProjectIRDB &IRDB, const LLVMBasedICFG &ICF,
+                   LLVMAliasInfoRef PT,
+                   const LLVMFunctionDataFlowFacts &KnownFacts) noexcept
+      : IRDB(IRDB), ICF(ICF), PT(PT), KnownFacts(KnownFacts) {}
+
+  [[nodiscard]] FunctionDataFlowFacts run() {
+    std::deque<const llvm::Function *> WorkList;
+    llvm::SmallPtrSet<const llvm::Function *, 32> InWorkList;
+
+    for (const auto *Fun : IRDB.getAllFunctions()) {
+      if (Fun->isDeclaration()) {
+        continue;
+      }
+      // Start with the empty summary and let it grow until the fixpoint is
+      // reached
+      Effects[Fun].resize(Fun->arg_size(),
+                          ParamEffect{llvm::SmallBitVector(Fun->arg_size())});
+      WorkList.push_back(Fun);
+      InWorkList.insert(Fun);
+    }
+
+    while (!WorkList.empty()) {
+      const auto *Fun = WorkList.front();
+      WorkList.pop_front();
+      InWorkList.erase(Fun);
+
+      auto &FunEffect = Effects[Fun];
+      bool Changed = false;
+      for (unsigned Idx = 0, End = Fun->arg_size(); Idx != End; ++Idx) {
+        auto Effect = computeEffect(Fun, Idx);
+        if (!(Effect == FunEffect[Idx])) {
+          FunEffect[Idx] = std::move(Effect);
+          Changed = true;
+        }
+      }
+
+      if (!Changed) {
+        continue;
+      }
+      for (const auto *CS : ICF.getCallersOf(Fun)) {
+        const auto *Caller = CS->getFunction();
+        if (InWorkList.insert(Caller).second) {
+          WorkList.push_back(Caller);
+        }
+      }
+    }
+
+    FunctionDataFlowFacts Ret;
+    for (const auto &[Fun, FunEffect] : Effects) {
+      if (!isExportedDefinition(*Fun) ||
+          llvm::all_of(FunEffect, [](const auto &E) { return E.empty(); })) {
+        continue;
+      }
+
+      // The IFDSTaintAnalysis expects an entry for every parameter of a
+      // summarized function
+      for (unsigned Idx = 0, End = FunEffect.size(); Idx != End; ++Idx) {
+        std::vector<DataFlowFact> Facts;
+        for (auto Tainted : FunEffect[Idx].TaintedParams.set_bits()) {
+          Facts.emplace_back(Parameter{uint16_t(Tainted)});
+        }
+        if (FunEffect[Idx].TaintsReturn) {
+          Facts.emplace_back(ReturnValue{});
+        }
+        Ret.insertSet(Fun->getName(), Idx, std::move(Facts));
+      }
+    }
+
+    PHASAR_LOG_LEVEL_CAT(INFO, "LLVMLibrarySummaryGenerator",
+                         "Generated summaries for " << Ret.size() << " of "
+                                                    << Effects.size()
+                                                    << " defined functions");
+    return Ret;
+  }
+
+private:
+  [[nodiscard]] ParamEffect computeEffect(const llvm::Function *Fun,
+                                          unsigned ParamIdx) const {
+    TaintSetTy Tainted;
+    Tainted.insert(Fun->getArg(ParamIdx));
+
+    bool Changed = true;
+    auto Taint = [&Tainted, &Changed](const llvm::Value *V) {
+      Changed |= Tainted.insert(V).second;
+    };
+
+    while (Changed) {
+      Changed = false;
+      for (const auto &Inst : llvm::instructions(Fun)) {
+        if (const auto *Store = llvm::dyn_cast<llvm::StoreInst>(&Inst)) {
+          if (Tainted.count(Store->getValueOperand())) {
+            taintMemory(Store->getPointerOperand(), Store, Taint);
+          }
+        } else if (const auto *Load = llvm::dyn_cast<llvm::LoadInst>(&Inst)) {
+          if (Tainted.count(Load->getPointerOperand())) {
+            Taint(Load);
+          }
+        } else if (const auto *GEP =
+                       llvm::dyn_cast<llvm::GetElementPtrInst>(&Inst)) {
+          if (Tainted.count(GEP->getPointerOperand())) {
+            Taint(GEP);
+          }
+        } else if (const auto *Extract =
+                       llvm::dyn_cast<llvm::ExtractValueInst>(&Inst)) {
+          if (Tainted.count(Extract->getAggregateOperand())) {
+            Taint(Extract);
+          }
+        } else if (const auto *Insert =
+                       llvm::dyn_cast<llvm::InsertValueInst>(&Inst)) {
+          if (Tainted.count(Insert->getAggregateOperand()) ||
+              Tainted.count(Insert->getInsertedValueOperand())) {
+            Taint(Insert);
+          }
+        } else if (const auto *Cast = llvm::dyn_cast<llvm::CastInst>(&Inst)) {
+          if (Tainted.count(Cast->getOperand(0))) {
+            Taint(Cast);
+          }
+        } else if (const auto *Call = llvm::dyn_cast<llvm::CallBase>(&Inst)) {
+          applyCall(Call, Tainted, Taint);
+        }
+      }
+    }
+
+    ParamEffect Ret{llvm::SmallBitVector(Fun->arg_size())};
+    for (const auto &Arg : Fun->args()) {
+      if (Arg.getArgNo() != ParamIdx && Arg.getType()->isPointerTy() &&
+          Tainted.count(&Arg)) {
+        Ret.TaintedParams.set(Arg.getArgNo());
+      }
+    }
+    for (const auto &Inst : llvm::instructions(Fun)) {
+      if (const auto *RetInst = llvm::dyn_cast<llvm::ReturnInst>(&Inst)) {
+        if (const auto *RetVal = RetInst->getReturnValue();
+            RetVal && Tainted.count(RetVal)) {
+          Ret.TaintsReturn = true;
+          break;
+        }
+      }
+    }
+    return Ret;
+  }
+
+  /// Taints the memory that Ptr points to, i.e., Ptr itself together with the
+  /// object it is derived from and all of its may-aliases in the same function
+  template <typename TaintFn>
+  void taintMemory(const llvm::Value *Ptr, const llvm::Instruction *Context,
+                   TaintFn &Taint) const {
+    Taint(Ptr);
+    Taint(llvm::getUnderlyingObject(Ptr));
+
+    const auto *Fun = Context->getFunction();
+    for (const auto *Alias : *PT.getAliasSet(Ptr, Context)) {
+      if (const auto *AliasInst = llvm::dyn_cast<llvm::Instruction>(Alias)) {
+        if (AliasInst->getFunction() != Fun) {
+          continue;
+        }
+        if (const auto *Load = llvm::dyn_cast<llvm::LoadInst>(AliasInst)) {
+          // Handle at least one level of indirection...
+          Taint(Load->getPointerOperand()->stripPointerCasts());
+        }
+      } else if (const auto *Arg = llvm::dyn_cast<llvm::Argument>(Alias)) {
+        if (Arg->getParent() != Fun) {
+          continue;
+        }
+      } else {
+        continue;
+      }
+      Taint(Alias);
+    }
+  }
+
+  template <typename TaintFn>
+  void applyCall(const llvm::CallBase *Call, const TaintSetTy &Tainted,
+                 TaintFn &Taint) const {
+    if (const auto *MemTrans = llvm::dyn_cast<llvm::MemTransferInst>(Call)) {
+      if (Tainted.count(MemTrans->getSource())) {
+        taintMemory(MemTrans->getDest(), MemTrans, Taint);
+      }
+      return;
+    }
+
+    auto ApplyFact = [&](const DataFlowFact &Fact) {
+      if (const auto *Param = std::get_if<Parameter>(&Fact.Fact)) {
+        if (Param->Index < Call->arg_size()) {
+          taintMemory(Call->getArgOperand(Param->Index), Call, Taint);
+        }
+      } else {
+        Taint(Call);
+      }
+    };
+
+    for (const auto *Callee : ICF.getCalleesOfCallAt(Call)) {
+      auto NumParams = std::min<size_t>(Call->arg_size(), Callee->arg_size());
+
+      if (auto It = Effects.find(Callee); It != Effects.end()) {
+        for (unsigned Idx = 0; Idx != NumParams; ++Idx) {
+          if (!Tainted.count(Call->getArgOperand(Idx))) {
+            continue;
+          }
+          const auto &Effect = It->second[Idx];
+          for (auto TaintedParam : Effect.TaintedParams.set_bits()) {
+            ApplyFact(Parameter{uint16_t(TaintedParam)});
+          }
+          if (Effect.TaintsReturn) {
+            ApplyFact(ReturnValue{});
+          }
+        }
+        continue;
+      }
+
+      if (!KnownFacts.contains(Callee)) {
+        // Unknown functions are treated as identity, like the
+        // IFDSTaintAnalysis does
+        continue;
+      }
+      const auto &CalleeFacts = KnownFacts.getFactsForFunction(Callee);
+      for (unsigned Idx = 0; Idx != NumParams; ++Idx) {
+        if (!Tainted.count(Call->getArgOperand(Idx))) {
+          continue;
+        }
+        auto FactsIt = CalleeFacts.find(Idx);
+        if (FactsIt == CalleeFacts.end()) {
+          continue;
+        }
+        for (const auto &Fact : FactsIt->second) {
+          ApplyFact(Fact);
+        }
+      }
+    }
+  }
+
+  const LLVMProjectIRDB &IRDB;
+  const LLVMBasedICFG &ICF;
+  LLVMAliasInfoRef PT;
+  const LLVMFunctionDataFlowFacts &KnownFacts;
+  llvm::DenseMap<const llvm::Function *, FunctionEffectTy> Effects;
+};
+
+} // namespace
+
+FunctionDataFlowFacts
+generateLibrarySummary(const LLVMProjectIRDB &IRDB, const LLVMBasedICFG &ICF,
+                       LLVMAliasInfoRef PT,
+                       const LLVMFunctionDataFlowFacts &KnownFacts) {
+  return SummaryGenerator(IRDB, ICF, PT, KnownFacts).run();
+}
+
+} // namespace psr::library_summary
@@ -19,9 +19,20 @@
 #include "llvm/Support/raw_os_ostream.h"
 
 #include <cstddef>
+#include <cstring>
 
 namespace psr::detail {
 
+/// The offset-arrays are bounded by the k-limit, so they are tiny. Comparing
+/// them as raw memory lets the compiler and libc use wide (vector) loads
+/// instead of an element-wise loop.
+static bool offsetsEqual(llvm::ArrayRef<ptrdiff_t> LHS,
+                         llvm::ArrayRef<ptrdiff_t> RHS, size_t Len) noexcept {
+  assert(Len <= LHS.size() && Len <= RHS.size());
+  return LHS.data() == RHS.data() ||
+         std::memcmp(LHS.data(), RHS.data(), Len * sizeof(ptrdiff_t)) == 0;
+}
+
 AbstractMemoryLocationStorage::AbstractMemoryLocationStorage(
     const llvm::Value *Baseptr, uint32_t Lifetime, uint32_t NumOffsets) noexcept
     : Baseptr(Baseptr), Lifetime(Lifetime), NumOffsets(NumOffsets) {
@@ -81,11 +92,15 @@ auto AbstractMemoryLocationImpl::computeOffset(
 bool AbstractMemoryLocationImpl::equivalentOffsets(
     const AbstractMemoryLocationImpl &TV) const {
   size_t MinSize = std::min(offsets().size(), TV.offsets().size());
-  return offsets().slice(0, MinSize) == TV.offsets().slice(0, MinSize);
+  return offsetsEqual(offsets(), TV.offsets(), MinSize);
 }
 
 bool AbstractMemoryLocationImpl::equivalent(
     const AbstractMemoryLocationImpl &TV) const {
+  // AbstractMemoryLocations are hash-consed, so identity implies equivalence
+  if (this == &TV) {
+    return true;
+  }
   if (base() != TV.base()) {
     return false;
   }
@@ -102,8 +117,7 @@ bool AbstractMemoryLocationImpl::equivalentExceptPointerArithmetics(
   if (MinSize <= PALevel) {
     return true;
   }
-  return offsets().slice(0, MinSize - PALevel) ==
-         TV.offsets().slice(0, MinSize - PALevel);
+  return offsetsEqual(offsets(), TV.offsets(), MinSize - PALevel);
 }
 
 bool AbstractMemoryLocationImpl::mustAlias(
@@ -145,7 +159,7 @@ bool AbstractMemoryLocationImpl::isProperPrefixOf(
     return false;
   }
 
-  return offsets() == Larger.offsets().slice(0, offsets().size());
+  return offsetsEqual(offsets(), Larger.offsets(), offsets().size());
 }
 
 bool AbstractMemoryLocationImpl::isProperPrefixOf(
@@ -159,7 +173,7 @@ bool AbstractMemoryLocationImpl::isProperPrefixOf(
     return false;
   }
 
-  return offsets() == Larger.offsets().slice(0, offsets().size());
+  return offsetsEqual(offsets(), Larger.offsets(), offsets().size());
 }
 
 void AbstractMemoryLocationImpl::MakeProfile(llvm::FoldingSetNodeID &ID,
@@ -16,6 +16,7 @@
 
 #include <limits>
 #include <new>
+#include <optional>
 
 namespace psr::detail {
 
@@ -55,7 +56,8 @@ void AbstractMemoryLocationFactoryBase::Allocator::Block::destroy(
 }
 
 AbstractMemoryLocationFactoryBase::Allocator::Allocator(
-    size_t InitialCapacity) {
+    size_t InitialCapacity)
+    : InitialCapacity(InitialCapacity) {
   if (InitialCapacity <= ExpectedNumAmLsPerBlock) {
     return;
   }
@@ -67,12 +69,15 @@ AbstractMemoryLocationFactoryBase::Allocator::Allocator(
   End = Pos + NumPointersPerInitialBlock;
 }
 
-AbstractMemoryLocationFactoryBase::Allocator::~Allocator() {
-  auto *Rt = Root;
-  auto *Blck = Rt;
+AbstractMemoryLocationFactoryBase::Allocator::~Allocator() { clear(); }
+
+void AbstractMemoryLocationFactoryBase::Allocator::clear() noexcept {
+  // The initial block (if any) is the last one in the list. It is not
+  // re-allocated after clearing.
+  auto *Blck = Root;
   while (Blck) {
     auto *Nxt = Blck->Next;
-    Block::destroy(Blck, Blck == Rt
+    Block::destroy(Blck, !Nxt && InitialCapacity > ExpectedNumAmLsPerBlock
                              ? (MinNumPointersPerAML + 3) * InitialCapacity
                              : NumPointersPerBlock);
     Blck = Nxt;
@@ -80,11 +85,13 @@ AbstractMemoryLocationFactoryBase::Allocator::~Allocator() {
   Root = nullptr;
   Pos = nullptr;
   End = nullptr;
+  InitialCapacity = 0;
 }
 
 AbstractMemoryLocationFactoryBase::Allocator::Allocator(
     Allocator &&Other) noexcept
-    : Root(Other.Root), Pos(Other.Pos), End(Other.End) {
+    : Root(Other.Root), Pos(Other.Pos), End(Other.End),
+      InitialCapacity(Other.InitialCapacity) {
   Other.Root = nullptr;
   Other.Pos = nullptr;
   Other.End = nullptr;
@@ -150,6 +157,18 @@ void AbstractMemoryLocationFactoryBase::setDataLayout(
   this->DL = &DL;
 }
 
+void AbstractMemoryLocationFactoryBase::reset() {
+  // Note: The zero-value is not allocated by the Owner, so it survives
+  Pool.clear();
+  Cache.clear();
+  GepCache.clear();
+  IndirectionCache.clear();
+#ifdef XTAINT_DIAGNOSTICS
+  overApproximatedAMLs.clear();
+#endif
+  Owner.clear();
+}
+
 const AbstractMemoryLocationImpl *
 AbstractMemoryLocationFactoryBase::getOrCreateImpl(
     const llvm::Value *V, llvm::ArrayRef<ptrdiff_t> Offs, unsigned BOUND) {
@@ -286,6 +305,17 @@ AbstractMemoryLocationFactoryBase::withIndirectionOfImpl(
     return AML;
   }
 
+  // Pushing an empty indirection is equivalent to pushing a zero-offset
+  std::optional<std::pair<const AbstractMemoryLocationImpl *, ptrdiff_t>>
+      CacheKey;
+  if (Ind.size() <= 1) {
+    CacheKey.emplace(AML, Ind.empty() ? 0 : Ind.front());
+    if (auto It = IndirectionCache.find(*CacheKey);
+        It != IndirectionCache.end()) {
+      return It->second;
+    }
+  }
+
   llvm::SmallVector<ptrdiff_t, 8> Offs(AML->offsets().begin(),
                                        AML->offsets().end());
 #ifdef XTAINT_DIAGNOSTICS
@@ -314,6 +344,9 @@ AbstractMemoryLocationFactoryBase::withIndirectionOfImpl(
     overApproximatedAMLs.insert(ret);
 #endif
 
+  if (CacheKey) {
+    IndirectionCache.try_emplace(*CacheKey, Ret);
+  }
   return Ret;
 }
 
@@ -329,9 +362,17 @@ AbstractMemoryLocationFactoryBase::withOffsetImpl(
 #endif
     return AML;
   default:
+    auto [It, Inserted] = GepCache.try_emplace(std::make_pair(AML, Gep));
+    if (!Inserted) {
+      return It->second;
+    }
+
     auto GepOffs = detail::AbstractMemoryLocationImpl::computeOffset(*DL, Gep);
     if (!GepOffs.has_value()) {
-      return limitImpl(AML);
+      const auto *Ret = limitImpl(AML);
+      // limitImpl() does not touch the GepCache, so It is still valid
+      It->second = Ret;
+      return Ret;
     }
     assert(!AML->offsets().empty() && "An AbstractMemoryLocation should have "
                                       "at least one offset, even if it is 0");
@@ -339,7 +380,9 @@ AbstractMemoryLocationFactoryBase::withOffsetImpl(
                                          AML->offsets().end());
     Offs.back() += *GepOffs;
 
-    return getOrCreateImpl(AML->base(), Offs, AML->lifetime());
+    const auto *Ret = getOrCreateImpl(AML->base(), Offs, AML->lifetime());
+    It->second = Ret;
+    return Ret;
   }
 }
 
@@ -12,16 +12,23 @@
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEGeneralizedLCA/EdgeValueSet.h"
 
 #include "llvm/ADT/APFloat.h"
+#include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/GlobalVariable.h"
 #include "llvm/IR/Operator.h"
+#include "llvm/Support/Allocator.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/MathExtras.h"
+#include "llvm/Support/StringSaver.h"
 #include "llvm/Support/raw_os_ostream.h"
 #include "llvm/Support/raw_ostream.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <functional>
+#include <mutex>
 
 namespace psr::glca {
 
@@ -50,118 +57,108 @@ llvm::raw_ostream &printSemantics(const llvm::APFloat &Fl) {
   return llvm::outs() << "Sth else";
 }
 
+namespace {
+
+/// Strings that are equal are interned to the same address, so EdgeValues
+/// can compare them by pointer
+struct StringPool {
+  std::mutex Mtx;
+  llvm::BumpPtrAllocator Alloc;
+  llvm::UniqueStringSaver Saver{Alloc};
+
+  llvm::StringRef intern(llvm::StringRef Str) {
+    std::lock_guard Lock(Mtx);
+    return Saver.save(Str);
+  }
+};
+
+StringPool &getStringPool() {
+  static StringPool Pool;
+  return Pool;
+}
+
+double toDouble(const llvm::APFloat &Fl) {
+  llvm::APFloat Apf(Fl);
+  bool Unused;
+  Apf.convert(llvm::APFloat::IEEEdouble(),
+              llvm::APFloat::roundingMode::NearestTiesToEven, &Unused);
+  return Apf.convertToDouble();
+}
+
+/// The zero-extended value of an integer of bit-width Bits
+uint64_t zext(int64_t Val, unsigned Bits) {
+  return Bits >= 64 ? uint64_t(Val)
+                    : uint64_t(Val) & llvm::maskTrailingOnes<uint64_t>(Bits);
+}
+
+} // namespace
+
 const EdgeValue EdgeValue::TopValue = EdgeValue(nullptr);
 
-EdgeValue::EdgeValue(const llvm::Value *Val) : VariantType(Top) {
+EdgeValue EdgeValue::makeInt(uint64_t Val, unsigned Bits) noexcept {
+  assert(Bits > 0 && Bits <= 64);
+  EdgeValue Ret(nullptr);
+  Ret.VariantType = Integer;
+  Ret.Aux = Bits;
+  Ret.IntVal = llvm::SignExtend64(Val, Bits);
+  return Ret;
+}
+
+EdgeValue::EdgeValue(const llvm::Value *Val) : EdgeValue(nullptr) {
   if (const auto *Const = llvm::dyn_cast<llvm::Constant>(Val)) {
     if (Const->getType()->isIntegerTy()) {
-      VariantType = Integer;
-      ValVariant =
-          llvm::APInt(llvm::cast<llvm::ConstantInt>(Const)->getValue());
+      *this = EdgeValue(llvm::cast<llvm::ConstantInt>(Const)->getValue());
     } else if (Const->getType()->isFloatingPointTy()) {
-      VariantType = FloatingPoint;
-      const auto &ConstFP = llvm::cast<llvm::ConstantFP>(Const)->getValueAPF();
-
-      llvm::APFloat Apf(ConstFP);
-      bool Unused;
-      Apf.convert(llvm::APFloat::IEEEdouble(),
-                  llvm::APFloat::roundingMode::NearestTiesToEven, &Unused);
-      ValVariant = llvm::APFloat(Apf);
+      *this = EdgeValue(llvm::cast<llvm::ConstantFP>(Const)->getValueAPF());
     } else if (llvm::isa<llvm::ConstantPointerNull>(Const)) {
-      VariantType = String;
-      ValVariant = std::string();
+      *this = EdgeValue(llvm::StringRef());
     } else if (const auto *Gep = llvm::dyn_cast<llvm::GEPOperator>(Const);
                Gep && Gep->getResultElementType()->isIntegerTy()) {
-      VariantType = String;
       if (const auto *Glob =
               llvm::dyn_cast<llvm::GlobalVariable>(Gep->getPointerOperand())) {
-        ValVariant = std::string(
+        *this = EdgeValue(
             llvm::cast<llvm::ConstantDataArray>(Glob->getInitializer())
-                ->getAsCString()
-                .str());
-      } else {
-        // inttoptr
-        ValVariant = nullptr;
-        VariantType = Top;
+                ->getAsCString());
       }
-    } else {
-      Val = nullptr;
-      VariantType = Top;
+      // else: inttoptr
     }
-  } else {
-    Val = nullptr;
-    VariantType = Top;
   }
 }
 
-EdgeValue::EdgeValue(const EdgeValue &Ev) : VariantType(Ev.VariantType) {
-  switch (VariantType) {
-  case Top:
-    ValVariant = nullptr;
-    break;
-  case Integer:
-    ValVariant = std::get<llvm::APInt>(Ev.ValVariant);
-    break;
-  case FloatingPoint:
-    ValVariant = std::get<llvm::APFloat>(Ev.ValVariant);
-    break;
-  case String:
-    ValVariant = std::get<std::string>(Ev.ValVariant);
-    break;
+EdgeValue::EdgeValue(const llvm::APInt &Vi) : EdgeValue(nullptr) {
+  // Wider integers are not tracked
+  if (Vi.getBitWidth() <= 64) {
+    *this = makeInt(Vi.getZExtValue(), Vi.getBitWidth());
   }
 }
 
-EdgeValue &EdgeValue::operator=(const EdgeValue &Ev) {
-  this->~EdgeValue();
-  new (this) EdgeValue(Ev);
-  return *this;
-}
+EdgeValue::EdgeValue(const llvm::APFloat &Vf)
+    : FPVal(toDouble(Vf)), VariantType(EdgeValue::FloatingPoint) {}
 
-EdgeValue::~EdgeValue() { ValVariant.~variant(); }
+EdgeValue::EdgeValue(long long Vi)
+    : IntVal(Vi), Aux(sizeof(long long) << 3),
+      VariantType(EdgeValue::Integer) {}
 
-EdgeValue::EdgeValue(llvm::APInt &&Vi) : VariantType(EdgeValue::Integer) {
-  ValVariant = llvm::APInt(std::move(Vi));
-}
-
-EdgeValue::EdgeValue(const llvm::APInt &Vi) : VariantType(EdgeValue::Integer) {
-  ValVariant = llvm::APInt(Vi);
-}
-
-EdgeValue::EdgeValue(llvm::APFloat &&Vf)
-    : VariantType(EdgeValue::FloatingPoint) {
-  llvm::APFloat Fp = llvm::APFloat(std::move(Vf));
-  bool Unused;
-  Fp.convert(llvm::APFloat::IEEEdouble(),
-             llvm::APFloat::roundingMode::NearestTiesToEven, &Unused);
-  ValVariant = Fp;
-}
+EdgeValue::EdgeValue(int Vi)
+    : IntVal(Vi), Aux(sizeof(int) << 3), VariantType(EdgeValue::Integer) {}
 
-EdgeValue::EdgeValue(long long Vi) : VariantType(EdgeValue::Integer) {
-  ValVariant = llvm::APInt(llvm::APInt(sizeof(long long) << 3, Vi));
-}
-
-EdgeValue::EdgeValue(int Vi) : VariantType(EdgeValue::Integer) {
-  ValVariant = llvm::APInt(llvm::APInt(sizeof(int) << 3, Vi));
-}
+EdgeValue::EdgeValue(double Double)
+    : FPVal(Double), VariantType(EdgeValue::FloatingPoint) {}
 
-EdgeValue::EdgeValue(double Double) : VariantType(EdgeValue::FloatingPoint) {
-  ValVariant = llvm::APFloat(Double);
-}
-
-EdgeValue::EdgeValue(float Float) : VariantType(EdgeValue::FloatingPoint) {
-  ValVariant = llvm::APFloat(Float);
-}
+EdgeValue::EdgeValue(float Float)
+    : FPVal(Float), VariantType(EdgeValue::FloatingPoint) {}
 
-EdgeValue::EdgeValue(std::string &&Vs) : VariantType(EdgeValue::String) {
-  ValVariant = std::string(Vs);
+EdgeValue::EdgeValue(llvm::StringRef Vs) : VariantType(EdgeValue::String) {
+  auto Interned = getStringPool().intern(Vs);
+  StrData = Interned.data();
+  Aux = Interned.size();
 }
 
-EdgeValue::EdgeValue(std::nullptr_t) : VariantType(EdgeValue::Top) {}
 bool EdgeValue::tryGetInt(int64_t &Res) const {
   if (VariantType != Integer) {
     return false;
   }
-  Res = std::get<llvm::APInt>(ValVariant).getSExtValue();
+  Res = IntVal;
   return true;
 }
 
@@ -169,7 +166,7 @@ bool EdgeValue::tryGetFP(double &Res) const {
   if (VariantType != FloatingPoint) {
     return false;
   }
-  Res = std::get<llvm::APFloat>(ValVariant).convertToDouble();
+  Res = FPVal;
   return true;
 }
 
@@ -177,7 +174,7 @@ bool EdgeValue::tryGetString(std::string &Res) const {
   if (VariantType != String) {
     return false;
   }
-  Res = std::get<std::string>(ValVariant);
+  Res = getStringRef().str();
   return true;
 }
 
@@ -191,14 +188,48 @@ bool EdgeValue::isString() const { return VariantType == String; }
 
 EdgeValue::Type EdgeValue::getKind() const { return VariantType; }
 
+size_t EdgeValue::getHashCode() const noexcept {
+  switch (VariantType) {
+  case Integer:
+    return llvm::hash_combine(VariantType, IntVal);
+  case FloatingPoint:
+    // operator== compares floating-point values with an epsilon, which is not
+    // transitive, so the only consistent hash ignores the value
+    return llvm::hash_value(VariantType);
+  case String:
+    return llvm::hash_combine(VariantType, StrData);
+  default:
+    return llvm::hash_value(VariantType);
+  }
+}
+
+bool EdgeValue::lessThan(const EdgeValue &Lhs, const EdgeValue &Rhs) noexcept {
+  if (Lhs.VariantType != Rhs.VariantType) {
+    return Lhs.VariantType < Rhs.VariantType;
+  }
+  switch (Lhs.VariantType) {
+  case Integer:
+    return Lhs.IntVal < Rhs.IntVal;
+  case FloatingPoint:
+    // Sort NaNs to the end
+    return Lhs.FPVal < Rhs.FPVal ||
+           (std::isnan(Rhs.FPVal) && !std::isnan(Lhs.FPVal));
+  case String:
+    return Lhs.StrData != Rhs.StrData &&
+           Lhs.getStringRef() < Rhs.getStringRef();
+  default:
+    return false;
+  }
+}
+
 EdgeValue::operator bool() {
   switch (VariantType) {
   case Integer:
-    return !std::get<llvm::APInt>(ValVariant).isNullValue();
+    return IntVal != 0;
   case FloatingPoint:
-    return std::get<llvm::APFloat>(ValVariant).isNonZero();
+    return FPVal != 0;
   case String:
-    return !std::get<std::string>(ValVariant).empty();
+    return Aux != 0;
   default:
     break;
   }
@@ -213,23 +244,17 @@ bool operator==(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   case EdgeValue::Top:
     return true;
   case EdgeValue::Integer:
-    return std::get<llvm::APInt>(Lhs.ValVariant) ==
-           std::get<llvm::APInt>(Rhs.ValVariant);
+    return Lhs.IntVal == Rhs.IntVal;
   case EdgeValue::FloatingPoint: {
-    auto Cp = std::get<llvm::APFloat>(Lhs.ValVariant)
-                  .compare(std::get<llvm::APFloat>(Rhs.ValVariant));
-    if (Cp == llvm::APFloat::cmpResult::cmpEqual) {
-      return true;
-    }
-    auto D1 = std::get<llvm::APFloat>(Lhs.ValVariant).convertToDouble();
-    auto D2 = std::get<llvm::APFloat>(Rhs.ValVariant).convertToDouble();
+    auto D1 = Lhs.FPVal;
+    auto D2 = Rhs.FPVal;
 
     const double Epsilon = 0.000001;
     return D1 == D2 || fabs(D1 - D2) < Epsilon;
   }
   case EdgeValue::String:
-    return std::get<std::string>(Lhs.ValVariant) ==
-           std::get<std::string>(Rhs.ValVariant);
+    // Interned
+    return Lhs.StrData == Rhs.StrData;
   }
 
   llvm_unreachable("FATAL ERROR: Invalid variant type");
@@ -240,20 +265,23 @@ bool EdgeValue::sqSubsetEq(const EdgeValue &Other) const {
 }
 
 // binary operators
+//
+// The integer operations behave like the respective llvm::APInt operations on
+// the wider one of both operands' bit-widths
 EdgeValue operator+(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   if (Lhs.VariantType != Rhs.VariantType) {
     return {nullptr};
   }
   switch (Lhs.VariantType) {
   case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant) +
-            std::get<llvm::APInt>(Rhs.ValVariant)};
+    return EdgeValue::makeInt(uint64_t(Lhs.IntVal) + uint64_t(Rhs.IntVal),
+                              std::max(Lhs.Aux, Rhs.Aux));
   case EdgeValue::FloatingPoint:
-    return {std::get<llvm::APFloat>(Lhs.ValVariant) +
-            std::get<llvm::APFloat>(Rhs.ValVariant)};
-  case EdgeValue::String:
-    return {std::get<std::string>(Lhs.ValVariant) +
-            std::get<std::string>(Rhs.ValVariant)};
+    return {Lhs.FPVal + Rhs.FPVal};
+  case EdgeValue::String: {
+    auto Concat = (llvm::Twine(Lhs.getStringRef()) + Rhs.getStringRef()).str();
+    return EdgeValue(llvm::StringRef(Concat));
+  }
   default:
     return {nullptr};
   }
@@ -265,11 +293,10 @@ EdgeValue operator-(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   }
   switch (Lhs.VariantType) {
   case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant) -
-            std::get<llvm::APInt>(Lhs.ValVariant)};
+    return EdgeValue::makeInt(uint64_t(Lhs.IntVal) - uint64_t(Rhs.IntVal),
+                              std::max(Lhs.Aux, Rhs.Aux));
   case EdgeValue::FloatingPoint:
-    return {std::get<llvm::APFloat>(Lhs.ValVariant) -
-            std::get<llvm::APFloat>(Rhs.ValVariant)};
+    return {Lhs.FPVal - Rhs.FPVal};
   default:
     return {nullptr};
   }
@@ -281,11 +308,10 @@ EdgeValue operator*(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   }
   switch (Lhs.VariantType) {
   case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant) *
-            std::get<llvm::APInt>(Rhs.ValVariant)};
+    return EdgeValue::makeInt(uint64_t(Lhs.IntVal) * uint64_t(Rhs.IntVal),
+                              std::max(Lhs.Aux, Rhs.Aux));
   case EdgeValue::FloatingPoint:
-    return {std::get<llvm::APFloat>(Lhs.ValVariant) *
-            std::get<llvm::APFloat>(Rhs.ValVariant)};
+    return {Lhs.FPVal * Rhs.FPVal};
   default:
     return {nullptr};
   }
@@ -297,11 +323,18 @@ EdgeValue operator/(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   }
   switch (Lhs.VariantType) {
   case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant)
-                .sdiv(std::get<llvm::APInt>(Rhs.ValVariant))};
+    if (Rhs.IntVal == 0) {
+      return {nullptr};
+    }
+    if (Rhs.IntVal == -1) {
+      // Avoid the overflow of INT64_MIN / -1
+      return EdgeValue::makeInt(-uint64_t(Lhs.IntVal),
+                                std::max(Lhs.Aux, Rhs.Aux));
+    }
+    return EdgeValue::makeInt(Lhs.IntVal / Rhs.IntVal,
+                              std::max(Lhs.Aux, Rhs.Aux));
   case EdgeValue::FloatingPoint:
-    return {std::get<llvm::APFloat>(Lhs.ValVariant) /
-            std::get<llvm::APFloat>(Rhs.ValVariant)};
+    return {Lhs.FPVal / Rhs.FPVal};
   default:
     return {nullptr};
   }
@@ -313,13 +346,17 @@ EdgeValue operator%(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   }
   switch (Lhs.VariantType) {
   case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant)
-                .srem(std::get<llvm::APInt>(Rhs.ValVariant))};
-  case EdgeValue::FloatingPoint: {
-    llvm::APFloat Fl = std::get<llvm::APFloat>(Lhs.ValVariant);
-    Fl.remainder(std::get<llvm::APFloat>(Rhs.ValVariant));
-    return {std::move(Fl)};
-  }
+    if (Rhs.IntVal == 0) {
+      return {nullptr};
+    }
+    if (Rhs.IntVal == -1) {
+      return EdgeValue::makeInt(0, std::max(Lhs.Aux, Rhs.Aux));
+    }
+    return EdgeValue::makeInt(Lhs.IntVal % Rhs.IntVal,
+                              std::max(Lhs.Aux, Rhs.Aux));
+  case EdgeValue::FloatingPoint:
+    // Same as llvm::APFloat::remainder()
+    return {std::remainder(Lhs.FPVal, Rhs.FPVal)};
   default:
     return {nullptr};
   }
@@ -331,8 +368,8 @@ EdgeValue operator&(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   }
   switch (Lhs.VariantType) {
   case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant) &
-            std::get<llvm::APInt>(Rhs.ValVariant)};
+    return EdgeValue::makeInt(Lhs.IntVal & Rhs.IntVal,
+                              std::max(Lhs.Aux, Rhs.Aux));
   default:
     return {nullptr};
   }
@@ -344,8 +381,8 @@ EdgeValue operator|(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   }
   switch (Lhs.VariantType) {
   case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant) |
-            std::get<llvm::APInt>(Rhs.ValVariant)};
+    return EdgeValue::makeInt(Lhs.IntVal | Rhs.IntVal,
+                              std::max(Lhs.Aux, Rhs.Aux));
   default:
     return {nullptr};
   }
@@ -357,8 +394,8 @@ EdgeValue operator^(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   }
   switch (Lhs.VariantType) {
   case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant) ^
-            std::get<llvm::APInt>(Rhs.ValVariant)};
+    return EdgeValue::makeInt(Lhs.IntVal ^ Rhs.IntVal,
+                              std::max(Lhs.Aux, Rhs.Aux));
   default:
     return {nullptr};
   }
@@ -369,9 +406,12 @@ EdgeValue operator<<(const EdgeValue &Lhs, const EdgeValue &Rhs) {
     return {nullptr};
   }
   switch (Lhs.VariantType) {
-  case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant)
-            << std::get<llvm::APInt>(Rhs.ValVariant)};
+  case EdgeValue::Integer: {
+    auto Bits = std::max(Lhs.Aux, Rhs.Aux);
+    auto ShAmt = zext(Rhs.IntVal, Bits);
+    return EdgeValue::makeInt(ShAmt >= Bits ? 0 : uint64_t(Lhs.IntVal) << ShAmt,
+                              Bits);
+  }
   default:
     return {nullptr};
   }
@@ -381,9 +421,12 @@ EdgeValue operator>>(const EdgeValue &Lhs, const EdgeValue &Rhs) {
     return {nullptr};
   }
   switch (Lhs.VariantType) {
-  case EdgeValue::Integer:
-    return {std::get<llvm::APInt>(Lhs.ValVariant)
-                .ashr(std::get<llvm::APInt>(Rhs.ValVariant))};
+  case EdgeValue::Integer: {
+    // arithmetic shift; IntVal is sign-extended to 64 bits
+    auto Bits = std::max(Lhs.Aux, Rhs.Aux);
+    auto ShAmt = std::min<uint64_t>(zext(Rhs.IntVal, Bits), 63);
+    return EdgeValue::makeInt(Lhs.IntVal >> ShAmt, Bits);
+  }
   default:
     return {nullptr};
   }
@@ -392,14 +435,14 @@ EdgeValue operator>>(const EdgeValue &Lhs, const EdgeValue &Rhs) {
 // unary operators
 EdgeValue EdgeValue::operator-() const {
   if (VariantType == Integer) {
-    return {-std::get<llvm::APInt>(ValVariant)};
+    return makeInt(-uint64_t(IntVal), Aux);
   }
   return {nullptr};
 }
 
 EdgeValue EdgeValue::operator~() const {
   if (VariantType == Integer) {
-    return {~std::get<llvm::APInt>(ValVariant)};
+    return makeInt(~uint64_t(IntVal), Aux);
   }
   return {nullptr};
 }
@@ -407,7 +450,7 @@ EdgeValue EdgeValue::operator~() const {
 int EdgeValue::compare(const EdgeValue &Lhs, const EdgeValue &Rhs) {
   switch (Lhs.VariantType) {
   case EdgeValue::Integer: {
-    auto Lhsval = std::get<llvm::APInt>(Lhs.ValVariant).getSExtValue();
+    auto Lhsval = Lhs.IntVal;
     int64_t Rhsval;
     double RhsvalFp;
     if (Rhs.tryGetInt(Rhsval)) {
@@ -419,7 +462,7 @@ int EdgeValue::compare(const EdgeValue &Lhs, const EdgeValue &Rhs) {
     break;
   }
   case EdgeValue::FloatingPoint: {
-    auto Lhsval = std::get<llvm::APFloat>(Lhs.ValVariant).convertToDouble();
+    auto Lhsval = Lhs.FPVal;
     int64_t Rhsval;
     double RhsvalFp;
     bool IsInt = Rhs.tryGetInt(Rhsval);
@@ -434,9 +477,8 @@ int EdgeValue::compare(const EdgeValue &Lhs, const EdgeValue &Rhs) {
     break;
   }
   case EdgeValue::String: {
-    std::string Rhsval;
-    if (Rhs.tryGetString(Rhsval)) {
-      return std::get<std::string>(Lhs.ValVariant).compare(Rhsval);
+    if (Rhs.isString()) {
+      return Lhs.getStringRef().compare(Rhs.getStringRef());
     }
     break;
   }
@@ -449,17 +491,12 @@ int EdgeValue::compare(const EdgeValue &Lhs, const EdgeValue &Rhs) {
 
 llvm::raw_ostream &operator<<(llvm::raw_ostream &Os, const EdgeValue &Ev) {
   switch (Ev.VariantType) {
-  case EdgeValue::Integer: {
-    std::string S;
-    llvm::raw_string_ostream Ros(S);
-    Ros << std::get<llvm::APInt>(Ev.ValVariant);
-    return Os << Ros.str();
-  }
+  case EdgeValue::Integer:
+    return Os << Ev.IntVal;
   case EdgeValue::String:
-    return Os << "\"" << std::get<std::string>(Ev.ValVariant) << "\"";
-  case EdgeValue::FloatingPoint: {
-    return Os << std::get<llvm::APFloat>(Ev.ValVariant).convertToDouble();
-  }
+    return Os << "\"" << Ev.getStringRef() << "\"";
+  case EdgeValue::FloatingPoint:
+    return Os << Ev.FPVal;
   default:
     return Os << "<TOP>";
   }
@@ -471,19 +508,25 @@ EdgeValue EdgeValue::typecast(Type Dest, unsigned Bits) const {
   case Integer:
     switch (VariantType) {
     case Integer:
-      if (std::get<llvm::APInt>(ValVariant).getBitWidth() <= Bits) {
+      if (Aux <= Bits) {
         return *this;
       }
-      return {std::get<llvm::APInt>(ValVariant) & ((1 << Bits) - 1)};
+      return makeInt(zext(IntVal, Bits), Aux);
     case FloatingPoint: {
-      bool Unused;
-      llvm::APSInt Ai(Bits);
-
-      std::get<llvm::APFloat>(ValVariant)
-          .convertToInteger(Ai, llvm::APFloat::roundingMode::NearestTiesToEven,
-                            &Unused);
-
-      return {Ai};
+      if (Bits == 0 || Bits > 64) {
+        return {nullptr};
+      }
+      // Behaves like llvm::APFloat::convertToInteger() into an unsigned
+      // llvm::APSInt, which saturates on overflow
+      double Rounded = std::nearbyint(FPVal);
+      if (std::isnan(Rounded) || Rounded <= 0) {
+        return makeInt(0, Bits);
+      }
+      auto Max = llvm::maskTrailingOnes<uint64_t>(Bits);
+      if (Rounded >= std::ldexp(1.0, int(Bits))) {
+        return makeInt(Max, Bits);
+      }
+      return makeInt(uint64_t(Rounded), Bits);
     }
     default:
       return {nullptr};
@@ -492,9 +535,9 @@ EdgeValue EdgeValue::typecast(Type Dest, unsigned Bits) const {
     switch (VariantType) {
     case Integer:
       if (Bits > 32) {
-        return {(double)std::get<llvm::APInt>(ValVariant).getSExtValue()};
+        return {(double)IntVal};
       }
-      return {(float)std::get<llvm::APInt>(ValVariant).getSExtValue()};
+      return {(float)IntVal};
     case FloatingPoint:
       return *this;
     default:
@@ -523,9 +566,11 @@ EdgeValue EdgeValue::performBinOp(llvm::BinaryOperator::BinaryOps Op,
       return {nullptr};
     }
     switch (VariantType) {
-    case EdgeValue::Integer:
-      return {std::get<llvm::APInt>(ValVariant)
-                  .lshr(std::get<llvm::APInt>(Other.ValVariant))};
+    case EdgeValue::Integer: {
+      auto Bits = std::max(Aux, Other.Aux);
+      auto ShAmt = zext(Other.IntVal, Bits);
+      return makeInt(ShAmt >= Bits ? 0 : zext(IntVal, Bits) >> ShAmt, Bits);
+    }
     default:
       return {nullptr};
     }
@@ -543,26 +588,24 @@ EdgeValue EdgeValue::performBinOp(llvm::BinaryOperator::BinaryOps Op,
   case llvm::BinaryOperator::BinaryOps::Sub:
   case llvm::BinaryOperator::BinaryOps::FSub:
     return *this - Other;
-  case llvm::BinaryOperator::BinaryOps::UDiv: {
-    if (VariantType != Other.VariantType) {
-      return {nullptr};
-    }
-    switch (VariantType) {
-    case EdgeValue::Integer:
-      return {std::get<llvm::APInt>(ValVariant)
-                  .udiv(std::get<llvm::APInt>(Other.ValVariant))};
-    default:
-      return {nullptr};
-    }
-  }
+  case llvm::BinaryOperator::BinaryOps::UDiv:
   case llvm::BinaryOperator::BinaryOps::URem: {
     if (VariantType != Other.VariantType) {
       return {nullptr};
     }
     switch (VariantType) {
-    case EdgeValue::Integer:
-      return {std::get<llvm::APInt>(ValVariant)
-                  .urem(std::get<llvm::APInt>(Other.ValVariant))};
+    case EdgeValue::Integer: {
+      auto Bits = std::max(Aux, Other.Aux);
+      auto Divisor = zext(Other.IntVal, Bits);
+      if (Divisor == 0) {
+        return {nullptr};
+      }
+      auto Dividend = zext(IntVal, Bits);
+      return makeInt(Op == llvm::BinaryOperator::BinaryOps::UDiv
+                         ? Dividend / Divisor
+                         : Dividend % Divisor,
+                     Bits);
+    }
     default:
       return {nullptr};
     }
@@ -633,7 +676,12 @@ ev_t join(const ev_t &Lhs, const ev_t &Rhs, size_t MaxSize) {
     // llvm::outs() << "\t=> <TOP>" << std::endl;
     return {{nullptr}};
   }
-  ev_t Ret(Lhs.begin(), Lhs.end());
+  if (Lhs == Rhs) {
+    return Lhs;
+  }
+  // Each insertion is a binary search into a sorted array of at most MaxSize
+  // elements
+  ev_t Ret = Lhs;
 
   for (const auto &Elem : Rhs) {
     Ret.insert(Elem);
@@ -664,7 +712,7 @@ llvm::raw_ostream &operator<<(llvm::raw_ostream &Os, const ev_t &V) {
 
 bool operator<(const ev_t &Lhs, const ev_t &Rhs) {
   if (Lhs.size() >= Rhs.size()) {
-    return Lhs != Rhs && (Lhs.empty() || Rhs == ev_t({EdgeValue::TopValue}));
+    return Lhs != Rhs && (Lhs.empty() || isTopValue(Rhs));
   }
   for (const auto &Elem : Lhs) {
     if (!Rhs.count(Elem)) {
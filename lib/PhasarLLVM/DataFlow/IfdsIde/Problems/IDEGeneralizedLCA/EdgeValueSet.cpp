@@ -9,49 +9,55 @@
 
 #include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDEGeneralizedLCA/EdgeValueSet.h"
 
+#include <algorithm>
+
 namespace psr::glca {
 
 EdgeValueSet::EdgeValueSet() : Underlying({EdgeValue(nullptr)}) {}
 
-EdgeValueSet::EdgeValueSet(std::initializer_list<EdgeValue> Ilist)
-    : Underlying(Ilist) {}
-auto EdgeValueSet::begin() -> decltype(Underlying.begin()) {
-  return Underlying.begin();
-}
-auto EdgeValueSet::end() -> decltype(Underlying.end()) {
-  return Underlying.end();
-}
-auto EdgeValueSet::begin() const -> decltype(Underlying.begin()) {
-  return Underlying.begin();
+EdgeValueSet::EdgeValueSet(std::initializer_list<EdgeValue> Ilist) {
+  for (const auto &Ev : Ilist) {
+    insert(Ev);
+  }
 }
-auto EdgeValueSet::end() const -> decltype(Underlying.end()) {
-  return Underlying.end();
+
+auto EdgeValueSet::find(const EdgeValue &Ev) const -> const_iterator {
+  // Floating-point values compare equal within an epsilon. The closest
+  // elements above and below Ev are at the lower bound and right before it, so
+  // if any element compares equal to Ev, one of these two does
+  const auto *It = std::lower_bound(begin(), end(), Ev, EdgeValue::lessThan);
+  if (It != end() && *It == Ev) {
+    return It;
+  }
+  if (It != begin() && *std::prev(It) == Ev) {
+    return std::prev(It);
+  }
+  return end();
 }
+
 int EdgeValueSet::count(const EdgeValue &Ev) const {
-  return Underlying.count(Ev);
-}
-auto EdgeValueSet::find(const EdgeValue &Ev) -> decltype(Underlying.find(Ev)) {
-  return Underlying.find(Ev);
-}
-auto EdgeValueSet::find(const EdgeValue &Ev) const
-    -> decltype(Underlying.find(Ev)) {
-  return Underlying.find(Ev);
+  return find(Ev) != end();
 }
 
-size_t EdgeValueSet::size() const { return Underlying.size(); }
 auto EdgeValueSet::insert(const EdgeValue &Ev)
-    -> decltype(Underlying.insert(Ev)) {
-  return Underlying.insert(Ev);
+    -> std::pair<const_iterator, bool> {
+  const auto *It = std::lower_bound(begin(), end(), Ev, EdgeValue::lessThan);
+  if (It != end() && *It == Ev) {
+    return {It, false};
+  }
+  if (It != begin() && *std::prev(It) == Ev) {
+    return {std::prev(It), false};
+  }
+  auto Pos = It - begin();
+  Underlying.insert(Underlying.begin() + Pos, Ev);
+  return {begin() + Pos, true};
 }
-auto EdgeValueSet::insert(EdgeValue &&Ev) -> decltype(Underlying.insert(Ev)) {
-  return Underlying.insert(Ev);
-}
-bool EdgeValueSet::empty() const { return Underlying.empty(); }
+
 bool EdgeValueSet::operator==(const EdgeValueSet &Other) const {
-  return Underlying == Other.Underlying;
+  return std::equal(begin(), end(), Other.begin(), Other.end());
 }
 bool EdgeValueSet::operator!=(const EdgeValueSet &Other) const {
-  return Underlying != Other.Underlying;
+  return !(*this == Other);
 }
 
 } // namespace psr::glca
@@ -36,6 +36,10 @@
 
 namespace psr::detail {
 
+IDETypeStateAnalysisBase::IDETypeStateAnalysisBase(
+    LLVMAliasInfoRef PT, const TypeStateDescriptionBase *TSD)
+    : TSD(TSD), TypeNameOfInterest(TSD->getTypeNameOfInterest()), PT(PT) {}
+
 auto IDETypeStateAnalysisBase::getNormalFlowFunction(n_t Curr, n_t /*Succ*/)
     -> FlowFunctionPtrType {
   // Check if Alloca's type matches the target type. If so, generate from zero
@@ -99,7 +103,7 @@ auto IDETypeStateAnalysisBase::getCallFlowFunction(n_t CallSite, f_t DestFun)
     -> FlowFunctionPtrType {
   // Kill all data-flow facts if we hit a function of the target API.
   // Those functions are modled within Call-To-Return.
-  if (isAPIFunction(llvm::demangle(DestFun->getName().str()))) {
+  if (getFunctionInfo(DestFun).IsAPIFunction) {
     return killAllFlows();
   }
   // Otherwise, if we have an ordinary function call, we can just use the
@@ -184,9 +188,9 @@ auto IDETypeStateAnalysisBase::getCallToRetFlowFunction(
   const auto *CS = llvm::cast<llvm::CallBase>(CallSite);
   bool DeclarationOnlyCalleeFound = false;
   for (const auto *Callee : Callees) {
-    std::string DemangledFname = llvm::demangle(Callee->getName().str());
+    const auto &Info = getFunctionInfo(Callee);
     // Generate the return value of factory functions from zero value
-    if (isFactoryFunction(DemangledFname)) {
+    if (Info.IsFactoryFunction) {
       return this->generateFromZero(CS);
     }
 
@@ -204,7 +208,7 @@ auto IDETypeStateAnalysisBase::getCallToRetFlowFunction(
     // not be killed during call-to-return, since it is not safe to assume
     // that the return value will be used afterwards, i.e. is stored to memory
     // pointed to by related alloca's.
-    if (!isAPIFunction(DemangledFname) && !Callee->isDeclaration()) {
+    if (!Info.IsAPIFunction && !Callee->isDeclaration()) {
       for (const auto &Arg : CS->args()) {
         if (hasMatchingType(Arg)) {
           return killManyFlows(getWMAliasesAndAllocas(Arg.get()));
@@ -225,9 +229,33 @@ auto IDETypeStateAnalysisBase::getSummaryFlowFunction(n_t /*CallSite*/,
   return nullptr;
 }
 
+auto IDETypeStateAnalysisBase::getFunctionInfo(const llvm::Function *F)
+    -> const TSFunctionInfo & {
+  auto [It, Inserted] = FunctionInfos.try_emplace(F);
+  if (!Inserted) {
+    return It->second;
+  }
+
+  auto &Info = It->second;
+  std::string DemangledFname = llvm::demangle(F->getName().str());
+  Info.IsAPIFunction = TSD->isAPIFunction(DemangledFname);
+  if (!Info.IsAPIFunction) {
+    return Info;
+  }
+
+  Info.Token = TSD->getToken(DemangledFname);
+  Info.IsFactoryFunction = TSD->isFactoryFunction(DemangledFname);
+  Info.IsConsumingFunction = TSD->isConsumingFunction(DemangledFname);
+  if (Info.IsConsumingFunction) {
+    auto ParamIdx = TSD->getConsumerParamIdx(DemangledFname);
+    Info.ConsumerParamIdx.append(ParamIdx.begin(), ParamIdx.end());
+  }
+  return Info;
+}
+
 auto IDETypeStateAnalysisBase::getRelevantAllocas(d_t V) -> container_type {
-  if (RelevantAllocaCache.find(V) != RelevantAllocaCache.end()) {
-    return RelevantAllocaCache[V];
+  if (auto It = RelevantAllocaCache.find(V); It != RelevantAllocaCache.end()) {
+    return It->second;
   }
   auto AliasSet = getWMAliasSet(V);
   container_type RelevantAllocas;
@@ -263,14 +291,13 @@ auto IDETypeStateAnalysisBase::getRelevantAllocas(d_t V) -> container_type {
 }
 
 auto IDETypeStateAnalysisBase::getWMAliasSet(d_t V) -> container_type {
-  if (AliasCache.find(V) != AliasCache.end()) {
-    container_type AliasSet(AliasCache[V].begin(), AliasCache[V].end());
-    return AliasSet;
+  if (auto It = AliasCache.find(V); It != AliasCache.end()) {
+    return container_type(It->second->begin(), It->second->end());
   }
   auto PTS = PT.getAliasSet(V);
   for (const auto *Alias : *PTS) {
     if (hasMatchingType(Alias)) {
-      AliasCache[Alias] = *PTS;
+      AliasCache[Alias] = PTS;
     }
   }
   container_type AliasSet(PTS->begin(), PTS->end());
@@ -303,15 +330,22 @@ auto IDETypeStateAnalysisBase::getLocalAliasesAndAllocas(
 }
 
 bool IDETypeStateAnalysisBase::hasMatchingTypeName(const llvm::Type *Ty) {
+  auto [It, Inserted] = MatchingTypeNameCache.try_emplace(Ty, false);
+  if (!Inserted) {
+    return It->second;
+  }
+
   if (const auto *StructTy = llvm::dyn_cast<llvm::StructType>(Ty)) {
-    return isTypeNameOfInterest(StructTy->getName());
+    It->second = StructTy->getName().contains(TypeNameOfInterest);
+    return It->second;
   }
   // primitive type
   std::string Str;
   llvm::raw_string_ostream S(Str);
   S << *Ty;
   S.flush();
-  return isTypeNameOfInterest(Str);
+  It->second = llvm::StringRef(Str).contains(TypeNameOfInterest);
+  return It->second;
 }
 
 bool IDETypeStateAnalysisBase::hasMatchingType(d_t V) {
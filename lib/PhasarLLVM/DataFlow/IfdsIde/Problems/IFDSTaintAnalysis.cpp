@@ -41,16 +41,20 @@ namespace psr {
 using d_t = IFDSTaintAnalysis::d_t;
 using container_type = IFDSTaintAnalysis::container_type;
 
-IFDSTaintAnalysis::IFDSTaintAnalysis(const LLVMProjectIRDB *IRDB,
-                                     LLVMAliasInfoRef PT,
-                                     const LLVMTaintConfig *Config,
-                                     std::vector<std::string> EntryPoints,
-                                     bool TaintMainArgs)
+IFDSTaintAnalysis::IFDSTaintAnalysis(
+    const LLVMProjectIRDB *IRDB, LLVMAliasInfoRef PT,
+    const LLVMTaintConfig *Config, std::vector<std::string> EntryPoints,
+    bool TaintMainArgs,
+    const library_summary::FunctionDataFlowFacts *ModuleSummaries)
     : IFDSTabulationProblem(IRDB, std::move(EntryPoints), createZeroValue()),
-      Config(Config), PT(PT), TaintMainArgs(TaintMainArgs),
-      Llvmfdff(library_summary::readFromFDFF(getLibCSummary(), *IRDB)) {
+      Config(Config), PT(PT), TaintMainArgs(TaintMainArgs) {
   assert(Config != nullptr);
   assert(PT);
+
+  if (ModuleSummaries) {
+    Llvmfdff = library_summary::readFromFDFF(*ModuleSummaries, *IRDB);
+  }
+  Llvmfdff.mergeWith(library_summary::readFromFDFF(getLibCSummary(), *IRDB));
 }
 
 bool IFDSTaintAnalysis::isSourceCall(const llvm::CallBase *CB,
@@ -314,6 +318,13 @@ auto IFDSTaintAnalysis::getNormalFlowFunction(n_t Curr,
   return identityFlow();
 }
 
+bool IFDSTaintAnalysis::isIrrelevantStmt(n_t Stmt) const {
+  // All instructions that getNormalFlowFunction() does not handle specially
+  return !llvm::isa<llvm::StoreInst, llvm::LoadInst, llvm::GetElementPtrInst,
+                    llvm::ExtractValueInst, llvm::InsertValueInst,
+                    llvm::CastInst, llvm::CallBase>(Stmt);
+}
+
 auto IFDSTaintAnalysis::getCallFlowFunction(n_t CallSite, f_t DestFun)
     -> FlowFunctionPtrType {
   const auto *CS = llvm::cast<llvm::CallBase>(CallSite);
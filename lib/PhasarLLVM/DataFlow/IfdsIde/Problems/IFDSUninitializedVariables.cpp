@@ -214,6 +214,19 @@ IFDSUninitializedVariables::getNormalFlowFunction(
   });
 }
 
+bool IFDSUninitializedVariables::isIrrelevantStmt(n_t Stmt) const {
+  if (llvm::isa<llvm::StoreInst, llvm::AllocaInst, llvm::CallBase>(Stmt)) {
+    return false;
+  }
+  // The generic case of getNormalFlowFunction() only generates facts for
+  // instructions that use a data-flow fact or an undef value
+  return llvm::all_of(Stmt->operands(), [](const llvm::Value *Operand) {
+    return llvm::isa<llvm::BasicBlock>(Operand) ||
+           (llvm::isa<llvm::ConstantData>(Operand) &&
+            !llvm::isa<llvm::UndefValue>(Operand));
+  });
+}
+
 IFDSUninitializedVariables::FlowFunctionPtrType
 IFDSUninitializedVariables::getCallFlowFunction(
     IFDSUninitializedVariables::n_t CallSite,
@@ -14,6 +14,8 @@
 #include "llvm/ADT/StringMap.h"
 #include "llvm/Support/ErrorHandling.h"
 
+#include <cassert>
+#include <iterator>
 #include <string>
 
 namespace psr {
@@ -112,18 +114,24 @@ bool CSTDFILEIOTypeStateDescription::isAPIFunction(llvm::StringRef F) const {
 CSTDFILEIOState
 CSTDFILEIOTypeStateDescription::getNextState(llvm::StringRef Tok,
                                              State S) const {
-  if (isAPIFunction(Tok)) {
-    auto X = static_cast<std::underlying_type_t<CSTDFILEIOToken>>(
-        funcNameToToken(Tok));
-
-    auto Ret = Delta[X][int(S)];
-    // if (ret == error()) {
-    //  std::cerr << "getNextState(" << Tok << ", " << stateToString(S)
-    //            << ") = " << stateToString(Ret) << std::endl;
-    // }
-    return Ret;
+  return getNextStateOfToken(getToken(Tok), S, nullptr);
+}
+
+auto CSTDFILEIOTypeStateDescription::getToken(llvm::StringRef F) const
+    -> TokenTy {
+  if (!isAPIFunction(F)) {
+    return NonAPIToken;
   }
-  return CSTDFILEIOState::BOT;
+  return static_cast<TokenTy>(funcNameToToken(F));
+}
+
+CSTDFILEIOState CSTDFILEIOTypeStateDescription::getNextStateOfToken(
+    TokenTy Tok, State S, const llvm::CallBase * /*CallSite*/) const {
+  if (Tok == NonAPIToken) {
+    return CSTDFILEIOState::BOT;
+  }
+  assert(Tok < std::size(Delta));
+  return Delta[Tok][int(S)];
 }
 
 std::string CSTDFILEIOTypeStateDescription::getTypeNameOfInterest() const {
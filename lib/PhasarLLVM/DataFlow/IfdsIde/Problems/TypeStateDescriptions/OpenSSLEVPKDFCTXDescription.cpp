@@ -15,6 +15,8 @@
 #include "llvm/IR/Value.h"
 #include "llvm/Support/ErrorHandling.h"
 
+#include <cassert>
+#include <iterator>
 #include <set>
 #include <string>
 
@@ -84,44 +86,39 @@ bool OpenSSLEVPKDFCTXDescription::isAPIFunction(llvm::StringRef F) const {
 OpenSSLEVPKDFCTXState
 OpenSSLEVPKDFCTXDescription::getNextState(llvm::StringRef Tok,
                                           TypeStateDescription::State S) const {
-  if (isAPIFunction(Tok)) {
-    auto NameToTok = funcNameToToken(Tok);
-    auto Ret = Delta[static_cast<std::underlying_type_t<OpenSSLEVTKDFToken>>(
-        NameToTok)][int(S)];
-
-    // std::cout << "delta[" << Tok << ", " << stateToString(S)
-    //           << "] = " << stateToString(ret) << std::endl;
-    return Ret;
-  }
-  return OpenSSLEVPKDFCTXState::BOT;
+  return getNextStateOfToken(getToken(Tok), S, nullptr);
 }
 OpenSSLEVPKDFCTXState OpenSSLEVPKDFCTXDescription::getNextState(
     llvm::StringRef Tok, TypeStateDescription::State S,
     const llvm::CallBase *CallSite) const {
-  if (isAPIFunction(Tok)) {
-    auto NameToTok = funcNameToToken(Tok);
-    auto Ret = Delta[static_cast<std::underlying_type_t<OpenSSLEVTKDFToken>>(
-        NameToTok)][int(S)];
-
-    if (NameToTok == OpenSSLEVTKDFToken::EVP_KDF_CTX_NEW) {
-      // require the kdf here to be in KDF_FETCHED state
-
-      // requiredKDFState[make_pair(CS.getInstruction(), CS.getArgOperand(0))] =
-      //     (OpenSSLEVPKDFDescription::OpenSSLEVPKDFCTXState::KDF_FETCHED);
-      // cout << "## Factory-Call: ";
-      // cout.flush();
-      // cout << llvmIRToShortString(CS.getInstruction()) << endl;
-      auto KdfState =
-          KDFAnalysisResults.resultAt(CallSite, CallSite->getArgOperand(0));
-      if (KdfState != OpenSSLEVPKDFState::KDF_FETCHED) {
-        return error();
-      }
+  return getNextStateOfToken(getToken(Tok), S, CallSite);
+}
+
+auto OpenSSLEVPKDFCTXDescription::getToken(llvm::StringRef F) const
+    -> TokenTy {
+  if (!isAPIFunction(F)) {
+    return NonAPIToken;
+  }
+  return static_cast<TokenTy>(funcNameToToken(F));
+}
+
+OpenSSLEVPKDFCTXState OpenSSLEVPKDFCTXDescription::getNextStateOfToken(
+    TokenTy Tok, TypeStateDescription::State S,
+    const llvm::CallBase *CallSite) const {
+  if (Tok == NonAPIToken) {
+    return OpenSSLEVPKDFCTXState::BOT;
+  }
+  assert(Tok < std::size(Delta));
+
+  if (CallSite && Tok == TokenTy(OpenSSLEVTKDFToken::EVP_KDF_CTX_NEW)) {
+    // require the kdf here to be in KDF_FETCHED state
+    auto KdfState =
+        KDFAnalysisResults.resultAt(CallSite, CallSite->getArgOperand(0));
+    if (KdfState != OpenSSLEVPKDFState::KDF_FETCHED) {
+      return error();
     }
-    // std::cout << "delta[" << Tok << ", " << stateToString(S)
-    //           << "] = " << stateToString(ret) << std::endl;
-    return Ret;
   }
-  return OpenSSLEVPKDFCTXState::BOT;
+  return Delta[Tok][int(S)];
 }
 
 std::string OpenSSLEVPKDFCTXDescription::getTypeNameOfInterest() const {
@@ -13,6 +13,8 @@
 
 #include "llvm/Support/ErrorHandling.h"
 
+#include <cassert>
+#include <iterator>
 #include <map>
 
 namespace psr {
@@ -63,14 +65,24 @@ bool OpenSSLEVPKDFDescription::isAPIFunction(llvm::StringRef F) const {
 OpenSSLEVPKDFState
 OpenSSLEVPKDFDescription::getNextState(llvm::StringRef Tok,
                                        TypeStateDescription::State S) const {
-  if (isAPIFunction(Tok)) {
-    auto Ret = Delta[static_cast<std::underlying_type_t<OpenSSLEVTKDFToken>>(
-        funcNameToToken(Tok))][int(S)];
-    // std::cout << "Delta[" << Tok << ", " << stateToString(S)
-    //           << "] = " << stateToString(ret) << std::endl;
-    return Ret;
+  return getNextStateOfToken(getToken(Tok), S, nullptr);
+}
+
+auto OpenSSLEVPKDFDescription::getToken(llvm::StringRef F) const -> TokenTy {
+  if (!isAPIFunction(F)) {
+    return NonAPIToken;
   }
-  return OpenSSLEVPKDFState::BOT;
+  return static_cast<TokenTy>(funcNameToToken(F));
+}
+
+OpenSSLEVPKDFState OpenSSLEVPKDFDescription::getNextStateOfToken(
+    TokenTy Tok, TypeStateDescription::State S,
+    const llvm::CallBase * /*CallSite*/) const {
+  if (Tok == NonAPIToken) {
+    return OpenSSLEVPKDFState::BOT;
+  }
+  assert(Tok < std::size(Delta));
+  return Delta[Tok][int(S)];
 }
 
 std::string OpenSSLEVPKDFDescription::getTypeNameOfInterest() const {
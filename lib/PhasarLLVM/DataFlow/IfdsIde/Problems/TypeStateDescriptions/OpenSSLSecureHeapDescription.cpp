@@ -12,6 +12,9 @@
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/Support/ErrorHandling.h"
 
+#include <cassert>
+#include <iterator>
+
 using namespace std;
 using namespace psr;
 
@@ -79,31 +82,39 @@ bool OpenSSLSecureHeapDescription::isAPIFunction(llvm::StringRef F) const {
 
 OpenSSLSecureHeapState OpenSSLSecureHeapDescription::getNextState(
     llvm::StringRef Tok, TypeStateDescription::State S) const {
-  if (isAPIFunction(Tok)) {
-    auto Ftok = static_cast<std::underlying_type_t<OpenSSLSecureHeapToken>>(
-        funcNameToToken(Tok));
-
-    return Delta[Ftok][int(S)];
-  }
-  return OpenSSLSecureHeapState::BOT;
+  return getNextStateOfToken(getToken(Tok), S, nullptr);
 }
 
 OpenSSLSecureHeapState OpenSSLSecureHeapDescription::getNextState(
     llvm::StringRef Tok, TypeStateDescription::State S,
     const llvm::CallBase *CallSite) const {
-  if (isAPIFunction(Tok)) {
-    auto Ftok = static_cast<std::underlying_type_t<OpenSSLSecureHeapToken>>(
-        funcNameToToken(Tok));
+  return getNextStateOfToken(getToken(Tok), S, CallSite);
+}
+
+auto OpenSSLSecureHeapDescription::getToken(llvm::StringRef F) const
+    -> TokenTy {
+  if (!isAPIFunction(F)) {
+    return NonAPIToken;
+  }
+  return static_cast<TokenTy>(funcNameToToken(F));
+}
+
+OpenSSLSecureHeapState OpenSSLSecureHeapDescription::getNextStateOfToken(
+    TokenTy Tok, TypeStateDescription::State S,
+    const llvm::CallBase *CallSite) const {
+  if (Tok == NonAPIToken) {
+    return CallSite ? error() : OpenSSLSecureHeapState::BOT;
+  }
+  assert(Tok < std::size(Delta));
+
+  if (CallSite) {
     auto Results = SecureHeapPropagationResults.resultAt(
         CallSite, SecureHeapFact::INITIALIZED);
     if (Results != SecureHeapValue::INITIALIZED) {
-      // std::cerr << "ERROR: SecureHeap not initialized at "
-      //          << llvmIRToShortString(CS.getInstruction()) << std::endl;
       return error();
     }
-    return Delta[Ftok][int(S)];
   }
-  return error();
+  return Delta[Tok][int(S)];
 }
 
 std::string OpenSSLSecureHeapDescription::getTypeNameOfInterest() const {
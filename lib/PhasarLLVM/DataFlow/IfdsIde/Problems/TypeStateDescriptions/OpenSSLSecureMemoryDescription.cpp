@@ -14,6 +14,8 @@
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/Support/ErrorHandling.h"
 
+#include <cassert>
+#include <iterator>
 #include <string>
 
 using namespace std;
@@ -101,12 +103,26 @@ bool OpenSSLSecureMemoryDescription::isAPIFunction(llvm::StringRef F) const {
 
 OpenSSLSecureMemoryState OpenSSLSecureMemoryDescription::getNextState(
     llvm::StringRef Tok, TypeStateDescription::State S) const {
-  auto Token = funcNameToToken(Tok);
-  if (Token != OpenSSLSecureMemoryToken::STAR) {
-    return Delta[static_cast<std::underlying_type_t<OpenSSLSecureMemoryToken>>(
-        Token)][int(S)];
+  return getNextStateOfToken(getToken(Tok), S, nullptr);
+}
+
+auto OpenSSLSecureMemoryDescription::getToken(llvm::StringRef F) const
+    -> TokenTy {
+  auto Token = funcNameToToken(F);
+  if (Token == OpenSSLSecureMemoryToken::STAR) {
+    return NonAPIToken;
   }
-  return OpenSSLSecureMemoryState::BOT;
+  return static_cast<TokenTy>(Token);
+}
+
+OpenSSLSecureMemoryState OpenSSLSecureMemoryDescription::getNextStateOfToken(
+    TokenTy Tok, TypeStateDescription::State S,
+    const llvm::CallBase * /*CallSite*/) const {
+  if (Tok == NonAPIToken) {
+    return OpenSSLSecureMemoryState::BOT;
+  }
+  assert(Tok < std::size(Delta));
+  return Delta[Tok][int(S)];
 }
 
 std::string OpenSSLSecureMemoryDescription::getTypeNameOfInterest() const {
@@ -69,6 +69,13 @@ InterMonoFullConstantPropagation::normalFlow(
   return IntraMonoFullConstantPropagation::normalFlow(Inst, In);
 }
 
+bool InterMonoFullConstantPropagation::isIdentityNormalFlow(
+    InterMonoFullConstantPropagation::n_t Inst) {
+  // Must be kept in sync with IntraMonoFullConstantPropagation::normalFlow()
+  return !llvm::isa<llvm::AllocaInst, llvm::StoreInst, llvm::LoadInst,
+                    llvm::BinaryOperator>(Inst);
+}
+
 InterMonoFullConstantPropagation::mono_container_t
 InterMonoFullConstantPropagation::callFlow(
     InterMonoFullConstantPropagation::n_t CallSite,
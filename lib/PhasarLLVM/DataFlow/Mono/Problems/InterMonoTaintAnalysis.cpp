@@ -83,6 +83,13 @@ InterMonoTaintAnalysis::mono_container_t InterMonoTaintAnalysis::normalFlow(
   return Out;
 }
 
+bool InterMonoTaintAnalysis::isIdentityNormalFlow(
+    InterMonoTaintAnalysis::n_t Inst) {
+  // Must be kept in sync with normalFlow()
+  return !llvm::isa<llvm::StoreInst, llvm::LoadInst, llvm::GetElementPtrInst,
+                    llvm::CastInst>(Inst);
+}
+
 InterMonoTaintAnalysis::mono_container_t InterMonoTaintAnalysis::callFlow(
     InterMonoTaintAnalysis::n_t CallSite, const llvm::Function *Callee,
     const InterMonoTaintAnalysis::mono_container_t &In) {
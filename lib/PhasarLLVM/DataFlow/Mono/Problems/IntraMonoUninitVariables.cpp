@@ -15,13 +15,13 @@
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
 #include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
 #include "phasar/Utils/BitVectorSet.h"
+#include "phasar/Utils/Logger.h"
 
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/Value.h"
 
-#include <algorithm>
 #include <utility>
 
 using namespace std;
@@ -32,46 +32,27 @@ IntraMonoUninitVariables::IntraMonoUninitVariables(
     const LLVMProjectIRDB *IRDB, const LLVMTypeHierarchy *TH,
     const LLVMBasedCFG *CF, LLVMAliasInfoRef PT,
     std::vector<std::string> EntryPoints)
-    : IntraMonoProblem<IntraMonoUninitVariablesDomain>(IRDB, TH, CF, PT,
-                                                       std::move(EntryPoints)) {
-}
-
-IntraMonoUninitVariables::mono_container_t IntraMonoUninitVariables::merge(
-    const IntraMonoUninitVariables::mono_container_t &Lhs,
-    const IntraMonoUninitVariables::mono_container_t &Rhs) {
-  IntraMonoUninitVariables::mono_container_t Intersect;
-  std::set_intersection(Lhs.begin(), Lhs.end(), Rhs.begin(), Rhs.end(),
-                        std::inserter(Intersect, Intersect.begin()));
-  return Intersect;
-}
-
-bool IntraMonoUninitVariables::equal_to(
-    const IntraMonoUninitVariables::mono_container_t &Lhs,
-    const IntraMonoUninitVariables::mono_container_t &Rhs) {
-  return Lhs == Rhs;
-}
+    : IntraMonoGenKillProblem<IntraMonoUninitVariablesDomain>(
+          IRDB, TH, CF, PT, std::move(EntryPoints)) {}
 
 IntraMonoUninitVariables::mono_container_t IntraMonoUninitVariables::allTop() {
   return {};
 }
 
-IntraMonoUninitVariables::mono_container_t IntraMonoUninitVariables::normalFlow(
-    IntraMonoUninitVariables::n_t Inst,
-    const IntraMonoUninitVariables::mono_container_t &In) {
-  auto Out = In;
+void IntraMonoUninitVariables::genKill(IntraMonoUninitVariables::n_t Inst,
+                                       llvm::SmallVectorImpl<d_t> &Gen,
+                                       llvm::SmallVectorImpl<d_t> &Kill) {
   if (const auto *Alloca = llvm::dyn_cast<llvm::AllocaInst>(Inst)) {
-    Out.insert(Alloca);
+    Gen.push_back(Alloca);
   }
   if (const auto *Store = llvm::dyn_cast<llvm::StoreInst>(Inst)) {
     if (Store->getValueOperand()->getType()->isIntegerTy() &&
         llvm::isa<llvm::ConstantData>(Store->getValueOperand())) {
-      llvm::outs() << "Found initialization at: ";
-      Store->print(llvm::outs());
-      llvm::outs() << '\n';
-      Out.erase(Store->getPointerOperand());
+      PHASAR_LOG_LEVEL(DEBUG,
+                       "Found initialization at: " << llvmIRToString(Store));
+      Kill.push_back(Store->getPointerOperand());
     }
   }
-  return Out;
 }
 
 unordered_map<IntraMonoUninitVariables::n_t,
@@ -10,10 +10,9 @@
 namespace psr {
 LLVMPathConstraints::LLVMPathConstraints(z3::context *Z3Ctx,
                                          bool IgnoreDebugInstructions)
-    : Z3Ctx(Z3Ctx), IgnoreDebugInstructions(IgnoreDebugInstructions) {
-  if (!Z3Ctx) {
-    this->Z3Ctx = std::make_unique<z3::context>();
-  }
+    : Z3Ctx(Z3Ctx ? MaybeUniquePtr<z3::context>(Z3Ctx)
+                  : MaybeUniquePtr<z3::context>(std::make_unique<z3::context>())),
+      Solver(*this->Z3Ctx), IgnoreDebugInstructions(IgnoreDebugInstructions) {
   Z3_set_ast_print_mode(getContext(),
                         Z3_ast_print_mode::Z3_PRINT_SMTLIB2_COMPLIANT);
 }
@@ -47,7 +46,7 @@ auto LLVMPathConstraints::internalGetConstraintAndVariablesFromEdge(
 std::optional<z3::expr>
 LLVMPathConstraints::getConstraintFromEdge(const llvm::Instruction *Curr,
                                            const llvm::Instruction *Succ) {
-  if (auto CV = internalGetConstraintAndVariablesFromEdge(Curr, Succ)) {
+  if (auto CV = getConstraintAndVariablesFromEdge(Curr, Succ)) {
     return CV->Constraint;
   }
 
@@ -57,6 +56,11 @@ LLVMPathConstraints::getConstraintFromEdge(const llvm::Instruction *Curr,
 auto LLVMPathConstraints::getConstraintAndVariablesFromEdge(
     const llvm::Instruction *Curr, const llvm::Instruction *Succ)
     -> std::optional<ConstraintAndVariables> {
+  auto [It, Inserted] = EdgeConstraints.try_emplace({Curr, Succ});
+  if (!Inserted) {
+    return It->second;
+  }
+
   auto CV = internalGetConstraintAndVariablesFromEdge(Curr, Succ);
   if (CV) {
     /// Deduplicate the Variables vector
@@ -65,7 +69,8 @@ auto LLVMPathConstraints::getConstraintAndVariablesFromEdge(
                         CV->Variables.end());
   }
 
-  return CV;
+  // Note: internalGetConstraintAndVariablesFromEdge() may have invalidated It
+  return EdgeConstraints[{Curr, Succ}] = std::move(CV);
 }
 
 // void LLVMPathConstraints::getConstraintsInPath(
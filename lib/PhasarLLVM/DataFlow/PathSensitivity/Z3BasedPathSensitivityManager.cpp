@@ -1,12 +1,19 @@
 #include "phasar/PhasarLLVM/DataFlow/PathSensitivity/LLVMPathConstraints.h"
 #include "phasar/PhasarLLVM/DataFlow/PathSensitivity/Z3BasedPathSensitvityManager.h"
+#include "phasar/PhasarLLVM/DataFlow/PathSensitivity/Z3ConstraintSolver.h"
 #include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
 #include "phasar/Utils/Logger.h"
+#include "phasar/Utils/MaybeUniquePtr.h"
 
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/IntrinsicInst.h"
 #include "llvm/Support/Casting.h"
 
+#include <algorithm>
+#include <optional>
+
 namespace psr {
 z3::expr Z3BasedPathSensitivityManagerBase::filterOutUnreachableNodes(
     graph_type &RevDAG, vertex_t Leaf,
@@ -17,14 +24,17 @@ z3::expr Z3BasedPathSensitivityManagerBase::filterOutUnreachableNodes(
     llvm::BitVector Visited{};
     z3::expr True;
     z3::expr False;
+    z3::expr Additional;
     llvm::SmallVector<z3::expr, 0> NodeConstraints{};
     size_t Ctr = 0;
-    z3::solver Solver;
+    Z3ConstraintSolver &Solver;
 
-    explicit FilterContext(z3::context &Z3Ctx)
-        : True(Z3Ctx.bool_val(true)), False(Z3Ctx.bool_val(false)),
-          Solver(Z3Ctx) {}
-  } Ctx(LPC.getContext());
+    explicit FilterContext(Z3ConstraintSolver &Solver,
+                           const std::optional<z3::expr> &Additional)
+        : True(Solver.getContext().bool_val(true)),
+          False(Solver.getContext().bool_val(false)),
+          Additional(Additional.value_or(True)), Solver(Solver) {}
+  } Ctx(LPC.getSolver(), Config.AdditionalConstraint);
 
   Ctx.Visited.resize(graph_traits_t::size(RevDAG));
   Ctx.NodeConstraints.resize(graph_traits_t::size(RevDAG), Ctx.True);
@@ -34,10 +44,6 @@ z3::expr Z3BasedPathSensitivityManagerBase::filterOutUnreachableNodes(
     TotalNumEdges += graph_traits_t::outDegree(RevDAG, I);
   }
 
-  if (Config.AdditionalConstraint) {
-    Ctx.Solver.add(*Config.AdditionalConstraint);
-  }
-
   // NOLINTNEXTLINE(readability-identifier-naming)
   auto doFilter = [&Ctx, &RevDAG, &LPC, Leaf](auto &doFilter,
                                               vertex_t Vtx) -> z3::expr {
@@ -64,8 +70,6 @@ z3::expr Z3BasedPathSensitivityManagerBase::filterOutUnreachableNodes(
       if (!Ctx.Visited.test(Adj)) {
         doFilter(doFilter, Adj);
       }
-      Ctx.Solver.push();
-      Ctx.Solver.add(X);
       auto Y = Ctx.NodeConstraints[Adj];
       const auto &AdjPP = graph_traits_t::node(RevDAG, Adj);
       assert(!AdjPP.empty());
@@ -74,18 +78,13 @@ z3::expr Z3BasedPathSensitivityManagerBase::filterOutUnreachableNodes(
         Y = Y && *Constr;
       }
 
-      Ctx.Solver.add(Y);
-
-      auto Sat = Ctx.Solver.check();
+      auto Sat = Ctx.Solver.check({Ctx.Additional, X, Y});
       if (Sat == z3::check_result::unsat) {
         Iter = graph_traits_t::removeEdge(RevDAG, Vtx, It);
         Ctx.Ctr++;
       } else {
         Ys.push_back(std::move(Y));
       }
-
-      Ctx.Solver.pop();
-      // Idx++;
     }
 
     if (graph_traits_t::outDegree(RevDAG, Vtx) == 0) {
@@ -323,19 +322,18 @@ public:
   ConstraintPathFilter(LLVMPathConstraints &LPC,
                        const z3::expr &AdditionalConstraint,
                        size_t *CompletedCtr) noexcept
-      : LPC(LPC), Solver(LPC.getContext()), CompletedCtr(*CompletedCtr) {
-    Solver.add(AdditionalConstraint);
-    Solver.push();
+      : LPC(LPC), Solver(LPC.getSolver()), CompletedCtr(*CompletedCtr) {
+    Constraints.push_back(AdditionalConstraint);
     NumAtomsStack.push_back(0);
   }
 
   void saveState() {
     NumAtomsStack.push_back(NumAtomsStack.back());
-    Solver.push();
+    NumConstraintsStack.push_back(Constraints.size());
   }
 
   void restoreState() {
-    Solver.pop();
+    Constraints.truncate(NumConstraintsStack.pop_back_val());
     auto NumAtoms = NumAtomsStack.pop_back_val();
     assert(!NumAtomsStack.empty());
     auto Diff = NumAtoms - NumAtomsStack.back();
@@ -344,7 +342,6 @@ public:
     }
     NeedSolverInvocation = false;
     LocalAtoms.clear();
-    Model = std::nullopt;
   }
 
   void saveEdge(n_t Prev, n_t Inst) {
@@ -352,7 +349,7 @@ public:
     if (auto ConstrAndVariables =
             LPC.getConstraintAndVariablesFromEdge(Prev, Inst)) {
 
-      Solver.add(ConstrAndVariables->Constraint);
+      Constraints.push_back(ConstrAndVariables->Constraint);
 
       LocalAtoms.append(ConstrAndVariables->Variables);
     }
@@ -371,7 +368,7 @@ public:
 
     NeedSolverInvocation = false;
 
-    auto Res = Solver.check();
+    auto Res = Solver.check(Constraints);
     ++Ctr;
 #ifdef DYNAMIC_LOG
     if (Ctr % 10000 == 0) {
@@ -389,8 +386,6 @@ public:
     auto Ret = Res != z3::check_result::unsat;
     if (!Ret) {
       ++RejectedCtr;
-    } else {
-      Model = Solver.get_model();
     }
 
     return Ret;
@@ -403,19 +398,15 @@ public:
   }
 
   z3::expr getPathConstraints() {
-    auto Vec = Solver.assertions();
-    if (Vec.empty()) {
-      return LPC.getContext().bool_val(true);
-    }
-
-    auto Ret = Vec[0];
-    for (int I = 1, End = int(Vec.size()); I != End; ++I) {
-      Ret = Ret && Vec[I];
+    auto Ret = Constraints.front();
+    for (const auto &Constr : llvm::makeArrayRef(Constraints).drop_front()) {
+      Ret = Ret && Constr;
     }
     return Ret.simplify();
   }
 
-  z3::model getModel() { return Model.value(); }
+  /// Requires that the current path has been found valid
+  z3::model getModel() { return Solver.getModel(Constraints); }
 
   [[nodiscard]] size_t getNumSolverInvocations() const noexcept { return Ctr; }
 
@@ -440,11 +431,14 @@ private:
   }
 
   LLVMPathConstraints &LPC;
-  z3::solver Solver;
+  Z3ConstraintSolver &Solver;
+  /// The constraints along the current path. The first one is the additional
+  /// constraint from the config
+  llvm::SmallVector<z3::expr, 0> Constraints;
+  llvm::SmallVector<size_t> NumConstraintsStack;
   llvm::SmallSetVector<const llvm::Value *, 8> SymbolicAtoms;
   llvm::SmallVector<unsigned> NumAtomsStack;
   llvm::SmallVector<const llvm::Value *> LocalAtoms;
-  std::optional<z3::model> Model;
   bool NeedSolverInvocation = false;
 
   size_t Ctr = 0;
@@ -453,116 +447,368 @@ private:
   size_t &CompletedCtr;
 };
 
-auto Z3BasedPathSensitivityManagerBase::filterAndFlattenRevDag(
-    graph_type &RevDAG, vertex_t Leaf, n_t FinalInst,
-    const Z3BasedPathSensitivityConfig &Config, LLVMPathConstraints &LPC) const
-    -> FlowPathSequence<n_t> {
-  /// Here, we do the following:
-  /// - Traversing the ReverseDAG in a simple DFS order and maintaining the
-  ///   exact path reaching the current node.
-  /// - On the fly constructing and updating a call-stack to regain
-  ///   context-sensitivity by filtering out paths with invalid returns
-  /// - Similarly on the fly constructing and solving Z3 Path Constraints and
-  ///   filtering out all paths with unsatisfiable constraints
-  /// - Saving all "surviving" paths that end at a leaf to the overall vector
-  ///   that gets returned at the end
-
-  /// Problem: We still have way too many Z3 solver invocations (> 900000 for
-  /// some small test programs)
-  /// Solution idea: In contrast to the context sensitivity check, the Path
-  /// constraints are context-independent. So, it might be beneficial to
-  /// compute the end-reachability constraints of each _node_ in a bottom-up
-  /// fashion leading to PathNodeOwner.size() solver invocations. We then
-  /// still need a subsequent DFS order traversal to collect all remaining
-  /// satisfiable paths, so there we can still apply the context-sensitivity
-  /// check OTF.
-  /// NOTE: This is implemented now in filterOutUnreachableNodes()
+/// Here, we do the following:
+/// - Traversing the ReverseDAG in DFS order with an explicit stack and
+///   maintaining the exact path reaching the current node. The DFS proceeds
+///   one instruction at a time and merges all DAG positions that are reached
+///   by the same instruction sequence, so no path is enumerated twice.
+/// - On the fly constructing and updating a call-stack to regain
+///   context-sensitivity by filtering out paths with invalid returns
+/// - Similarly on the fly constructing and solving Z3 Path Constraints and
+///   filtering out all paths with unsatisfiable constraints
+/// - Suspending the traversal whenever a "surviving" path reaches the leaf,
+///   such that the paths can be consumed one by one
+///
+/// Problem: We still have way too many Z3 solver invocations (> 900000 for
+/// some small test programs)
+/// Solution idea: In contrast to the context sensitivity check, the Path
+/// constraints are context-independent. So, it might be beneficial to
+/// compute the end-reachability constraints of each _node_ in a bottom-up
+/// fashion leading to PathNodeOwner.size() solver invocations. We then
+/// still need a subsequent DFS order traversal to collect all remaining
+/// satisfiable paths, so there we can still apply the context-sensitivity
+/// check OTF.
+/// NOTE: This is implemented now in filterOutUnreachableNodes()
+/// Additionally, all satisfiability checks go through LPC.getSolver(), which
+/// caches the results (and unsat cores) across paths and across queries.
+struct FlowPathGenerator::Impl {
+  using graph_type = Z3BasedPathSensitivityManagerBase::graph_type;
+  using graph_traits_t = GraphTraits<graph_type>;
+  using vertex_t = typename graph_traits_t::vertex_t;
+
+  static constexpr size_t Unreachable = SIZE_MAX;
+
+  /// A position within the reverse DAG: A vertex and the number of its
+  /// instructions that are already on the current path
+  struct Position {
+    vertex_t Vtx{};
+    size_t Offset{};
+
+    friend bool operator==(Position Lhs, Position Rhs) noexcept {
+      return Lhs.Vtx == Rhs.Vtx && Lhs.Offset == Rhs.Offset;
+    }
+  };
+
+  /// All positions that are reached by the same instruction sequence.
+  ///
+  /// Different vertices of the DAG may hold the same instructions, e.g., for
+  /// different data-flow facts. The filters only depend on the instruction
+  /// sequence, so we extend the current path one instruction at a time and
+  /// merge all positions that lead to the same instruction. This way, every
+  /// instruction sequence is visited, and thus yielded, at most once.
+  using PositionSet = llvm::SmallVector<Position, 1>;
+
+  struct Frame {
+    /// The successors that are still to be visited, in reverse order
+    llvm::SmallVector<PositionSet, 2> Succs{};
+  };
+
+  MaybeUniquePtr<const graph_type> RevDAG;
+  vertex_t Leaf;
+  n_t FinalInst;
+  FlowPathOrder Order;
 
-  FlowPathSequence<n_t> Ret;
   size_t CompletedCtr = 0;
-  auto Filters = makePathFilterList(
-      CallStackPathFilter{},
-      ConstraintPathFilter{
-          LPC,
-          Config.AdditionalConstraint.value_or(LPC.getContext().bool_val(true)),
-          &CompletedCtr});
+  PathFilterList<CallStackPathFilter, ConstraintPathFilter> Filters;
+
+  /// The minimal number of instructions on any path from a vertex to the
+  /// leaf, including the vertex itself
+  llvm::SmallVector<size_t, 0> MinLength;
+  llvm::SmallVector<PositionSet, 0> Roots;
+  size_t NextRoot = 0;
 
+  /// One frame per instruction on the CurrPath
+  llvm::SmallVector<Frame, 0> Stack;
   llvm::SmallVector<n_t, 0> CurrPath;
 
-  n_t Prev = nullptr;
+  /// For FlowPathOrder::ShortestFirst: Only yield paths of exactly this
+  /// length in the current round
+  size_t Bound = 0;
+  /// The smallest path length that exceeded the Bound in the current round
+  size_t NextBound = Unreachable;
+
+  Impl(MaybeUniquePtr<const graph_type> RevDAG, vertex_t Leaf, n_t FinalInst,
+       const Z3BasedPathSensitivityConfig &Config, LLVMPathConstraints &LPC,
+       FlowPathOrder Order)
+      : RevDAG(std::move(RevDAG)), Leaf(Leaf), FinalInst(FinalInst),
+        Order(Order),
+        Filters(CallStackPathFilter{},
+                ConstraintPathFilter{LPC,
+                                     Config.AdditionalConstraint.value_or(
+                                         LPC.getContext().bool_val(true)),
+                                     &CompletedCtr}) {
+    computeMinLength();
+
+    PositionSet RootPositions;
+    for (auto Rt : graph_traits_t::roots(*this->RevDAG)) {
+      RootPositions.push_back({Rt, 0});
+    }
+    Roots = successors(RootPositions);
+    if (Order == FlowPathOrder::ShortestFirst) {
+      Bound = Roots.empty() ? Unreachable : 1 + minRemaining(Roots.front());
+    }
+  }
 
-  auto doFilter = [FinalInst, &Prev, &Filters, &RevDAG, &CurrPath, &Ret,
-                   &CompletedCtr, MaxNumPaths{Config.NumPathsThreshold},
-                   Leaf](auto &doFilter, vertex_t Vtx) {
-    auto CurrPathSave = CurrPath.size();
-    scope_exit RestoreCurrPath = [&CurrPath, CurrPathSave] {
-      assert(CurrPathSave <= CurrPath.size());
-      CurrPath.resize(CurrPathSave);
+  void computeMinLength() {
+    const auto &Dag = *RevDAG;
+    MinLength.resize(graph_traits_t::size(Dag), Unreachable);
+    llvm::BitVector Visited(graph_traits_t::size(Dag));
+
+    auto Compute = [this, &Dag, &Visited](auto &Compute, vertex_t Vtx) {
+      if (Visited.test(Vtx)) {
+        return MinLength[Vtx];
+      }
+      Visited.set(Vtx);
+
+      auto NodeSize = graph_traits_t::node(Dag, Vtx).size();
+      if (Vtx == Leaf) {
+        return MinLength[Vtx] = NodeSize;
+      }
+
+      size_t Min = Unreachable;
+      for (auto Edge : graph_traits_t::outEdges(Dag, Vtx)) {
+        Min = std::min(Min, Compute(Compute, graph_traits_t::target(Edge)));
+      }
+      return MinLength[Vtx] = Min == Unreachable ? Unreachable : Min + NodeSize;
     };
 
-    const auto *PrevSave = Prev;
-    scope_exit RestorePrev = [PrevSave, &Prev] { Prev = PrevSave; };
+    for (auto Rt : graph_traits_t::roots(Dag)) {
+      Compute(Compute, Rt);
+    }
+  }
 
-    Filters.saveState();
-    scope_exit RestoreFilters = [&Filters] { Filters.restoreState(); };
+  [[nodiscard]] size_t nodeSize(vertex_t Vtx) const {
+    return graph_traits_t::node(*RevDAG, Vtx).size();
+  }
 
-    for (const auto *Inst : llvm::reverse(graph_traits_t::node(RevDAG, Vtx))) {
-      CurrPath.push_back(Inst);
-      if (!Prev) {
-        Prev = Inst;
-        continue;
+  /// The instruction that was appended to the path to reach Pos. The nodes of
+  /// the reverse DAG store their instructions in reverse order.
+  [[nodiscard]] n_t instAt(Position Pos) const {
+    const auto &Node = graph_traits_t::node(*RevDAG, Pos.Vtx);
+    assert(Pos.Offset != 0 && Pos.Offset <= Node.size());
+    return Node[Node.size() - Pos.Offset];
+  }
+
+  /// The minimal number of instructions that still need to be appended to
+  /// reach the leaf from any of the Positions
+  [[nodiscard]] size_t minRemaining(llvm::ArrayRef<Position> Positions) const {
+    size_t Ret = Unreachable;
+    for (auto Pos : Positions) {
+      Ret = std::min(Ret, MinLength[Pos.Vtx] - Pos.Offset);
+    }
+    return Ret;
+  }
+
+  [[nodiscard]] bool isAtVertexEnd(llvm::ArrayRef<Position> Positions) const {
+    return llvm::any_of(Positions, [this](Position Pos) {
+      return Pos.Offset == nodeSize(Pos.Vtx);
+    });
+  }
+
+  [[nodiscard]] bool reachesLeaf(llvm::ArrayRef<Position> Positions) const {
+    return llvm::is_contained(Positions, Position{Leaf, nodeSize(Leaf)});
+  }
+
+  /// Computes the positions that are one instruction ahead of Positions,
+  /// grouped by that instruction
+  [[nodiscard]] llvm::SmallVector<PositionSet, 2>
+  successors(llvm::ArrayRef<Position> Positions) const {
+    llvm::SmallVector<PositionSet, 2> Succs;
+
+    auto Add = [this, &Succs](Position Pos) {
+      const auto *Inst = instAt(Pos);
+      auto It = llvm::find_if(Succs, [this, Inst](const PositionSet &Set) {
+        return instAt(Set.front()) == Inst;
+      });
+      if (It == Succs.end()) {
+        Succs.emplace_back().push_back(Pos);
+      } else if (!llvm::is_contained(*It, Pos)) {
+        It->push_back(Pos);
       }
+    };
 
-      Filters.saveEdge(Prev, Inst);
+    auto Visit = [this, &Add](auto &Visit, Position Pos) -> void {
+      if (MinLength[Pos.Vtx] == Unreachable) {
+        return;
+      }
+      if (Pos.Offset < nodeSize(Pos.Vtx)) {
+        Add({Pos.Vtx, Pos.Offset + 1});
+        return;
+      }
+      for (auto Edge : graph_traits_t::outEdges(*RevDAG, Pos.Vtx)) {
+        Visit(Visit, Position{graph_traits_t::target(Edge), 0});
+      }
+    };
 
-      Prev = Inst;
+    for (auto Pos : Positions) {
+      Visit(Visit, Pos);
     }
 
-    if (Vtx == Leaf) {
-      // llvm::errs() << "> Reached Leaf!\n";
+    if (Order != FlowPathOrder::DepthFirst) {
+      std::stable_sort(Succs.begin(), Succs.end(),
+                       [this](const PositionSet &L, const PositionSet &R) {
+                         return minRemaining(L) < minRemaining(R);
+                       });
+    }
+    return Succs;
+  }
 
-      assert(!CurrPath.empty() && "Reported paths must not be empty!");
+  void restore() {
+    Filters.restoreState();
+    CurrPath.pop_back();
+  }
 
-      /// Reached the end
-      /// TODO: No need to add the final inst separately anymore. Now, it
-      /// has its own PathNode and is handled implicitly
-      if (Filters.saveFinalEdge(Prev, FinalInst)) {
-        auto Model = std::get<1>(Filters).getModel();
-        Ret.emplace_back(CurrPath, std::get<1>(Filters).getPathConstraints(),
+  [[nodiscard]] std::optional<FlowPath<n_t>> emitPath() {
+    auto Model = std::get<1>(Filters).getModel();
+    ++CompletedCtr;
+    return FlowPath<n_t>(CurrPath, std::get<1>(Filters).getPathConstraints(),
                          Model);
-        ++CompletedCtr;
+  }
+
+  /// Appends the instruction at Positions to the current path. Returns the
+  /// completed path, if this reaches the leaf and the path is valid. Pushes a
+  /// new frame onto the stack, if there are successors to visit.
+  [[nodiscard]] std::optional<FlowPath<n_t>> enter(PositionSet Positions) {
+    if (Order == FlowPathOrder::ShortestFirst) {
+      auto Length = CurrPath.size() + 1 + minRemaining(Positions);
+      if (Length > Bound) {
+        NextBound = std::min(NextBound, Length);
+        return std::nullopt;
       }
+    }
 
-      return;
+    const auto *Inst = instAt(Positions.front());
+    Filters.saveState();
+    if (!CurrPath.empty()) {
+      Filters.saveEdge(CurrPath.back(), Inst);
     }
-    if (graph_traits_t::outDegree(RevDAG, Vtx) == 0) {
-      llvm::report_fatal_error("Non-leaf node has no successors!");
+    CurrPath.push_back(Inst);
+
+    if (isAtVertexEnd(Positions) && !Filters.isValid()) {
+      restore();
+      return std::nullopt;
     }
 
-    if (CompletedCtr >= MaxNumPaths) {
-      return;
+    std::optional<FlowPath<n_t>> Ret;
+    if (reachesLeaf(Positions) &&
+        (Order != FlowPathOrder::ShortestFirst || CurrPath.size() == Bound)) {
+      /// Reached the end
+      /// TODO: No need to add the final inst separately anymore. Now, it
+      /// has its own PathNode and is handled implicitly
+      // Other positions may still continue from here, so keep the state
+      Filters.saveState();
+      if (Filters.saveFinalEdge(Inst, FinalInst)) {
+        Ret = emitPath();
+      }
+      Filters.restoreState();
     }
-    if (!Filters.isValid()) {
-      return;
+
+    auto Succs = successors(Positions);
+    if (Succs.empty()) {
+      restore();
+      return Ret;
     }
-    /// TODO: Verify that we have no concurrent modification here and the
-    /// iterator is never dangling!
-    for (auto Edge : graph_traits_t::outEdges(RevDAG, Vtx)) {
-      doFilter(doFilter, graph_traits_t::target(Edge));
+
+    std::reverse(Succs.begin(), Succs.end());
+    Stack.push_back({std::move(Succs)});
+    return Ret;
+  }
+
+  [[nodiscard]] std::optional<FlowPath<n_t>> next() {
+    while (true) {
+      if (Stack.empty()) {
+        if (NextRoot == Roots.size()) {
+          if (Order != FlowPathOrder::ShortestFirst ||
+              NextBound == Unreachable) {
+            return std::nullopt;
+          }
+          // Start the next round with the next greater path length
+          Bound = std::exchange(NextBound, Unreachable);
+          NextRoot = 0;
+        }
+
+        if (auto Path = enter(Roots[NextRoot++])) {
+          return Path;
+        }
+        continue;
+      }
+
+      auto &Top = Stack.back();
+      if (Top.Succs.empty()) {
+        restore();
+        Stack.pop_back();
+        continue;
+      }
+
+      if (auto Path = enter(Top.Succs.pop_back_val())) {
+        return Path;
+      }
     }
-  };
+  }
+};
+
+FlowPathGenerator::FlowPathGenerator() noexcept = default;
+FlowPathGenerator::FlowPathGenerator(std::unique_ptr<Impl> PImpl) noexcept
+    : PImpl(std::move(PImpl)) {}
+FlowPathGenerator::FlowPathGenerator(FlowPathGenerator &&) noexcept = default;
+FlowPathGenerator &
+FlowPathGenerator::operator=(FlowPathGenerator &&) noexcept = default;
+FlowPathGenerator::~FlowPathGenerator() = default;
+
+auto FlowPathGenerator::next() -> std::optional<FlowPath<n_t>> {
+  if (!PImpl) {
+    return std::nullopt;
+  }
+  return PImpl->next();
+}
+
+size_t FlowPathGenerator::getNumPathsYielded() const noexcept {
+  return PImpl ? PImpl->CompletedCtr : 0;
+}
+
+auto Z3BasedPathSensitivityManagerBase::filterAndFlattenRevDag(
+    graph_type &RevDAG, vertex_t Leaf, n_t FinalInst,
+    const Z3BasedPathSensitivityConfig &Config, LLVMPathConstraints &LPC) const
+    -> FlowPathSequence<n_t> {
+  FlowPathGenerator::Impl Gen(&RevDAG, Leaf, FinalInst, Config, LPC,
+                              FlowPathOrder::DepthFirst);
 
-  for (auto Rt : graph_traits_t::roots(RevDAG)) {
-    doFilter(doFilter, Rt);
+  FlowPathSequence<n_t> Ret;
+  while (Ret.size() < Config.NumPathsThreshold) {
+    auto Path = Gen.next();
+    if (!Path) {
+      break;
+    }
+    Ret.push_back(std::move(*Path));
   }
 
   PHASAR_LOG_LEVEL_CAT(DEBUG, "PathSensitivityManager",
-                       "Num Solver invocations: "
-                           << std::get<1>(Filters).getNumSolverInvocations());
+                       "Num constraint checks: "
+                           << std::get<1>(Gen.Filters)
+                                  .getNumSolverInvocations());
 
   return Ret;
 }
 
+FlowPathGenerator Z3BasedPathSensitivityManagerBase::makePathGenerator(
+    graph_type RevDAG, vertex_t Leaf, n_t FinalInst,
+    const Z3BasedPathSensitivityConfig &Config, LLVMPathConstraints &LPC,
+    FlowPathOrder Order) {
+  return FlowPathGenerator(std::make_unique<FlowPathGenerator::Impl>(
+      std::make_unique<const graph_type>(std::move(RevDAG)), Leaf, FinalInst,
+      Config, LPC, Order));
+}
+
+auto Z3BasedPathSensitivityManagerBase::getLeaf(const graph_type &Dag)
+    -> vertex_t {
+  for (auto Vtx : graph_traits_t::vertices(Dag)) {
+    if (graph_traits_t::outDegree(Dag, Vtx) == 0) {
+      return Vtx;
+    }
+  }
+  llvm_unreachable("Expect the DAG to have a leaf node!");
+}
+
 void Z3BasedPathSensitivityManagerBase::deduplicatePaths(
     FlowPathSequence<n_t> &Paths) {
   /// Some kind of lexical sort for being able to deduplicate the paths easily
@@ -577,4 +823,17 @@ void Z3BasedPathSensitivityManagerBase::deduplicatePaths(
   Paths.erase(std::unique(Paths.begin(), Paths.end()), Paths.end());
 }
 
+z3::expr Z3BasedPathSensitivityManagerBase::translateExpr(const z3::expr &Expr,
+                                                           z3::context &To) {
+  return z3::expr(To, Z3_translate(Expr.ctx(), Expr, To));
+}
+
+void Z3BasedPathSensitivityManagerBase::translatePaths(
+    FlowPathSequence<n_t> &Paths, z3::context &To) {
+  for (auto &Path : Paths) {
+    Path.Constraint = translateExpr(Path.Constraint, To);
+    Path.Model = z3::model(Path.Model, To, z3::model::translate{});
+  }
+}
+
 } // namespace psr
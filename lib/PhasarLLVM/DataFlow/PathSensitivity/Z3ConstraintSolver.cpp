@@ -0,0 +1,217 @@
+/******************************************************************************
+ * Copyright (c) 2024 Philipp Schubert.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/DataFlow/PathSensitivity/Z3ConstraintSolver.h"
+
+#include "llvm/ADT/Hashing.h"
+
+#include <algorithm>
+
+namespace psr {
+
+llvm::raw_ostream &operator<<(llvm::raw_ostream &OS, const Z3SolverStats &S) {
+  return OS << S.NumQueries << " queries, " << S.NumSolverCalls
+            << " solver calls, " << S.NumCacheHits << " cache hits, "
+            << S.NumUnsatCoreHits << " unsat-core hits, "
+            << std::chrono::duration_cast<std::chrono::microseconds>(
+                   S.SolverTime)
+                   .count()
+            << "us in Z3";
+}
+
+size_t Z3ConstraintSolver::KeyHash::operator()(const key_t &Key) const noexcept {
+  return llvm::hash_combine_range(Key.begin(), Key.end());
+}
+
+Z3ConstraintSolver::Z3ConstraintSolver(z3::context &Z3Ctx)
+    : Z3Ctx(&Z3Ctx), Solver(Z3Ctx) {}
+
+void Z3ConstraintSolver::addConjunct(const z3::expr &Constr, key_t &Key) {
+  if (Constr.is_and()) {
+    for (unsigned I = 0, End = Constr.num_args(); I != End; ++I) {
+      addConjunct(Constr.arg(I), Key);
+    }
+    return;
+  }
+
+  auto Id = Constr.id();
+  auto It = Conjuncts.find(Id);
+  if (It == Conjuncts.end()) {
+    z3::expr Tracker(*Z3Ctx, Z3_mk_fresh_const(*Z3Ctx, "psr.track",
+                                               Z3Ctx->bool_sort()));
+    Solver.add(z3::implies(Tracker, Constr));
+    // Asserting something invalidates the solver's current model
+    LastSatKey.clear();
+    TrackerToConjunct[Tracker.id()] = Id;
+    Conjuncts.try_emplace(Id, Constr, Tracker);
+  }
+  Key.push_back(Id);
+}
+
+bool Z3ConstraintSolver::canonicalize(llvm::ArrayRef<z3::expr> Constraints,
+                                      key_t &Key) {
+  for (const auto &Constr : Constraints) {
+    if (Constr.is_false()) {
+      return false;
+    }
+    if (Constr.is_true()) {
+      continue;
+    }
+    addConjunct(Constr, Key);
+  }
+
+  std::sort(Key.begin(), Key.end());
+  Key.erase(std::unique(Key.begin(), Key.end()), Key.end());
+  return true;
+}
+
+bool Z3ConstraintSolver::containsKnownUnsatCore(const key_t &Key) const {
+  if (UnsatCores.empty()) {
+    return false;
+  }
+
+  for (auto First : Key) {
+    auto It = UnsatCoresByFirst.find(First);
+    if (It == UnsatCoresByFirst.end()) {
+      continue;
+    }
+    for (auto CoreIdx : It->second) {
+      const auto &Core = UnsatCores[CoreIdx];
+      if (std::includes(Key.begin(), Key.end(), Core.begin(), Core.end())) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void Z3ConstraintSolver::recordUnsatCore() {
+  auto Core = Solver.unsat_core();
+  key_t CoreKey;
+  CoreKey.reserve(Core.size());
+  for (unsigned I = 0, End = Core.size(); I != End; ++I) {
+    auto It = TrackerToConjunct.find(Core[I].id());
+    assert(It != TrackerToConjunct.end() &&
+           "The unsat core must only consist of tracking literals");
+    CoreKey.push_back(It->second);
+  }
+
+  if (CoreKey.empty()) {
+    // Should not happen, as the solver itself contains only implications
+    return;
+  }
+
+  std::sort(CoreKey.begin(), CoreKey.end());
+  auto CoreIdx = uint32_t(UnsatCores.size());
+  UnsatCoresByFirst[CoreKey.front()].push_back(CoreIdx);
+  UnsatCores.push_back(std::move(CoreKey));
+}
+
+z3::check_result Z3ConstraintSolver::solve(const key_t &Key) {
+  z3::expr_vector Assumptions(*Z3Ctx);
+  for (auto Id : Key) {
+    Assumptions.push_back(Conjuncts.at(Id).second);
+  }
+
+  ++Stats.NumSolverCalls;
+  auto Start = std::chrono::steady_clock::now();
+  auto Res = Solver.check(Assumptions);
+  Stats.SolverTime += std::chrono::steady_clock::now() - Start;
+
+  if (Res == z3::sat) {
+    LastSatKey = Key;
+  } else {
+    LastSatKey.clear();
+    if (Res == z3::unsat) {
+      recordUnsatCore();
+    }
+  }
+  return Res;
+}
+
+z3::model Z3ConstraintSolver::extractModel() {
+  auto Raw = Solver.get_model();
+  z3::model Ret(*Z3Ctx);
+
+  for (unsigned I = 0, End = Raw.num_consts(); I != End; ++I) {
+    auto Decl = Raw.get_const_decl(I);
+    if (TrackerToConjunct.count(Decl().id())) {
+      continue;
+    }
+    auto Interp = Raw.get_const_interp(Decl);
+    Ret.add_const_interp(Decl, Interp);
+  }
+
+  for (unsigned I = 0, End = Raw.num_funcs(); I != End; ++I) {
+    auto Decl = Raw.get_func_decl(I);
+    auto Interp = Raw.get_func_interp(Decl);
+    auto Else = Interp.else_value();
+    auto NewInterp = Ret.add_func_interp(Decl, Else);
+    for (unsigned J = 0, NumEntries = Interp.num_entries(); J != NumEntries;
+         ++J) {
+      auto Entry = Interp.entry(J);
+      z3::expr_vector Args(*Z3Ctx);
+      for (unsigned K = 0, NumArgs = Entry.num_args(); K != NumArgs; ++K) {
+        Args.push_back(Entry.arg(K));
+      }
+      auto Value = Entry.value();
+      NewInterp.add_entry(Args, Value);
+    }
+  }
+
+  return Ret;
+}
+
+z3::check_result
+Z3ConstraintSolver::check(llvm::ArrayRef<z3::expr> Constraints) {
+  ++Stats.NumQueries;
+
+  key_t Key;
+  if (!canonicalize(Constraints, Key)) {
+    ++Stats.NumCacheHits;
+    return z3::unsat;
+  }
+
+  if (auto It = Results.find(Key); It != Results.end()) {
+    ++Stats.NumCacheHits;
+    return It->second.Result;
+  }
+
+  if (containsKnownUnsatCore(Key)) {
+    ++Stats.NumUnsatCoreHits;
+    Results.try_emplace(std::move(Key), CachedResult{z3::unsat, std::nullopt});
+    return z3::unsat;
+  }
+
+  auto Res = solve(Key);
+  Results.try_emplace(std::move(Key), CachedResult{Res, std::nullopt});
+  return Res;
+}
+
+z3::model Z3ConstraintSolver::getModel(llvm::ArrayRef<z3::expr> Constraints) {
+  key_t Key;
+  [[maybe_unused]] bool Feasible = canonicalize(Constraints, Key);
+  assert(Feasible && "Cannot get a model for unsatisfiable constraints");
+
+  auto &Entry = Results[Key];
+  if (!Entry.Model) {
+    // The solver still holds the model of the most recent satisfiable query,
+    // so in the common case of check() followed by getModel() we do not need
+    // to solve again
+    if (Key.empty() || Key != LastSatKey) {
+      Entry.Result = solve(Key);
+      assert(Entry.Result != z3::unsat &&
+             "Cannot get a model for unsatisfiable constraints");
+    }
+    Entry.Model = extractModel();
+  }
+  return *Entry.Model;
+}
+
+} // namespace psr
@@ -1,12 +1,18 @@
 #include "phasar/PhasarLLVM/HelperAnalyses.h"
 
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedCFG.h"
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMFrozenICFG.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMVFTableProvider.h"
+#include "phasar/PhasarLLVM/ControlFlow/Resolver/IncrementalResolver.h"
 #include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/LLVMIncrementalUpdate.h"
 #include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
 
 #include <memory>
 #include <string>
+#include <tuple>
 
 namespace psr {
 HelperAnalyses::HelperAnalyses(std::string IRFile,
@@ -67,14 +73,21 @@ LLVMProjectIRDB &HelperAnalyses::getProjectIRDB() {
   return *IRDB;
 }
 
+std::unique_ptr<LLVMAliasSet> HelperAnalyses::createAliasSet() {
+  if (PrecomputedPTS.has_value()) {
+    return std::make_unique<LLVMAliasSet>(&getProjectIRDB(), *PrecomputedPTS);
+  }
+  if (Incremental) {
+    return std::make_unique<LLVMAliasSet>(
+        &getProjectIRDB(), Incremental->getReusableAliasSets(PTATy), PTATy);
+  }
+  return std::make_unique<LLVMAliasSet>(&getProjectIRDB(), AllowLazyPTS,
+                                        PTATy);
+}
+
 LLVMAliasSet &HelperAnalyses::getAliasInfo() {
   if (!PT) {
-    if (PrecomputedPTS.has_value()) {
-      PT = std::make_unique<LLVMAliasSet>(&getProjectIRDB(), *PrecomputedPTS);
-    } else {
-      PT = std::make_unique<LLVMAliasSet>(&getProjectIRDB(), AllowLazyPTS,
-                                          PTATy);
-    }
+    PT = createAliasSet();
   }
   return *PT;
 }
@@ -86,21 +99,63 @@ LLVMTypeHierarchy &HelperAnalyses::getTypeHierarchy() {
   return *TH;
 }
 
+std::unique_ptr<LLVMBasedICFG> HelperAnalyses::createICFG() {
+  auto &IRDB = getProjectIRDB();
+  if (PrecomputedCG.has_value()) {
+    return std::make_unique<LLVMBasedICFG>(&IRDB, *PrecomputedCG);
+  }
+
+  LLVMAliasInfoRef PTRef =
+      CGTy == CallGraphAnalysisType::OTF ? &getAliasInfo() : nullptr;
+
+  if (Incremental) {
+    LLVMVFTableProvider VTP(IRDB);
+    auto Fallback =
+        Resolver::create(CGTy, &IRDB, &VTP, &getTypeHierarchy(), PTRef);
+    IncrementalResolver Res(
+        &IRDB, &VTP, *Fallback,
+        Incremental->getReusableCallTargets(CGTy, PTATy, VTP));
+    return std::make_unique<LLVMBasedICFG>(&IRDB, Res, std::move(EntryPoints),
+                                           SoundnessLevel, AutoGlobalSupport);
+  }
+
+  return std::make_unique<LLVMBasedICFG>(
+      &IRDB, CGTy, std::move(EntryPoints), &getTypeHierarchy(), PTRef,
+      SoundnessLevel, AutoGlobalSupport);
+}
+
 LLVMBasedICFG &HelperAnalyses::getICFG() {
   if (!ICF) {
-    if (PrecomputedCG.has_value()) {
-      ICF = std::make_unique<LLVMBasedICFG>(&getProjectIRDB(), *PrecomputedCG);
-    } else {
-      ICF = std::make_unique<LLVMBasedICFG>(
-          &getProjectIRDB(), CGTy, std::move(EntryPoints), &getTypeHierarchy(),
-          CGTy == CallGraphAnalysisType::OTF ? &getAliasInfo() : nullptr,
-          SoundnessLevel, AutoGlobalSupport);
-    }
+    ICF = createICFG();
   }
 
   return *ICF;
 }
 
+void HelperAnalyses::freeze() {
+  auto &IRDB = getProjectIRDB();
+  std::ignore = getTypeHierarchy();
+  // Constructing the ICFG may still introduce new aliases
+  std::ignore = getICFG();
+  getAliasInfo().computeAllAliasSets(IRDB);
+  std::ignore = getCFG();
+}
+
+LLVMIncrementalUpdateAnalysis &
+HelperAnalyses::setIncrementalBaseline(const LLVMIncrementalSnapshot &Baseline) {
+  assert(!PT && !ICF &&
+         "The incremental baseline must be set before the alias information "
+         "and the ICFG are constructed");
+  Incremental = std::make_unique<LLVMIncrementalUpdateAnalysis>(
+      Baseline, getProjectIRDB());
+  return *Incremental;
+}
+
+LLVMIncrementalSnapshot HelperAnalyses::takeIncrementalSnapshot() const {
+  assert(IRDB != nullptr);
+  return LLVMIncrementalSnapshot::create(*IRDB, PT.get(), ICF.get(), CGTy);
+}
+
 LLVMBasedCFG &HelperAnalyses::getCFG() {
   if (!CFG) {
     if (ICF) {
@@ -111,4 +166,11 @@ LLVMBasedCFG &HelperAnalyses::getCFG() {
   return *CFG;
 }
 
+LLVMFrozenICFG &HelperAnalyses::getFrozenICFG() {
+  if (!FrozenICF) {
+    FrozenICF = std::make_unique<LLVMFrozenICFG>(getICFG());
+  }
+  return *FrozenICF;
+}
+
 } // namespace psr
@@ -0,0 +1,256 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/LLVMIncrementalUpdate.h"
+
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMVFTableProvider.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
+#include "phasar/Utils/IO.h"
+#include "phasar/Utils/Logger.h"
+#include "phasar/Utils/NlohmannLogging.h"
+
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+
+namespace psr {
+
+LLVMIncrementalSnapshot
+LLVMIncrementalSnapshot::create(const LLVMProjectIRDB &IRDB,
+                                const LLVMAliasSet *PT,
+                                const LLVMBasedICFG *ICF,
+                                CallGraphAnalysisType CGTy) {
+  const auto &Mod = *IRDB.getModule();
+  LLVMStableValueIds Ids(Mod);
+
+  LLVMIncrementalSnapshot Ret;
+  Ret.Fingerprint = computeModuleFingerprint(Mod);
+
+  if (PT) {
+    auto Data = PT->getLLVMAliasSetData();
+    for (const auto &Set : Data.AliasSets) {
+      std::vector<std::string> StableSet;
+      StableSet.reserve(Set.size());
+      for (const auto &MetaId : Set) {
+        const auto *Val = fromMetaDataId(IRDB, MetaId);
+        if (!Val) {
+          continue;
+        }
+        if (auto Id = Ids.getId(Val); !Id.empty()) {
+          StableSet.push_back(std::move(Id));
+        }
+      }
+      if (!StableSet.empty()) {
+        Ret.AliasSets.push_back(std::move(StableSet));
+      }
+    }
+    Ret.AnalyzedFunctions = std::move(Data.AnalyzedFunctions);
+    Ret.PATy = PT->getAliasAnalysisType();
+  }
+
+  if (ICF) {
+    Ret.CGTy = CGTy;
+    for (const auto *Fun : IRDB.getAllFunctions()) {
+      for (const auto &Inst : llvm::instructions(Fun)) {
+        const auto *CallSite = llvm::dyn_cast<llvm::CallBase>(&Inst);
+        if (!CallSite || !CallSite->isIndirectCall()) {
+          continue;
+        }
+
+        auto &Callees = Ret.IndirectCallTargets[Ids.getId(CallSite)];
+        for (const auto *Callee : ICF->getCalleesOfCallAt(CallSite)) {
+          Callees.push_back(Callee->getName().str());
+        }
+      }
+    }
+  }
+
+  return Ret;
+}
+
+void LLVMIncrementalSnapshot::printAsJson(llvm::raw_ostream &OS) const {
+  nlohmann::json JSON;
+
+  auto &Funs = JSON["Fingerprint"]["Functions"];
+  Funs = nlohmann::json::object();
+  for (const auto &Entry : Fingerprint.FunctionHashes) {
+    Funs[Entry.getKey().str()] = Entry.second;
+  }
+  JSON["Fingerprint"]["Globals"] = Fingerprint.GlobalsHash;
+
+  JSON["AliasSets"] = AliasSets;
+  JSON["AnalyzedFunctions"] = AnalyzedFunctions;
+  JSON["AliasAnalysisType"] = toString(PATy);
+  JSON["IndirectCallTargets"] = IndirectCallTargets;
+  JSON["CallGraphAnalysisType"] = toString(CGTy);
+
+  OS << JSON << '\n';
+}
+
+static LLVMIncrementalSnapshot getDataFromJson(const nlohmann::json &Json) {
+  LLVMIncrementalSnapshot Data;
+
+  const auto &Fingerprint = Json.at("Fingerprint");
+  for (const auto &[Name, Hash] : Fingerprint.at("Functions").items()) {
+    Data.Fingerprint.FunctionHashes[Name] = Hash.get<uint64_t>();
+  }
+  Data.Fingerprint.GlobalsHash = Fingerprint.at("Globals").get<uint64_t>();
+
+  for (const auto &Value : Json["AliasSets"]) {
+    Data.AliasSets.push_back(Value.get<std::vector<std::string>>());
+  }
+
+  for (const auto &Value : Json["AnalyzedFunctions"]) {
+    Data.AnalyzedFunctions.push_back(Value.get<std::string>());
+  }
+
+  Data.PATy = toAliasAnalysisType(
+      Json.value("AliasAnalysisType", std::string("Invalid")));
+
+  for (const auto &[CallSite, Callees] : Json["IndirectCallTargets"].items()) {
+    Data.IndirectCallTargets[CallSite] =
+        Callees.get<std::vector<std::string>>();
+  }
+
+  Data.CGTy = toCallGraphAnalysisType(
+      Json.value("CallGraphAnalysisType", std::string("Invalid")));
+
+  return Data;
+}
+
+LLVMIncrementalSnapshot
+LLVMIncrementalSnapshot::deserializeJson(const llvm::Twine &Path) {
+  return getDataFromJson(readJsonFile(Path));
+}
+
+LLVMIncrementalSnapshot
+LLVMIncrementalSnapshot::loadJsonString(llvm::StringRef JsonAsString) {
+  nlohmann::json Data =
+      nlohmann::json::parse(JsonAsString.begin(), JsonAsString.end());
+  return getDataFromJson(Data);
+}
+
+LLVMIncrementalUpdateAnalysis::LLVMIncrementalUpdateAnalysis(
+    const LLVMIncrementalSnapshot &Baseline, const LLVMProjectIRDB &IRDB)
+    : IncrementalUpdateAnalysis(Baseline.Fingerprint,
+                                computeModuleFingerprint(*IRDB.getModule())),
+      Baseline(&Baseline), IRDB(&IRDB), Ids(*IRDB.getModule()) {}
+
+bool LLVMIncrementalUpdateAnalysis::isReusable(const llvm::Value *V) const {
+  if (const auto *Inst = llvm::dyn_cast<llvm::Instruction>(V)) {
+    return isUnchanged(Inst->getFunction()->getName());
+  }
+  if (const auto *Arg = llvm::dyn_cast<llvm::Argument>(V)) {
+    return isUnchanged(Arg->getParent()->getName());
+  }
+  return llvm::isa<llvm::GlobalValue>(V);
+}
+
+nlohmann::json LLVMIncrementalUpdateAnalysis::getReusableAliasSets(
+    AliasAnalysisType PATy) const {
+  nlohmann::json J;
+  auto &Sets = J["AliasSets"];
+  Sets = nlohmann::json::array();
+  auto &Fns = J["AnalyzedFunctions"];
+  Fns = nlohmann::json::array();
+
+  if (PATy != Baseline->PATy) {
+    PHASAR_LOG_LEVEL_CAT(INFO, "LLVMIncrementalUpdateAnalysis",
+                         "Do not reuse the alias information computed by "
+                             << Baseline->PATy << " for " << PATy);
+    return J;
+  }
+
+  size_t NumReused = 0;
+  for (const auto &Set : Baseline->AliasSets) {
+    auto PtsJson = nlohmann::json::array();
+    for (const auto &Id : Set) {
+      const auto *Val = Ids.getValue(Id);
+      if (!Val || !isReusable(Val)) {
+        continue;
+      }
+      auto MetaId = getMetaDataID(Val);
+      if (MetaId != "-1") {
+        PtsJson.push_back(std::move(MetaId));
+      }
+    }
+    if (!PtsJson.empty()) {
+      NumReused += PtsJson.size();
+      Sets.push_back(std::move(PtsJson));
+    }
+  }
+
+  for (const auto &Fun : Baseline->AnalyzedFunctions) {
+    if (isUnchanged(Fun)) {
+      Fns.push_back(Fun);
+    }
+  }
+
+  PHASAR_LOG_LEVEL_CAT(INFO, "LLVMIncrementalUpdateAnalysis",
+                       "Reuse the alias information of "
+                           << NumReused << " values in " << Fns.size()
+                           << " functions");
+  return J;
+}
+
+IncrementalResolver::KnownTargetsTy
+LLVMIncrementalUpdateAnalysis::getReusableCallTargets(
+    CallGraphAnalysisType CGTy, AliasAnalysisType PATy,
+    const LLVMVFTableProvider &VTP) const {
+  IncrementalResolver::KnownTargetsTy Ret;
+  if (CGTy != Baseline->CGTy) {
+    return Ret;
+  }
+  // Only OTF resolves call-sites based on the alias information
+  if (CGTy == CallGraphAnalysisType::OTF && PATy != Baseline->PATy) {
+    return Ret;
+  }
+
+  bool ReuseAll = getDiff().empty();
+  bool ReuseVirtual = ReuseAll || (CGTy == CallGraphAnalysisType::CHA &&
+                                   !getDiff().GlobalsChanged);
+  if (!ReuseVirtual) {
+    return Ret;
+  }
+
+  for (const auto &[Id, CalleeNames] : Baseline->IndirectCallTargets) {
+    const auto *CallSite =
+        llvm::dyn_cast_or_null<llvm::CallBase>(Ids.getValue(Id));
+    if (!CallSite || !CallSite->isIndirectCall() || !isReusable(CallSite)) {
+      continue;
+    }
+    if (!ReuseAll && !isVirtualCall(CallSite, VTP)) {
+      continue;
+    }
+
+    Resolver::FunctionSetTy Callees;
+    bool Complete = true;
+    for (const auto &Name : CalleeNames) {
+      const auto *Callee = IRDB->getModule()->getFunction(Name);
+      if (!Callee) {
+        Complete = false;
+        break;
+      }
+      Callees.insert(Callee);
+    }
+
+    if (Complete) {
+      Ret.try_emplace(CallSite, std::move(Callees));
+    }
+  }
+
+  PHASAR_LOG_LEVEL_CAT(INFO, "LLVMIncrementalUpdateAnalysis",
+                       "Reuse the resolved targets of "
+                           << Ret.size() << " indirect call-sites");
+  return Ret;
+}
+
+} // namespace psr
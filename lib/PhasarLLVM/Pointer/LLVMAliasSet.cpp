@@ -96,8 +96,9 @@ LLVMAliasSet::LLVMAliasSet(LLVMProjectIRDB *IRDB, bool UseLazyEvaluation,
 }
 
 LLVMAliasSet::LLVMAliasSet(LLVMProjectIRDB *IRDB,
-                           const nlohmann::json &SerializedPTS)
-    : PTA(*IRDB, true) {
+                           const nlohmann::json &SerializedPTS,
+                           AliasAnalysisType PATy)
+    : PTA(*IRDB, true, PATy) {
   assert(IRDB != nullptr);
   // Assume, we already have validated the json schema
 
@@ -151,8 +152,9 @@ LLVMAliasSet::LLVMAliasSet(LLVMProjectIRDB *IRDB,
 }
 
 void LLVMAliasSet::computeValuesAliasSet(const llvm::Value *V) {
-  if (!isInterestingPointer(V)) {
-    // don't need to do anything
+  if (Frozen || !isInterestingPointer(V)) {
+    // don't need to do anything; after computeAllAliasSets(), the alias sets
+    // are only looked up, such that they can be queried concurrently
     return;
   }
   // Add set for the queried value if none exists, yet
@@ -558,8 +560,15 @@ AliasResult LLVMAliasSet::alias(const llvm::Value *V1, const llvm::Value *V2,
   }
   computeValuesAliasSet(V1);
   computeValuesAliasSet(V2);
-  return AliasSets[V1]->count(V2) ? AliasResult::MayAlias
-                                  : AliasResult::NoAlias;
+  auto Search = AliasSets.find(V1);
+  if (Search == AliasSets.end()) {
+    // Only possible when frozen: V1 is not part of the module, so it aliases
+    // nothing but itself
+    assert(Frozen);
+    return V1 == V2 ? AliasResult::MayAlias : AliasResult::NoAlias;
+  }
+  return Search->second->count(V2) ? AliasResult::MayAlias
+                                   : AliasResult::NoAlias;
 }
 
 auto LLVMAliasSet::getEmptyAliasSet() -> BoxedPtr<AliasSetTy> {
@@ -581,10 +590,24 @@ auto LLVMAliasSet::getAliasSet(const llvm::Value *V,
   if (auto It = AliasSets.find(V); It != AliasSets.end()) {
     return It->second;
   }
+  if (Frozen) {
+    // V is not part of the module, so it aliases nothing but itself
+    return getExternalAliasSet(V);
+  }
   // if we still can't find its value return an empty set
   return getEmptyAliasSet();
 }
 
+auto LLVMAliasSet::getExternalAliasSet(const llvm::Value *V)
+    -> BoxedPtr<AliasSetTy> {
+  std::lock_guard Lock(ExternalAliasSetsMtx);
+  auto [It, Inserted] = ExternalAliasSets.try_emplace(V);
+  if (Inserted) {
+    It->second.Set.insert(V);
+  }
+  return &It->second.Ptr;
+}
+
 auto LLVMAliasSet::getReachableAllocationSites(
     const llvm::Value *V, bool IntraProcOnly,
     [[maybe_unused]] const llvm::Instruction *I) -> AllocationSiteSetPtrTy {
@@ -597,7 +620,17 @@ auto LLVMAliasSet::getReachableAllocationSites(
   }
   computeValuesAliasSet(V);
 
-  const auto PTS = AliasSets[V];
+  const AliasSetTy *PTS = nullptr;
+  AliasSetTy Singleton;
+  if (auto Search = AliasSets.find(V); Search != AliasSets.end()) {
+    PTS = Search->second.get();
+  } else {
+    // Only possible when frozen: V is not part of the module, so it aliases
+    // nothing but itself
+    assert(Frozen);
+    Singleton.insert(V);
+    PTS = &Singleton;
+  }
   // consider the full inter-procedural points-to/alias information
   if (!IntraProcOnly) {
     for (const auto *P : *PTS) {
@@ -643,14 +676,20 @@ bool LLVMAliasSet::isInReachableAllocationSites(
   }
 
   if (PVIsReachableAllocationSiteType) {
-    const auto PTS = AliasSets[V];
-    return PTS->count(PotentialValue);
+    auto Search = AliasSets.find(V);
+    if (Search == AliasSets.end()) {
+      // Only possible when frozen; see getReachableAllocationSites()
+      assert(Frozen);
+      return V == PotentialValue;
+    }
+    return Search->second->count(PotentialValue);
   }
 
   return false;
 }
 
 void LLVMAliasSet::mergeWith(const LLVMAliasSet &OtherPTI) {
+  assert(!Frozen && "Cannot merge into frozen alias sets");
 
   // merge analyzed functions
   AnalyzedFunctions.insert(OtherPTI.AnalyzedFunctions.begin(),
@@ -682,9 +721,53 @@ void LLVMAliasSet::mergeWith(const LLVMAliasSet &OtherPTI) {
   }
 }
 
+void LLVMAliasSet::computeAllAliasSets(const LLVMProjectIRDB &IRDB) {
+  const auto *M = IRDB.getModule();
+
+  // Besides the globals, functions and instructions, we also need all
+  // constants that may be used as pointer operand, e.g., constant GEPs and
+  // casts, as well as the constants nested within them.
+  llvm::SmallVector<const llvm::Value *> WorkList;
+  llvm::SmallPtrSet<const llvm::Constant *, 32> VisitedConstants;
+  auto AddOperands = [&WorkList](const llvm::User *U) {
+    for (const auto &Op : U->operands()) {
+      if (!llvm::isa<llvm::Instruction>(Op)) {
+        WorkList.push_back(Op);
+      }
+    }
+  };
+
+  for (const auto &G : M->globals()) {
+    WorkList.push_back(&G);
+    AddOperands(&G);
+  }
+  for (const auto &F : *M) {
+    WorkList.push_back(&F);
+    for (const auto &Arg : F.args()) {
+      WorkList.push_back(&Arg);
+    }
+    for (const auto &I : llvm::instructions(F)) {
+      WorkList.push_back(&I);
+      AddOperands(&I);
+    }
+  }
+
+  while (!WorkList.empty()) {
+    const auto *V = WorkList.pop_back_val();
+    computeValuesAliasSet(V);
+    if (llvm::isa<llvm::ConstantExpr, llvm::ConstantAggregate>(V) &&
+        VisitedConstants.insert(llvm::cast<llvm::Constant>(V)).second) {
+      AddOperands(llvm::cast<llvm::User>(V));
+    }
+  }
+
+  Frozen = true;
+}
+
 void LLVMAliasSet::introduceAlias(const llvm::Value *V1, const llvm::Value *V2,
                                   [[maybe_unused]] const llvm::Instruction *I,
                                   [[maybe_unused]] AliasResult Kind) {
+  assert(!Frozen && "Cannot introduce aliases into frozen alias sets");
   //  only introduce aliases if both values are interesting pointer
   if (!isInterestingPointer(V1) || !isInterestingPointer(V2)) {
     return;
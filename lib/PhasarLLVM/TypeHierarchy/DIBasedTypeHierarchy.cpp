@@ -217,6 +217,7 @@ DIBasedTypeHierarchy::DIBasedTypeHierarchy(const LLVMProjectIRDB &IRDB) {
 
   // -- Build the transitive closure
   buildTypeHierarchy(TG, VertexTypes, TransitiveDerivedIndex, Hierarchy);
+  buildSubTypeRows();
 }
 
 static const llvm::DICompositeType *
@@ -292,6 +293,60 @@ DIBasedTypeHierarchy::DIBasedTypeHierarchy(
 
     VTables.emplace_back(std::move(CurrVTable));
   }
+
+  buildSubTypeRows();
+}
+
+void DIBasedTypeHierarchy::buildSubTypeRows() {
+  SubTypeRow.clear();
+  SubTypeRows.clear();
+
+  if (Hierarchy.size() == VertexTypes.size()) {
+    // The type-graph is a tree; the intervals suffice
+    return;
+  }
+
+  static constexpr auto NoRow = UINT32_MAX;
+  SubTypeRow.assign(VertexTypes.size(), NoRow);
+
+  for (size_t TypeIdx = 0, End = VertexTypes.size(); TypeIdx != End;
+       ++TypeIdx) {
+    auto SubTypes = subTypesOf(TypeIdx);
+    if (std::distance(SubTypes.begin(), SubTypes.end()) <= 1) {
+      continue;
+    }
+
+    SubTypeRow[TypeIdx] = SubTypeRows.size();
+    auto &Row = SubTypeRows.emplace_back(VertexTypes.size());
+    for (const auto *SubTy : SubTypes) {
+      if (auto It = TypeToVertex.find(SubTy); It != TypeToVertex.end()) {
+        Row.set(It->second);
+      }
+    }
+  }
+}
+
+bool DIBasedTypeHierarchy::isSubType(ClassType Type, ClassType SubType) const {
+  auto TypeIt = TypeToVertex.find(Type);
+  if (TypeIt == TypeToVertex.end()) {
+    return false;
+  }
+  auto SubTypeIt = TypeToVertex.find(SubType);
+  if (SubTypeIt == TypeToVertex.end()) {
+    return llvm::is_contained(subTypesOf(TypeIt->second), SubType);
+  }
+
+  auto [Start, End] = TransitiveDerivedIndex[TypeIt->second];
+  auto SubTypePos = TransitiveDerivedIndex[SubTypeIt->second].first;
+  if (SubTypePos >= Start && SubTypePos < End) {
+    return true;
+  }
+  if (SubTypeRows.empty()) {
+    return false;
+  }
+
+  auto Row = SubTypeRow[TypeIt->second];
+  return Row < SubTypeRows.size() && SubTypeRows[Row].test(SubTypeIt->second);
 }
 
 auto DIBasedTypeHierarchy::subTypesOf(size_t TypeIdx) const noexcept
@@ -24,6 +24,8 @@
 #include "phasar/Utils/PAMMMacros.h"
 #include "phasar/Utils/Utilities.h"
 
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/StringMap.h"
 #include "llvm/Demangle/Demangle.h"
 #include "llvm/IR/Constants.h"
@@ -37,7 +39,6 @@
 #include "llvm/Support/Format.h"
 
 #include "boost/graph/graphviz.hpp"
-#include "boost/graph/transitive_closure.hpp"
 
 #include <algorithm>
 #include <cassert>
@@ -64,7 +65,7 @@ private:
 
 LLVMTypeHierarchy::VertexProperties::VertexProperties(
     const llvm::StructType *Type)
-    : Type(Type), ReachableTypes({Type}) {}
+    : Type(Type) {}
 
 std::string LLVMTypeHierarchy::VertexProperties::getTypeName() const {
   return Type->getStructName().str();
@@ -121,15 +122,17 @@ LLVMTypeHierarchy::LLVMTypeHierarchy(
     auto Vtx = TypeVertexMap.at(SrcType);
     for (const auto &CurrEdge : SerElement.getValue()) {
       const auto *DestType = NameToStructType[CurrEdge];
-      if (!SrcType) {
+      if (!DestType) {
         continue;
       }
       auto DestVtx = TypeVertexMap.at(DestType);
 
-      TypeGraph[Vtx].ReachableTypes.insert(DestType);
       boost::add_edge(Vtx, DestVtx, TypeGraph);
     }
   }
+
+  // The serialized edges already form the transitive closure
+  buildSubTypeClosure();
 }
 
 LLVMTypeHierarchy::LLVMTypeHierarchy(const llvm::Module &M) {
@@ -201,16 +204,63 @@ bool LLVMTypeHierarchy::isStruct(llvm::StringRef TypeName) {
 }
 
 void LLVMTypeHierarchy::buildLLVMTypeHierarchy(const llvm::Module &M) {
-  // build the hierarchy for the module
+  // build the hierarchy for the module; this also caches the reachable types
   constructHierarchy(M);
-  // cache the reachable types
-  bidigraph_t TC;
-  boost::transitive_closure(TypeGraph, TC);
-  for (auto V : boost::make_iterator_range(boost::vertices(TypeGraph))) {
-    for (auto OE : boost::make_iterator_range(boost::out_edges(V, TC))) {
-      auto Target = boost::target(OE, TC);
-      TypeGraph[V].ReachableTypes.insert(TypeGraph[Target].Type);
+}
+
+void LLVMTypeHierarchy::buildSubTypeClosure() {
+  auto NumVertices = boost::num_vertices(TypeGraph);
+
+  SubTypeStorage.clear();
+  SubTypeRanges.clear();
+  SubTypeRows.clear();
+  SubTypeRow.assign(NumVertices, NoSubTypeRow);
+  SubTypeRanges.reserve(NumVertices);
+  SubTypeStorage.reserve(NumVertices);
+
+  llvm::SmallVector<vertex_t> WorkList;
+  llvm::SmallVector<vertex_t> Reachable;
+
+  for (auto Vtx : boost::make_iterator_range(boost::vertices(TypeGraph))) {
+    auto Start = uint32_t(SubTypeStorage.size());
+
+    bool HasProperSubTypes = llvm::any_of(
+        boost::make_iterator_range(boost::out_edges(Vtx, TypeGraph)),
+        [this, Vtx](auto Edge) {
+          return boost::target(Edge, TypeGraph) != Vtx;
+        });
+    if (!HasProperSubTypes) {
+      SubTypeStorage.push_back(TypeGraph[Vtx].Type);
+      SubTypeRanges.emplace_back(Start, Start + 1);
+      continue;
+    }
+
+    // The row doubles as the visited-set of the DFS
+    SubTypeRow[Vtx] = uint32_t(SubTypeRows.size());
+    auto &Row = SubTypeRows.emplace_back(NumVertices);
+    Row.set(Vtx);
+    WorkList.push_back(Vtx);
+    Reachable.push_back(Vtx);
+
+    while (!WorkList.empty()) {
+      auto Curr = WorkList.pop_back_val();
+      for (auto Edge :
+           boost::make_iterator_range(boost::out_edges(Curr, TypeGraph))) {
+        auto Succ = boost::target(Edge, TypeGraph);
+        if (!Row.test(Succ)) {
+          Row.set(Succ);
+          WorkList.push_back(Succ);
+          Reachable.push_back(Succ);
+        }
+      }
+    }
+
+    llvm::sort(Reachable);
+    for (auto Sub : Reachable) {
+      SubTypeStorage.push_back(TypeGraph[Sub].Type);
     }
+    Reachable.clear();
+    SubTypeRanges.emplace_back(Start, uint32_t(SubTypeStorage.size()));
   }
 }
 
@@ -317,14 +367,45 @@ void LLVMTypeHierarchy::constructHierarchy(const llvm::Module &M) {
                       TypeGraph);
     }
   }
+
+  // cache the reachable types
+  buildSubTypeClosure();
+}
+
+bool LLVMTypeHierarchy::isSubType(const llvm::StructType *Type,
+                                  const llvm::StructType *SubType) const {
+  auto TypeIt = TypeVertexMap.find(Type);
+  if (TypeIt == TypeVertexMap.end()) {
+    return false;
+  }
+  auto SubTypeIt = TypeVertexMap.find(SubType);
+  if (SubTypeIt == TypeVertexMap.end()) {
+    return false;
+  }
+  if (TypeIt->second == SubTypeIt->second) {
+    return true;
+  }
+
+  auto Row = SubTypeRow[TypeIt->second];
+  return Row != NoSubTypeRow && SubTypeRows[Row].test(SubTypeIt->second);
 }
 
 std::set<const llvm::StructType *>
 LLVMTypeHierarchy::getSubTypes(const llvm::StructType *Type) const {
-  if (TypeVertexMap.count(Type)) {
-    if (auto It = TypeVertexMap.find(Type); It != TypeVertexMap.end()) {
-      return TypeGraph[It->second].ReachableTypes;
-    }
+  auto SubTypes = subTypesOf(Type);
+  return {SubTypes.begin(), SubTypes.end()};
+}
+
+llvm::ArrayRef<const llvm::StructType *>
+LLVMTypeHierarchy::subTypesOf(vertex_t Vtx) const noexcept {
+  auto [Start, End] = SubTypeRanges[Vtx];
+  return llvm::makeArrayRef(SubTypeStorage).slice(Start, End - Start);
+}
+
+llvm::ArrayRef<const llvm::StructType *>
+LLVMTypeHierarchy::subTypesOf(const llvm::StructType *Type) const noexcept {
+  if (auto It = TypeVertexMap.find(Type); It != TypeVertexMap.end()) {
+    return subTypesOf(It->second);
   }
   return {};
 }
@@ -462,7 +543,7 @@ void LLVMTypeHierarchy::printAsJson(llvm::raw_ostream &OS) const {
   for (auto Vtx : boost::make_iterator_range(boost::vertices(TypeGraph))) {
     //  iterate all out edges of vertex vi_v
     auto &SerTypes = Data.TypeGraph[TypeGraph[Vtx].getTypeName()];
-    for (const auto &CurrReachable : TypeGraph[Vtx].ReachableTypes) {
+    for (const auto *CurrReachable : subTypesOf(Vtx)) {
       SerTypes.push_back(CurrReachable->getName().str());
     }
   }
@@ -0,0 +1,287 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/Utils/LLVMIRDiff.h"
+
+#include "llvm/ADT/SmallString.h"
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/GlobalAlias.h"
+#include "llvm/IR/GlobalVariable.h"
+#include "llvm/IR/InlineAsm.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/Operator.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Support/xxhash.h"
+
+#include <algorithm>
+
+namespace psr {
+
+namespace {
+
+/// Writes a canonical textual representation of a function body that does
+/// not depend on value names, metadata and debug intrinsics
+class FunctionHashWriter {
+public:
+  FunctionHashWriter(const llvm::Function &F, llvm::raw_ostream &OS)
+      : F(F), OS(OS) {
+    uint32_t InstIdx = 0;
+    uint32_t BBIdx = 0;
+    for (const auto &BB : F) {
+      BBIndex[&BB] = BBIdx++;
+      for (const auto &I : BB) {
+        if (!llvm::isa<llvm::DbgInfoIntrinsic>(I)) {
+          InstIndex[&I] = InstIdx++;
+        }
+      }
+    }
+  }
+
+  void write() {
+    writeType(F.getFunctionType());
+    OS << '|' << F.getCallingConv() << '|' << F.isVarArg() << '\n';
+
+    for (const auto &BB : F) {
+      OS << "b" << BBIndex.lookup(&BB) << ":\n";
+      for (const auto &I : BB) {
+        if (llvm::isa<llvm::DbgInfoIntrinsic>(I)) {
+          continue;
+        }
+        writeInstruction(I);
+      }
+    }
+  }
+
+private:
+  void writeType(const llvm::Type *Ty) {
+    // Named struct types are printed by name; their bodies are covered by the
+    // module's GlobalsHash
+    Ty->print(OS, false, /*NoDetails*/ true);
+  }
+
+  void writeInstruction(const llvm::Instruction &I) {
+    OS << I.getOpcodeName() << ' ';
+    writeType(I.getType());
+
+    if (const auto *Cmp = llvm::dyn_cast<llvm::CmpInst>(&I)) {
+      OS << " p" << Cmp->getPredicate();
+    } else if (const auto *Alloca = llvm::dyn_cast<llvm::AllocaInst>(&I)) {
+      OS << ' ';
+      writeType(Alloca->getAllocatedType());
+    } else if (const auto *GEP = llvm::dyn_cast<llvm::GEPOperator>(&I)) {
+      OS << ' ';
+      writeType(GEP->getSourceElementType());
+      OS << (GEP->isInBounds() ? " inbounds" : "");
+    } else if (const auto *Call = llvm::dyn_cast<llvm::CallBase>(&I)) {
+      OS << ' ';
+      writeType(Call->getFunctionType());
+    } else if (const auto *Load = llvm::dyn_cast<llvm::LoadInst>(&I)) {
+      OS << (Load->isVolatile() ? " volatile" : "");
+    } else if (const auto *Store = llvm::dyn_cast<llvm::StoreInst>(&I)) {
+      OS << (Store->isVolatile() ? " volatile" : "");
+    } else if (const auto *EV = llvm::dyn_cast<llvm::ExtractValueInst>(&I)) {
+      for (auto Idx : EV->indices()) {
+        OS << ' ' << Idx;
+      }
+    } else if (const auto *IV = llvm::dyn_cast<llvm::InsertValueInst>(&I)) {
+      for (auto Idx : IV->indices()) {
+        OS << ' ' << Idx;
+      }
+    }
+
+    if (const auto *Phi = llvm::dyn_cast<llvm::PHINode>(&I)) {
+      for (const auto *BB : Phi->blocks()) {
+        OS << " [b" << BBIndex.lookup(BB) << ']';
+      }
+    }
+
+    for (const auto &Op : I.operands()) {
+      OS << ' ';
+      writeOperand(Op.get());
+    }
+    OS << '\n';
+  }
+
+  void writeOperand(const llvm::Value *V) {
+    if (const auto *Inst = llvm::dyn_cast<llvm::Instruction>(V)) {
+      OS << 'i' << InstIndex.lookup(Inst);
+    } else if (const auto *Arg = llvm::dyn_cast<llvm::Argument>(V)) {
+      OS << 'a' << Arg->getArgNo();
+    } else if (const auto *BB = llvm::dyn_cast<llvm::BasicBlock>(V)) {
+      OS << 'b' << BBIndex.lookup(BB);
+    } else if (const auto *GV = llvm::dyn_cast<llvm::GlobalValue>(V)) {
+      OS << '@' << GV->getName();
+    } else if (const auto *CI = llvm::dyn_cast<llvm::ConstantInt>(V)) {
+      writeType(CI->getType());
+      OS << ' ' << CI->getValue();
+    } else if (llvm::isa<llvm::MetadataAsValue>(V)) {
+      OS << 'm';
+    } else if (llvm::isa<llvm::Constant>(V) || llvm::isa<llvm::InlineAsm>(V)) {
+      // Constants do not refer to local values (except for blockaddress,
+      // which names the function and block), so printing them is stable
+      V->printAsOperand(OS, true, F.getParent());
+    } else {
+      OS << '?';
+    }
+  }
+
+  const llvm::Function &F;
+  llvm::raw_ostream &OS;
+  llvm::DenseMap<const llvm::BasicBlock *, uint32_t> BBIndex;
+  llvm::DenseMap<const llvm::Instruction *, uint32_t> InstIndex;
+};
+
+uint64_t computeGlobalsHash(const llvm::Module &M) {
+  llvm::SmallString<1024> Buf;
+  llvm::raw_svector_ostream OS(Buf);
+
+  auto WriteType = [&OS](const llvm::Type *Ty) {
+    Ty->print(OS, false, /*NoDetails*/ true);
+  };
+
+  std::vector<const llvm::GlobalValue *> Globals;
+  for (const auto &Glob : M.globals()) {
+    Globals.push_back(&Glob);
+  }
+  for (const auto &Alias : M.aliases()) {
+    Globals.push_back(&Alias);
+  }
+  // The hash should not depend on the order of definition
+  std::sort(Globals.begin(), Globals.end(),
+            [](const auto *Lhs, const auto *Rhs) {
+              return Lhs->getName() < Rhs->getName();
+            });
+
+  for (const auto *Glob : Globals) {
+    OS << '@' << Glob->getName() << ' ';
+    WriteType(Glob->getValueType());
+    if (const auto *Var = llvm::dyn_cast<llvm::GlobalVariable>(Glob)) {
+      OS << (Var->isConstant() ? " const" : "");
+      if (Var->hasInitializer()) {
+        OS << " = ";
+        Var->getInitializer()->printAsOperand(OS, true, &M);
+      }
+    } else if (const auto *Alias = llvm::dyn_cast<llvm::GlobalAlias>(Glob)) {
+      OS << " alias ";
+      Alias->getAliasee()->printAsOperand(OS, true, &M);
+    }
+    OS << '\n';
+  }
+
+  auto StructTypes = M.getIdentifiedStructTypes();
+  std::sort(StructTypes.begin(), StructTypes.end(),
+            [](const auto *Lhs, const auto *Rhs) {
+              return Lhs->getName() < Rhs->getName();
+            });
+  for (const auto *ST : StructTypes) {
+    OS << '%' << ST->getName() << " = {";
+    for (const auto *ElemTy : ST->elements()) {
+      OS << ' ';
+      WriteType(ElemTy);
+    }
+    OS << " }\n";
+  }
+
+  return llvm::xxHash64(Buf);
+}
+
+} // namespace
+
+uint64_t computeFunctionHash(const llvm::Function &F) {
+  llvm::SmallString<1024> Buf;
+  llvm::raw_svector_ostream OS(Buf);
+  FunctionHashWriter(F, OS).write();
+  return llvm::xxHash64(Buf);
+}
+
+ModuleFingerprint computeModuleFingerprint(const llvm::Module &M) {
+  ModuleFingerprint Ret;
+  for (const auto &F : M) {
+    if (!F.isDeclaration()) {
+      Ret.FunctionHashes[F.getName()] = computeFunctionHash(F);
+    }
+  }
+  Ret.GlobalsHash = computeGlobalsHash(M);
+  return Ret;
+}
+
+LLVMStableValueIds::LLVMStableValueIds(const llvm::Module &M) : M(&M) {
+  for (const auto &F : M) {
+    if (F.isDeclaration()) {
+      continue;
+    }
+
+    auto &FInsts = Insts[&F];
+    for (const auto &I : llvm::instructions(F)) {
+      if (llvm::isa<llvm::DbgInfoIntrinsic>(I)) {
+        continue;
+      }
+      InstIndex[&I] = FInsts.size();
+      FInsts.push_back(&I);
+    }
+  }
+}
+
+std::string LLVMStableValueIds::getId(const llvm::Value *V) const {
+  if (const auto *Inst = llvm::dyn_cast<llvm::Instruction>(V)) {
+    auto It = InstIndex.find(Inst);
+    if (It == InstIndex.end()) {
+      return {};
+    }
+    return (Inst->getFunction()->getName() + "#" + llvm::Twine(It->second))
+        .str();
+  }
+  if (const auto *Arg = llvm::dyn_cast<llvm::Argument>(V)) {
+    return (Arg->getParent()->getName() + "#a" + llvm::Twine(Arg->getArgNo()))
+        .str();
+  }
+  if (const auto *Glob = llvm::dyn_cast<llvm::GlobalValue>(V)) {
+    return ("@" + Glob->getName()).str();
+  }
+  return {};
+}
+
+const llvm::Value *LLVMStableValueIds::getValue(llvm::StringRef Id) const {
+  if (Id.consume_front("@")) {
+    return M->getNamedValue(Id);
+  }
+
+  // Function names may contain '#' themselves
+  auto [FunName, Pos] = Id.rsplit('#');
+  if (Pos.empty()) {
+    return nullptr;
+  }
+
+  const auto *F = M->getFunction(FunName);
+  if (!F) {
+    return nullptr;
+  }
+
+  unsigned Idx = 0;
+  if (Pos.consume_front("a")) {
+    if (Pos.getAsInteger(10, Idx) || Idx >= F->arg_size()) {
+      return nullptr;
+    }
+    return F->getArg(Idx);
+  }
+
+  auto It = Insts.find(F);
+  if (It == Insts.end() || Pos.getAsInteger(10, Idx) ||
+      Idx >= It->second.size()) {
+    return nullptr;
+  }
+  return It->second[Idx];
+}
+
+} // namespace psr
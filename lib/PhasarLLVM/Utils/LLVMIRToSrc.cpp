@@ -9,6 +9,8 @@
 
 #include "phasar/PhasarLLVM/Utils/LLVMIRToSrc.h"
 
+#include "phasar/PhasarLLVM/Utils/LLVMSourceCache.h"
+
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Demangle/Demangle.h"
@@ -23,8 +25,6 @@
 #include "llvm/Support/Path.h"
 
 #include <filesystem>
-#include <fstream>
-#include <limits>
 #include <optional>
 #include <string>
 
@@ -243,22 +243,20 @@ std::pair<unsigned, unsigned> psr::getLineAndColFromIR(const llvm::Value *V) {
 
 std::string psr::getSrcCodeFromIR(const llvm::Value *V, bool Trim) {
   unsigned int LineNr = getLineFromIR(V);
-  if (LineNr > 0) {
-    std::filesystem::path Path(getFilePathFromIR(V));
-    if (std::filesystem::exists(Path) && !std::filesystem::is_directory(Path)) {
-      std::ifstream Ifs(Path.string(), std::ios::binary);
-      if (Ifs.is_open()) {
-        Ifs.seekg(std::ios::beg);
-        std::string SrcLine;
-        for (unsigned int I = 0; I < LineNr - 1; ++I) {
-          Ifs.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-        }
-        std::getline(Ifs, SrcLine);
-        return Trim ? llvm::StringRef(SrcLine).trim().str() : SrcLine;
-      }
-    }
+  if (LineNr == 0) {
+    return "";
   }
-  return "";
+
+  auto &Cache = LLVMSourceCache::getInstance();
+  const auto *DIF = getDIFileFromIR(V);
+  const auto *File =
+      DIF ? Cache.getFile(DIF) : Cache.getFile(getFilePathFromIR(V));
+  if (!File) {
+    return "";
+  }
+
+  auto SrcLine = File->getLine(LineNr);
+  return Trim ? SrcLine.trim().str() : SrcLine.str();
 }
 
 std::string psr::getModuleIDFromIR(const llvm::Value *V) {
@@ -0,0 +1,41 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/Utils/LLVMModuleInterface.h"
+
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Module.h"
+
+namespace psr {
+
+bool isExportedDefinition(const llvm::Function &F) noexcept {
+  return !F.isDeclarationForLinker() && !F.hasLocalLinkage() &&
+         !F.hasLinkOnceLinkage() && !F.hasWeakLinkage();
+}
+
+ModuleInterface computeModuleInterface(const llvm::Module &M,
+                                       llvm::StringRef Name) {
+  ModuleInterface Ret;
+  Ret.Name = Name.str();
+
+  for (const auto &F : M) {
+    if (F.isIntrinsic()) {
+      continue;
+    }
+    if (F.isDeclarationForLinker()) {
+      Ret.Declares.push_back(F.getName().str());
+    } else if (isExportedDefinition(F)) {
+      Ret.Defines.push_back(F.getName().str());
+    }
+  }
+
+  return Ret;
+}
+
+} // namespace psr
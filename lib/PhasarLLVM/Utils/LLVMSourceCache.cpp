@@ -0,0 +1,120 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/Utils/LLVMSourceCache.h"
+
+#include "phasar/PhasarLLVM/Utils/LLVMIRToSrc.h"
+#include "phasar/Utils/Logger.h"
+
+#include "llvm/IR/DebugInfoMetadata.h"
+
+#include <cassert>
+
+using namespace psr;
+
+LLVMSourceFile::LLVMSourceFile(std::unique_ptr<llvm::MemoryBuffer> Buffer)
+    : Buffer(std::move(Buffer)) {
+  assert(this->Buffer != nullptr);
+
+  auto Text = this->Buffer->getBuffer();
+  if (Text.empty()) {
+    return;
+  }
+
+  LineOffsets.reserve(Text.size() / 32 + 1);
+  LineOffsets.push_back(0);
+  for (size_t Pos = Text.find('\n'); Pos != llvm::StringRef::npos;
+       Pos = Text.find('\n', Pos + 1)) {
+    if (Pos + 1 < Text.size()) {
+      LineOffsets.push_back(Pos + 1);
+    }
+  }
+  LineOffsets.shrink_to_fit();
+}
+
+llvm::StringRef LLVMSourceFile::getLine(unsigned LineNr) const noexcept {
+  if (LineNr == 0 || LineNr > LineOffsets.size()) {
+    return {};
+  }
+
+  auto Text = Buffer->getBuffer();
+  auto Begin = LineOffsets[LineNr - 1];
+  auto End = LineNr < LineOffsets.size() ? LineOffsets[LineNr] - 1
+                                         : Text.size();
+  return Text.slice(Begin, End).rtrim('\n');
+}
+
+LLVMSourceCache &LLVMSourceCache::getInstance() {
+  static LLVMSourceCache Cache;
+  return Cache;
+}
+
+const LLVMSourceFile *LLVMSourceCache::getFileImpl(llvm::StringRef Path) {
+  auto [It, Inserted] = FilesByPath.try_emplace(Path, nullptr);
+  if (!Inserted) {
+    return It->second.get();
+  }
+
+  // Do not require a null terminator, such that larger files can always be
+  // memory-mapped
+  auto Buf = llvm::MemoryBuffer::getFile(Path, /*IsText*/ false,
+                                         /*RequiresNullTerminator*/ false);
+  if (!Buf) {
+    PHASAR_LOG_LEVEL(WARNING, "Source File not accessible: " << Path);
+    PHASAR_LOG_LEVEL(INFO, "> " << Buf.getError().message());
+    return nullptr;
+  }
+
+  It->second = std::make_unique<LLVMSourceFile>(std::move(Buf.get()));
+  return It->second.get();
+}
+
+const LLVMSourceFile *LLVMSourceCache::getFile(llvm::StringRef Path) {
+  if (Path.empty()) {
+    return nullptr;
+  }
+
+  std::lock_guard Lck(Mtx);
+  return getFileImpl(Path);
+}
+
+const LLVMSourceFile *LLVMSourceCache::getFile(const llvm::DIFile *DIF) {
+  if (!DIF) {
+    return nullptr;
+  }
+
+  std::lock_guard Lck(Mtx);
+
+  auto [It, Inserted] = FilesByDIFile.try_emplace(DIF);
+  auto &Entry = It->second;
+  if (!Inserted && Entry.FileName == DIF->getFilename() &&
+      Entry.Directory == DIF->getDirectory()) {
+    return Entry.File;
+  }
+
+  auto Path = getFilePathFromIR(DIF);
+  Entry.File = Path.empty() ? nullptr : getFileImpl(Path);
+  Entry.FileName = DIF->getFilename().str();
+  Entry.Directory = DIF->getDirectory().str();
+  return Entry.File;
+}
+
+llvm::StringRef LLVMSourceCache::getLine(const llvm::DIFile *DIF,
+                                         unsigned LineNr) {
+  if (const auto *File = getFile(DIF)) {
+    return File->getLine(LineNr);
+  }
+  return {};
+}
+
+void LLVMSourceCache::clear() {
+  std::lock_guard Lck(Mtx);
+  FilesByDIFile.clear();
+  FilesByPath.clear();
+}
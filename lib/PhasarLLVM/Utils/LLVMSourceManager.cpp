@@ -1,7 +1,7 @@
 #include "phasar/PhasarLLVM/Utils/LLVMSourceManager.h"
 
 #include "phasar/PhasarLLVM/Utils/LLVMIRToSrc.h"
-#include "phasar/Utils/Logger.h"
+#include "phasar/PhasarLLVM/Utils/LLVMSourceCache.h"
 
 #include "llvm/IR/DebugInfoMetadata.h"
 
@@ -17,15 +17,16 @@ getSourceBufId(const llvm::DIFile *File,
     return It->second;
   }
 
-  auto FileName = psr::getFilePathFromIR(File);
-  auto Buf = llvm::MemoryBuffer::getFile(FileName, true);
-  if (!Buf) {
-    PHASAR_LOG_LEVEL(WARNING, "Source File not accessible: " << FileName);
-    PHASAR_LOG_LEVEL(INFO, "> " << Buf.getError().message());
+  // The SourceMgr does not own the file contents; they live in the shared
+  // LLVMSourceCache, such that each file is only loaded once
+  const auto *SrcFile = LLVMSourceCache::getInstance().getFile(File);
+  if (!SrcFile) {
     return std::nullopt;
   }
+  auto Buf = llvm::MemoryBuffer::getMemBuffer(
+      SrcFile->getBuffer().getMemBufferRef(), /*RequiresNullTerminator*/ false);
 
-  auto Id = SrcMgr.AddNewSourceBuffer(std::move(Buf.get()), llvm::SMLoc{});
+  auto Id = SrcMgr.AddNewSourceBuffer(std::move(Buf), llvm::SMLoc{});
   FileIdMap.try_emplace(File, Id);
   return Id;
 }
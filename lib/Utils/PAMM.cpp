@@ -33,6 +33,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <system_error>
@@ -42,17 +43,54 @@ using json = nlohmann::json;
 
 namespace psr {
 
+namespace {
+/// Maps counter ids to the indices of their CounterHandles. Shared by all PAMM
+/// instances, such that a handle can be cached independent of the instance.
+struct CounterRegistry {
+  std::mutex Mtx;
+  llvm::StringMap<uint32_t> Indices;
+  /// Points into the keys of Indices
+  std::vector<llvm::StringRef> Names;
+
+  static CounterRegistry &get() {
+    static CounterRegistry Registry;
+    return Registry;
+  }
+
+  std::optional<uint32_t> lookup(llvm::StringRef CounterId) {
+    std::lock_guard Lock(Mtx);
+    auto It = Indices.find(CounterId);
+    if (It == Indices.end()) {
+      return std::nullopt;
+    }
+    return It->second;
+  }
+
+  llvm::StringRef getName(uint32_t Index) {
+    std::lock_guard Lock(Mtx);
+    return Names[Index];
+  }
+};
+
+std::atomic_uint64_t NextInstanceId{1};
+} // namespace
+
+PAMM::PAMM() noexcept : InstanceId(NextInstanceId++) {}
+PAMM::~PAMM() = default;
+
 PAMM &PAMM::getInstance() {
   static PAMM Instance{};
   return Instance;
 }
 
 void PAMM::startTimer(llvm::StringRef TimerId) {
-  if (LLVM_UNLIKELY(StoppedTimer.count(TimerId))) {
+  std::lock_guard Lock(Mtx);
+  auto &Local = Timers[std::this_thread::get_id()];
+  if (LLVM_UNLIKELY(Local.StoppedTimer.count(TimerId))) {
     llvm::report_fatal_error("Do not start an already stopped timer");
   }
 
-  auto [It, Inserted] = RunningTimer.try_emplace(TimerId);
+  auto [It, Inserted] = Local.RunningTimer.try_emplace(TimerId);
   if (LLVM_UNLIKELY(!Inserted)) {
     llvm::report_fatal_error("Do not start an already running timer");
   }
@@ -62,8 +100,10 @@ void PAMM::startTimer(llvm::StringRef TimerId) {
 }
 
 void PAMM::resetTimer(llvm::StringRef TimerId) {
-  bool InRunningTimers = RunningTimer.erase(TimerId);
-  bool InStoppedTimers = StoppedTimer.erase(TimerId);
+  std::lock_guard Lock(Mtx);
+  auto &Local = Timers[std::this_thread::get_id()];
+  bool InRunningTimers = Local.RunningTimer.erase(TimerId);
+  bool InStoppedTimers = Local.StoppedTimer.erase(TimerId);
 
   assert((InRunningTimers && !InStoppedTimers) ||
          (!InRunningTimers && InStoppedTimers) &&
@@ -71,40 +111,70 @@ void PAMM::resetTimer(llvm::StringRef TimerId) {
 }
 
 void PAMM::stopTimer(llvm::StringRef TimerId, bool PauseTimer) {
-  auto RunningIt = RunningTimer.find(TimerId);
-  auto StoppedIt = StoppedTimer.find(TimerId);
-  bool TimerRunning = RunningIt != RunningTimer.end();
-  bool TimerStopped = StoppedIt != StoppedTimer.end();
+  std::lock_guard Lock(Mtx);
+  stopTimerImpl(Timers[std::this_thread::get_id()], TimerId, PauseTimer);
+}
+
+void PAMM::stopTimerImpl(ThreadTimers &Local, llvm::StringRef TimerId,
+                         bool PauseTimer) {
+  auto RunningIt = Local.RunningTimer.find(TimerId);
+  auto StoppedIt = Local.StoppedTimer.find(TimerId);
+  bool TimerRunning = RunningIt != Local.RunningTimer.end();
+  bool TimerStopped = StoppedIt != Local.StoppedTimer.end();
   bool ValidTimerId = TimerRunning || TimerStopped;
   assert(ValidTimerId && "stopTimer failed due to an invalid timer id or timer "
                          "was already stopped");
   assert(TimerRunning && "stopTimer failed because timer was already stopped");
 
-  if (LLVM_LIKELY(ValidTimerId)) {
+  if (LLVM_LIKELY(TimerRunning)) {
     PAMM::TimePoint_t End = std::chrono::high_resolution_clock::now();
     PAMM::TimePoint_t Start = RunningIt->second;
-    RunningTimer.erase(RunningIt);
+    Local.RunningTimer.erase(RunningIt);
     auto P = make_pair(Start, End);
     if (PauseTimer) {
       RepeatingTimer[TimerId].push_back(P);
     } else {
-      StoppedTimer[TimerId] = P;
+      Local.StoppedTimer[TimerId] = P;
     }
   }
 }
 
+void PAMM::addTimerInterval(llvm::StringRef TimerId, TimePoint_t Start,
+                            TimePoint_t End) {
+  std::lock_guard Lock(Mtx);
+  RepeatingTimer[TimerId].emplace_back(Start, End);
+}
+
+std::optional<std::pair<PAMM::TimePoint_t, PAMM::TimePoint_t>>
+PAMM::getStoppedTimerImpl(llvm::StringRef TimerId) const {
+  // If multiple threads have run the same timer, report the longest run
+  std::optional<std::pair<TimePoint_t, TimePoint_t>> Ret;
+  for (const auto &[Thread, Local] : Timers) {
+    auto It = Local.StoppedTimer.find(TimerId);
+    if (It == Local.StoppedTimer.end()) {
+      continue;
+    }
+    if (!Ret ||
+        Ret->second - Ret->first < It->second.second - It->second.first) {
+      Ret = It->second;
+    }
+  }
+  return Ret;
+}
+
 uint64_t PAMM::elapsedTime(llvm::StringRef TimerId) {
-  auto RunningIt = RunningTimer.find(TimerId);
+  std::lock_guard Lock(Mtx);
+  auto &Local = Timers[std::this_thread::get_id()];
+  auto RunningIt = Local.RunningTimer.find(TimerId);
 
-  if (RunningIt != RunningTimer.end()) {
+  if (RunningIt != Local.RunningTimer.end()) {
     PAMM::TimePoint_t End = std::chrono::high_resolution_clock::now();
     PAMM::TimePoint_t Start = RunningIt->second;
     auto Duration = std::chrono::duration_cast<Duration_t>(End - Start);
     return Duration.count();
   }
-  if (auto StoppedIt = StoppedTimer.find(TimerId);
-      StoppedIt != StoppedTimer.end()) {
-    auto [Start, End] = StoppedIt->second;
+  if (auto Stopped = getStoppedTimerImpl(TimerId)) {
+    auto [Start, End] = *Stopped;
     auto Duration = std::chrono::duration_cast<Duration_t>(End - Start);
     return Duration.count();
   }
@@ -113,9 +183,23 @@ uint64_t PAMM::elapsedTime(llvm::StringRef TimerId) {
   return 0;
 }
 
+std::map<std::string, uint64_t> PAMM::elapsedTimeOfSingleTimer() const {
+  std::map<std::string, uint64_t> Ret;
+  for (const auto &[Thread, Local] : Timers) {
+    for (const auto &Timer : Local.StoppedTimer) {
+      auto [Start, End] = Timer.second;
+      uint64_t Time =
+          std::chrono::duration_cast<Duration_t>(End - Start).count();
+      auto &Elapsed = Ret[Timer.first().str()];
+      Elapsed = std::max(Elapsed, Time);
+    }
+  }
+  return Ret;
+}
+
 template <typename HandlerFn>
 static void foreachElapsedTimeOfRepeatingTimer(
-    llvm::StringMap<
+    const llvm::StringMap<
         std::vector<std::pair<PAMM::TimePoint_t, PAMM::TimePoint_t>>>
         &RepeatingTimer,
     HandlerFn Handler) {
@@ -134,6 +218,7 @@ static void foreachElapsedTimeOfRepeatingTimer(
 }
 
 llvm::StringMap<std::vector<uint64_t>> PAMM::elapsedTimeOfRepeatingTimer() {
+  std::lock_guard Lock(Mtx);
   llvm::StringMap<std::vector<uint64_t>> AccTimes;
 
   foreachElapsedTimeOfRepeatingTimer(
@@ -148,37 +233,124 @@ std::string PAMM::getPrintableDuration(uint64_t Duration) {
   return hms(std::chrono::milliseconds{Duration}).str();
 }
 
-void PAMM::regCounter(llvm::StringRef CounterId, unsigned IntialValue) {
-  auto [It, Inserted] = Counter.try_emplace(CounterId, IntialValue);
-  assert(Inserted && "regCounter failed due to an invalid counter id");
+PAMM::CounterHandle PAMM::getCounterHandle(llvm::StringRef CounterId) {
+  auto &Registry = CounterRegistry::get();
+  std::lock_guard Lock(Registry.Mtx);
+  auto [It, Inserted] =
+      Registry.Indices.try_emplace(CounterId, Registry.Names.size());
+  if (Inserted) {
+    Registry.Names.push_back(It->first());
+  }
+  return CounterHandle(It->second);
 }
 
-void PAMM::incCounter(llvm::StringRef CounterId, unsigned CValue) {
-  auto It = Counter.find(CounterId);
-  bool ValidCounterId = It != Counter.end();
-  assert(ValidCounterId && "incCounter failed due to an invalid counter id");
-  if (ValidCounterId) {
-    It->second += CValue;
+PAMM::ThreadCounters &PAMM::getThreadCountersSlow() {
+  std::lock_guard Lock(Mtx);
+  // A thread may reuse the counters of a terminated thread with the same id
+  auto &Local = Counters[std::this_thread::get_id()];
+  if (!Local) {
+    Local = std::make_unique<ThreadCounters>();
   }
+  return *Local;
 }
 
-void PAMM::decCounter(llvm::StringRef CounterId, unsigned CValue) {
-  auto It = Counter.find(CounterId);
-  bool ValidCounterId = It != Counter.end();
-  assert(ValidCounterId && "decCounter failed due to an invalid counter id");
-  if (ValidCounterId) {
-    It->second -= CValue;
+void PAMM::growThreadCounters(ThreadCounters &Local, uint32_t MinCapacity) {
+  auto NewCapacity = std::max(MinCapacity, 2 * Local.Capacity);
+  auto NewValues = std::make_unique<std::atomic<uint64_t>[]>(NewCapacity);
+  for (uint32_t I = 0; I != Local.Capacity; ++I) {
+    NewValues[I].store(Local.Values[I].load(std::memory_order_relaxed),
+                       std::memory_order_relaxed);
+  }
+  for (uint32_t I = Local.Capacity; I != NewCapacity; ++I) {
+    NewValues[I].store(0, std::memory_order_relaxed);
   }
+
+  // Readers access Local only while holding Mtx
+  std::lock_guard Lock(Mtx);
+  Local.Values = std::move(NewValues);
+  Local.Capacity = NewCapacity;
 }
 
-std::optional<unsigned> PAMM::getCounter(llvm::StringRef CounterId) {
-  auto It = Counter.find(CounterId);
-  bool ValidCounterId = It != Counter.end();
-  assert(ValidCounterId && "getCounter failed due to an invalid counter id");
-  if (ValidCounterId) {
-    return It->second;
+void PAMM::regCounterImpl(uint32_t Index, uint64_t InitialValue) {
+  if (Index >= RegisteredCounters.size()) {
+    RegisteredCounters.resize(Index + 1);
+    InitialCounterValues.resize(Index + 1);
   }
-  return std::nullopt;
+  assert(!RegisteredCounters.test(Index) &&
+         "regCounter failed due to an invalid counter id");
+  RegisteredCounters.set(Index);
+
+  // Discard everything that has been counted before the registration
+  uint64_t Offset = 0;
+  for (const auto &[Thread, Local] : Counters) {
+    if (Index < Local->Capacity) {
+      Offset += Local->Values[Index].load(std::memory_order_relaxed);
+    }
+  }
+  InitialCounterValues[Index] = InitialValue - Offset;
+}
+
+void PAMM::regCounter(llvm::StringRef CounterId, uint64_t IntialValue) {
+  auto Index = getCounterHandle(CounterId).getIndex();
+  std::lock_guard Lock(Mtx);
+  regCounterImpl(Index, IntialValue);
+}
+
+void PAMM::incCounter(llvm::StringRef CounterId, uint64_t CValue) {
+  auto Index = CounterRegistry::get().lookup(CounterId);
+  assert(Index && "incCounter failed due to an invalid counter id");
+  if (Index) {
+    addToCounter(CounterHandle(*Index), CValue);
+  }
+}
+
+void PAMM::decCounter(llvm::StringRef CounterId, uint64_t CValue) {
+  auto Index = CounterRegistry::get().lookup(CounterId);
+  assert(Index && "decCounter failed due to an invalid counter id");
+  if (Index) {
+    decCounter(CounterHandle(*Index), CValue);
+  }
+}
+
+std::optional<uint64_t> PAMM::getCounterImpl(uint32_t Index) const {
+  if (Index >= RegisteredCounters.size() || !RegisteredCounters.test(Index)) {
+    return std::nullopt;
+  }
+
+  uint64_t Ret = InitialCounterValues[Index];
+  for (const auto &[Thread, Local] : Counters) {
+    if (Index < Local->Capacity) {
+      Ret += Local->Values[Index].load(std::memory_order_relaxed);
+    }
+  }
+  return Ret;
+}
+
+std::optional<uint64_t>
+PAMM::getCounterImpl(llvm::StringRef CounterId) const {
+  auto Index = CounterRegistry::get().lookup(CounterId);
+  auto Ret = Index ? getCounterImpl(*Index) : std::nullopt;
+  assert(Ret && "getCounter failed due to an invalid counter id");
+  return Ret;
+}
+
+std::optional<uint64_t> PAMM::getCounter(llvm::StringRef CounterId) {
+  std::lock_guard Lock(Mtx);
+  return getCounterImpl(CounterId);
+}
+
+std::optional<uint64_t> PAMM::getCounter(CounterHandle Counter) {
+  std::lock_guard Lock(Mtx);
+  return getCounterImpl(Counter.getIndex());
+}
+
+std::map<std::string, uint64_t> PAMM::getRegisteredCounters() const {
+  std::map<std::string, uint64_t> Ret;
+  auto &Registry = CounterRegistry::get();
+  for (auto Index : RegisteredCounters.set_bits()) {
+    Ret[Registry.getName(Index).str()] = *getCounterImpl(Index);
+  }
+  return Ret;
 }
 
 template <typename ForwardIterator, typename ForwardIteratorSentinel>
@@ -214,6 +386,7 @@ PAMM::getSumCount(std::initializer_list<llvm::StringRef> CounterIds) {
 }
 
 void PAMM::regHistogram(llvm::StringRef HistogramId) {
+  std::lock_guard Lock(Mtx);
   auto [It, Inserted] = Histogram.try_emplace(HistogramId);
   assert(Inserted && "failed to register new histogram due to an invalid id");
 }
@@ -221,6 +394,7 @@ void PAMM::regHistogram(llvm::StringRef HistogramId) {
 void PAMM::addToHistogram(llvm::StringRef HistogramId,
                           llvm::StringRef DataPointId,
                           uint64_t DataPointValue) {
+  std::lock_guard Lock(Mtx);
   auto HistIt = Histogram.find(HistogramId);
   if (HistIt == Histogram.end()) {
     assert(false && "adding data point to histogram failed due to invalid id");
@@ -234,25 +408,32 @@ void PAMM::addToHistogram(llvm::StringRef HistogramId,
   }
 }
 
-void PAMM::stopAllTimers() {
-  while (!RunningTimer.empty()) {
-    // safe copy
-    auto Id = RunningTimer.begin()->first().str();
-    stopTimer(Id);
+void PAMM::stopAllTimersImpl() {
+  for (auto &[Thread, Local] : Timers) {
+    while (!Local.RunningTimer.empty()) {
+      // safe copy
+      auto Id = Local.RunningTimer.begin()->first().str();
+      stopTimerImpl(Local, Id, /*PauseTimer*/ false);
+    }
   }
 }
 
-void PAMM::printTimers(llvm::raw_ostream &OS) {
+void PAMM::stopAllTimers() {
+  std::lock_guard Lock(Mtx);
+  stopAllTimersImpl();
+}
+
+void PAMM::printTimersImpl(llvm::raw_ostream &OS) {
   // stop all running timer
-  stopAllTimers();
+  stopAllTimersImpl();
 
   OS << "Single Timer\n";
   OS << "------------\n";
-  for (const auto &Timer : StoppedTimer) {
-    uint64_t Time = elapsedTime(Timer.first());
-    OS << Timer.first() << " : " << getPrintableDuration(Time) << '\n';
+  auto SingleTimer = elapsedTimeOfSingleTimer();
+  for (const auto &[Id, Time] : SingleTimer) {
+    OS << Id << " : " << getPrintableDuration(Time) << '\n';
   }
-  if (StoppedTimer.empty()) {
+  if (SingleTimer.empty()) {
     OS << "No single Timer started!\n\n";
   } else {
     OS << "\n";
@@ -281,20 +462,31 @@ void PAMM::printTimers(llvm::raw_ostream &OS) {
   }
 }
 
-void PAMM::printCounters(llvm::raw_ostream &OS) {
+void PAMM::printTimers(llvm::raw_ostream &OS) {
+  std::lock_guard Lock(Mtx);
+  printTimersImpl(OS);
+}
+
+void PAMM::printCountersImpl(llvm::raw_ostream &OS) const {
   OS << "\nCounter\n";
   OS << "-------\n";
-  for (const auto &Counter : Counter) {
-    OS << Counter.first() << " : " << Counter.second << '\n';
+  auto Registered = getRegisteredCounters();
+  for (const auto &[Id, Count] : Registered) {
+    OS << Id << " : " << Count << '\n';
   }
-  if (Counter.empty()) {
+  if (Registered.empty()) {
     OS << "No Counter registered!\n";
   } else {
     OS << "\n";
   }
 }
 
-void PAMM::printHistograms(llvm::raw_ostream &OS) {
+void PAMM::printCounters(llvm::raw_ostream &OS) {
+  std::lock_guard Lock(Mtx);
+  printCountersImpl(OS);
+}
+
+void PAMM::printHistogramsImpl(llvm::raw_ostream &OS) const {
   OS << "\nHistograms\n";
   OS << "--------------\n";
   for (const auto &H : Histogram) {
@@ -310,11 +502,17 @@ void PAMM::printHistograms(llvm::raw_ostream &OS) {
   }
 }
 
+void PAMM::printHistograms(llvm::raw_ostream &OS) {
+  std::lock_guard Lock(Mtx);
+  printHistogramsImpl(OS);
+}
+
 void PAMM::printMeasuredData(llvm::raw_ostream &Os) {
+  std::lock_guard Lock(Mtx);
   Os << "\n----- START OF EVALUATION DATA -----\n\n";
-  printTimers(Os);
-  printCounters(Os);
-  printHistograms(Os);
+  printTimersImpl(Os);
+  printCountersImpl(Os);
+  printHistogramsImpl(Os);
   Os << "\n----- END OF EVALUATION DATA -----\n\n";
 }
 
@@ -322,16 +520,16 @@ void PAMM::exportMeasuredData(
     const llvm::Twine &OutputPath, llvm::StringRef ProjectId,
     const std::vector<std::string> *Modules,
     const std::vector<std::string> *DataFlowAnalyses) {
+  std::lock_guard Lock(Mtx);
   // json file for holding all data
   json JsonData;
 
-  stopAllTimers();
+  stopAllTimersImpl();
   {
     // add timer data
     json JTimer;
-    for (const auto &Timer : StoppedTimer) {
-      uint64_t Time = elapsedTime(Timer.first());
-      JTimer[Timer.first().str()] = Time;
+    for (const auto &[Id, Time] : elapsedTimeOfSingleTimer()) {
+      JTimer[Id] = Time;
     }
 
     foreachElapsedTimeOfRepeatingTimer(
@@ -361,8 +559,8 @@ void PAMM::exportMeasuredData(
   {
     // add counter data
     json JCounter;
-    for (const auto &Counter : Counter) {
-      JCounter[Counter.first()] = Counter.second;
+    for (const auto &[Id, Count] : getRegisteredCounters()) {
+      JCounter[Id] = Count;
     }
     JsonData["Counter"] = std::move(JCounter);
   }
@@ -399,10 +597,16 @@ void PAMM::exportMeasuredData(
 }
 
 void PAMM::reset() {
-  RunningTimer.clear();
-  StoppedTimer.clear();
+  std::lock_guard Lock(Mtx);
+  Timers.clear();
   RepeatingTimer.clear();
-  Counter.clear();
+  for (auto &[Thread, Local] : Counters) {
+    for (uint32_t I = 0; I != Local->Capacity; ++I) {
+      Local->Values[I].store(0, std::memory_order_relaxed);
+    }
+  }
+  RegisteredCounters.clear();
+  InitialCounterValues.clear();
   Histogram.clear();
 }
 } // namespace psr
@@ -0,0 +1,30 @@
+// Several virtual call-sites share one vtable slot (CHA and RTA)
+struct Base {
+  virtual int foo(int X) { return X; }
+};
+
+struct Derived : Base {
+  int foo(int X) override { return X + 1; }
+};
+
+// All call-sites below dispatch through the same slot: Base, index 0
+
+int callFoo(Base *B) { return B->foo(1); }
+
+// Loads the callee from the slot of foo, but calls it with a signature that
+// matches none of the functions stored there
+using MismatchedFooTy = double (*)(Base *, int);
+double callFooMismatched(Base *B) {
+  return (*reinterpret_cast<MismatchedFooTy **>(B))[0](B, 2);
+}
+
+int callFooAgain(Base *B) { return B->foo(3); }
+
+int main() {
+  Base B;
+  Derived D;
+  int Res = callFoo(&B);
+  Res += int(callFooMismatched(&D));
+  Res += callFooAgain(&D);
+  return Res;
+}
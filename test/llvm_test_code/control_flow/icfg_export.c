@@ -0,0 +1,13 @@
+void ext(void);
+
+int inc(int x) { return x + 1; }
+
+int unreachable(int x) { return inc(x); }
+
+int main(int argc, char **argv) {
+  if (argc > 1) {
+    inc(argc);
+    ext();
+  }
+  return 0;
+}
@@ -0,0 +1,23 @@
+struct Shape {
+  virtual ~Shape() = default;
+  virtual int area() const { return 0; }
+};
+
+struct Square : Shape {
+  int Side = 3;
+  int area() const override { return Side * Side; }
+};
+
+int measure(const Shape &S) { return S.area(); }
+
+int inc(int X) { return X + 1; }
+
+int apply(int (*Fn)(int), int X) { return Fn(X); }
+
+int main() {
+  Square Sq;
+  int *P = new int(42);
+  int Res = measure(Sq) + apply(inc, *P);
+  delete P;
+  return Res;
+}
@@ -0,0 +1,7 @@
+int g = 0;
+
+int inc(int x) { return x + 1; }
+
+int twice(int x) { return inc(inc(x)); }
+
+void store(int x) { g = x; }
@@ -0,0 +1,7 @@
+int g = 0;
+
+int inc(int x) { return x + 2; }
+
+int twice(int x) { return inc(inc(x)); }
+
+int dec(int x) { return x - 1; }
@@ -0,0 +1 @@
+int inc(int arg) { return arg + 1; }
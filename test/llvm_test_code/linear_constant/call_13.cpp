@@ -0,0 +1,11 @@
+int work(int x) { // clang-format off
+  int y = x + 1;
+  int z = y * 2;
+  return z - 1;
+} // clang-format on
+
+int main() {
+  int a = work(20);
+  int b = work(a);
+  return b;
+}
@@ -0,0 +1,4 @@
+int main() {
+  int x = 42;
+  return x;
+}
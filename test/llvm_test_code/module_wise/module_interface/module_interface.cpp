@@ -0,0 +1,14 @@
+extern "C" {
+
+int imported(int x);
+
+static int local(int x) { return x; }
+
+inline int inlined(int x) { return x; }
+
+int exported(int x) {
+  char buf[4];
+  __builtin_memset(buf, 0, sizeof(buf));
+  return local(inlined(imported(x)));
+}
+}
@@ -0,0 +1,24 @@
+int source();
+void sink(int);
+
+int inc(int x) {
+  int a = 1 + 2;
+  int y = x + 1;
+  int c = 5 + 6;
+  return y;
+}
+
+int main(int argc, char **argv) {
+  int p = 42;
+  int q;
+  int l = q;
+  int t = source();
+  if (l > 0) {
+    int r = inc(t);
+    sink(r);
+    sink(t);
+    t = 0;
+  }
+  sink(argc);
+  return 0;
+}
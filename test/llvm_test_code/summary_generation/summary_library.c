@@ -0,0 +1,11 @@
+void copy(int *dst, int *src) { *dst = *src; }
+
+int *id(int *p) { return p; }
+
+void wrap(int *a, int *b) { copy(a, b); }
+
+__attribute__((used)) static void hidden(int *dst, int *src) {
+  copy(dst, src);
+}
+
+void pure(int x) {}
@@ -0,0 +1,55 @@
+# Runs phasar-cli once sequentially and once with several jobs on the same
+# target and checks that both runs report the same raw results.
+#
+# Usage: cmake -DPHASAR_CLI=<exe> -DINPUT=<ll-file> -DANALYSES=<a>,<b>,...
+#              -DJOBS=<n> -P CompareJobsOutput.cmake
+#
+# The concurrent run prefixes the output of each analysis with a header and
+# the solvers print the facts at a statement in hash-map order, so the outputs
+# are compared line by line after sorting.
+
+cmake_minimum_required(VERSION 3.14)
+
+foreach(Var PHASAR_CLI INPUT ANALYSES JOBS)
+  if (NOT DEFINED ${Var})
+    message(FATAL_ERROR "${Var} must be set")
+  endif()
+endforeach()
+
+string(REPLACE "," ";" Analyses "${ANALYSES}")
+set(Args -m "${INPUT}" --emit-raw-results)
+foreach(Analysis IN LISTS Analyses)
+  list(APPEND Args -D "${Analysis}")
+endforeach()
+
+function(run_phasar_cli NumJobs OutVar)
+  execute_process(
+    COMMAND "${PHASAR_CLI}" ${Args} --jobs ${NumJobs}
+    OUTPUT_VARIABLE Output
+    RESULT_VARIABLE Result
+  )
+  if (NOT Result EQUAL 0)
+    message(FATAL_ERROR "phasar-cli --jobs ${NumJobs} failed: ${Result}")
+  endif()
+
+  # Protect the characters that have a meaning in CMake lists before
+  # splitting the output into lines
+  string(REPLACE ";" "<semicolon>" Output "${Output}")
+  string(REPLACE "[" "<lbracket>" Output "${Output}")
+  string(REPLACE "]" "<rbracket>" Output "${Output}")
+  string(REPLACE "\n" ";" Lines "${Output}")
+  list(FILTER Lines EXCLUDE REGEX "^=== .* ===$")
+  list(SORT Lines)
+  set(${OutVar} "${Lines}" PARENT_SCOPE)
+endfunction()
+
+run_phasar_cli(1 Sequential)
+run_phasar_cli(${JOBS} Concurrent)
+
+if (NOT Sequential)
+  message(FATAL_ERROR "phasar-cli did not report any results")
+endif()
+if (NOT Sequential STREQUAL Concurrent)
+  message(FATAL_ERROR
+    "phasar-cli --jobs ${JOBS} reports different results than --jobs 1")
+endif()
@@ -9,12 +9,32 @@
 
 #include "AnalysisController.h"
 
+#include "phasar/AnalysisStrategy/ModuleWiseAnalysis.h"
 #include "phasar/PhasarLLVM/Passes/GeneralStatisticsAnalysis.h"
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "phasar/PhasarLLVM/Utils/LLVMModuleInterface.h"
 #include "phasar/Utils/NlohmannLogging.h"
 
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringSet.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Program.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/raw_ostream.h"
+
 #include "AnalysisControllerInternal.h"
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace psr {
 
 void AnalysisController::emitRequestedHelperAnalysisResults() {
@@ -99,74 +119,321 @@ static void executeDemandDriven(AnalysisController & /*Data*/) {
   llvm::report_fatal_error(
       "AnalysisStrategy 'demand-driven' not supported, yet!");
 }
-static void executeIncremental(AnalysisController & /*Data*/) {
-  llvm::report_fatal_error(
-      "AnalysisStrategy 'incremental' not supported, yet!");
-}
-static void executeModuleWise(AnalysisController & /*Data*/) {
-  llvm::report_fatal_error(
-      "AnalysisStrategy 'module-wise' not supported, yet!");
-}
 static void executeVariational(AnalysisController & /*Data*/) {
   llvm::report_fatal_error(
       "AnalysisStrategy 'variational' not supported, yet!");
 }
 
+static void executeDataFlowAnalysis(AnalysisController &Data,
+                                    DataFlowAnalysisType DataFlowAnalysis) {
+  using namespace controller;
+  switch (DataFlowAnalysis) {
+  case DataFlowAnalysisType::None:
+    return;
+  case DataFlowAnalysisType::IFDSUninitializedVariables:
+    executeIFDSUninitVar(Data);
+    return;
+  case DataFlowAnalysisType::IFDSConstAnalysis:
+    executeIFDSConst(Data);
+    return;
+  case DataFlowAnalysisType::IFDSTaintAnalysis:
+    executeIFDSTaint(Data);
+    return;
+  case DataFlowAnalysisType::IDEExtendedTaintAnalysis:
+    executeIDEXTaint(Data);
+    return;
+  case DataFlowAnalysisType::IDEOpenSSLTypeStateAnalysis:
+    executeIDEOpenSSLTS(Data);
+    return;
+  case DataFlowAnalysisType::IDECSTDIOTypeStateAnalysis:
+    executeIDECSTDIOTS(Data);
+    return;
+  case DataFlowAnalysisType::IFDSTypeAnalysis:
+    executeIFDSType(Data);
+    return;
+  case DataFlowAnalysisType::IFDSSolverTest:
+    executeIFDSSolverTest(Data);
+    return;
+  case DataFlowAnalysisType::IDELinearConstantAnalysis:
+    executeIDELinearConst(Data);
+    return;
+  case DataFlowAnalysisType::IDESolverTest:
+    executeIDESolverTest(Data);
+    return;
+  case DataFlowAnalysisType::IDEInstInteractionAnalysis:
+    executeIDEIIA(Data);
+    return;
+  case DataFlowAnalysisType::IntraMonoFullConstantPropagation:
+    executeIntraMonoFullConstant(Data);
+    return;
+  case DataFlowAnalysisType::IntraMonoSolverTest:
+    executeIntraMonoSolverTest(Data);
+    return;
+  case DataFlowAnalysisType::InterMonoSolverTest:
+    executeInterMonoSolverTest(Data);
+    return;
+  case DataFlowAnalysisType::InterMonoTaintAnalysis:
+    executeInterMonoTaint(Data);
+    return;
+  }
+
+  llvm_unreachable("All possible DataFlowAnalysisType variants should be "
+                   "handled in the switch above!");
+}
+
+static void executeWholeProgramConcurrently(AnalysisController &Data) {
+  // From here on, the analyses only read the shared helper analyses
+  Data.HA->freeze();
+
+  const auto &Analyses = Data.DataFlowAnalyses;
+  auto NumAnalyses = Analyses.size();
+
+  // Each analysis gets its own result (sub-)directory and buffers everything
+  // else it would print, such that the output does not interleave
+  std::vector<AnalysisController> Jobs(NumAnalyses, Data);
+  std::vector<std::string> Outputs(NumAnalyses);
+  std::vector<std::unique_ptr<llvm::raw_string_ostream>> OutputStreams;
+  OutputStreams.reserve(NumAnalyses);
+  llvm::StringSet<> UsedNames;
+  for (size_t I = 0; I != NumAnalyses; ++I) {
+    auto &Job = Jobs[I];
+    Job.DataFlowAnalyses = {Analyses[I]};
+    Job.NumJobs = 1;
+    Job.ResultStream =
+        OutputStreams.emplace_back(
+            std::make_unique<llvm::raw_string_ostream>(Outputs[I]))
+            .get();
+
+    if (!Data.ResultDirectory.empty()) {
+      auto Name = toString(Analyses[I]);
+      if (!UsedNames.insert(Name).second) {
+        Name += '-' + std::to_string(I);
+      }
+      Job.ResultDirectory /= Name;
+      std::filesystem::create_directory(Job.ResultDirectory);
+    }
+  }
+
+  auto NumThreads = std::min<size_t>(Data.NumJobs, NumAnalyses);
+  std::atomic_size_t NextJob = 0;
+  std::vector<std::thread> Threads;
+  Threads.reserve(NumThreads);
+  for (size_t T = 0; T != NumThreads; ++T) {
+    Threads.emplace_back([&Jobs, &NextJob, NumAnalyses] {
+      for (size_t I = NextJob++; I < NumAnalyses; I = NextJob++) {
+        executeDataFlowAnalysis(Jobs[I], Jobs[I].DataFlowAnalyses.front());
+      }
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  auto &OS = Data.getResultStream();
+  for (size_t I = 0; I != NumAnalyses; ++I) {
+    OutputStreams[I]->flush();
+    if (!Outputs[I].empty()) {
+      OS << "=== " << toString(Analyses[I]) << " ===\n" << Outputs[I];
+    }
+  }
+}
+
 static void executeWholeProgram(AnalysisController &Data) {
+  if (Data.NumJobs > 1 && Data.DataFlowAnalyses.size() > 1) {
+    executeWholeProgramConcurrently(Data);
+    return;
+  }
+
   for (auto DataFlowAnalysis : Data.DataFlowAnalyses) {
-    using namespace controller;
-    switch (DataFlowAnalysis) {
-    case DataFlowAnalysisType::None:
-      continue;
-    case DataFlowAnalysisType::IFDSUninitializedVariables:
-      executeIFDSUninitVar(Data);
-      continue;
-    case DataFlowAnalysisType::IFDSConstAnalysis:
-      executeIFDSConst(Data);
-      continue;
-    case DataFlowAnalysisType::IFDSTaintAnalysis:
-      executeIFDSTaint(Data);
-      continue;
-    case DataFlowAnalysisType::IDEExtendedTaintAnalysis:
-      executeIDEXTaint(Data);
-      continue;
-    case DataFlowAnalysisType::IDEOpenSSLTypeStateAnalysis:
-      executeIDEOpenSSLTS(Data);
-      continue;
-    case DataFlowAnalysisType::IDECSTDIOTypeStateAnalysis:
-      executeIDECSTDIOTS(Data);
-      continue;
-    case DataFlowAnalysisType::IFDSTypeAnalysis:
-      executeIFDSType(Data);
-      continue;
-    case DataFlowAnalysisType::IFDSSolverTest:
-      executeIFDSSolverTest(Data);
-      continue;
-    case DataFlowAnalysisType::IDELinearConstantAnalysis:
-      executeIDELinearConst(Data);
-      continue;
-    case DataFlowAnalysisType::IDESolverTest:
-      executeIDESolverTest(Data);
-      continue;
-    case DataFlowAnalysisType::IDEInstInteractionAnalysis:
-      executeIDEIIA(Data);
-      continue;
-    case DataFlowAnalysisType::IntraMonoFullConstantPropagation:
-      executeIntraMonoFullConstant(Data);
-      continue;
-    case DataFlowAnalysisType::IntraMonoSolverTest:
-      executeIntraMonoSolverTest(Data);
-      continue;
-    case DataFlowAnalysisType::InterMonoSolverTest:
-      executeInterMonoSolverTest(Data);
-      continue;
-    case DataFlowAnalysisType::InterMonoTaintAnalysis:
-      executeInterMonoTaint(Data);
-      continue;
+    executeDataFlowAnalysis(Data, DataFlowAnalysis);
+  }
+}
+
+/// Reuses the alias sets and call targets of all unchanged functions from the
+/// baseline snapshot. The data-flow analyses themselves are not incremental:
+/// The IDESolver cannot persist its jump functions and end summaries, so they
+/// are recomputed for the whole program on top of the reused helper analyses.
+static void executeIncremental(AnalysisController &Data) {
+  auto &OS = Data.getResultStream();
+  if (Data.Incremental) {
+    const auto &Diff = Data.Incremental->getDiff();
+    OS << "Incremental update against " << Data.IncrementalBaseline.string()
+       << ":\n";
+    Diff.print(OS);
+    OS << "Unchanged functions: " << Data.Incremental->getNumUnchanged()
+       << '\n';
+
+    auto Affected =
+        Data.Incremental->computeAffectedFunctions(Data.HA->getICFG());
+    OS << "Functions whose data-flow results may have changed: "
+       << Affected.size() << '\n';
+    for (const auto *Fun : Affected) {
+      OS << "  " << Fun->getName() << '\n';
+    }
+    OS << "Reusing the alias sets and call targets of unchanged functions; "
+          "the data-flow analyses are re-run on the whole program\n";
+  } else {
+    OS << "No incremental baseline found at "
+       << Data.IncrementalBaseline.string() << "; analyzing from scratch\n";
+  }
+
+  executeWholeProgram(Data);
+
+  std::error_code EC;
+  llvm::raw_fd_ostream BaselineOS(Data.IncrementalBaseline.string(), EC);
+  if (EC) {
+    llvm::errs() << "Cannot write the incremental baseline to "
+                 << Data.IncrementalBaseline.string() << ": " << EC.message()
+                 << '\n';
+    return;
+  }
+  Data.HA->takeIncrementalSnapshot().printAsJson(BaselineOS);
+}
+
+/// Summarizes the LinkedModules bottom-up, each in its own phasar-cli process,
+/// and analyzes the module under analysis on top of the summaries of its
+/// dependencies. The summaries are taint summaries, so phasar-cli only admits
+/// the IFDSTaintAnalysis for this strategy.
+static void executeModuleWise(AnalysisController &Data) {
+  auto &OS = Data.getResultStream();
+
+  // Module 0 is the module under analysis; it is never summarized itself
+  std::vector<ModuleInterface> Interfaces;
+  const auto &TopModule = *Data.HA->getProjectIRDB().getModule();
+  Interfaces.push_back(
+      computeModuleInterface(TopModule, TopModule.getModuleIdentifier()));
+  for (const auto &Path : Data.LinkedModules) {
+    llvm::LLVMContext Ctx;
+    llvm::SMDiagnostic Diag;
+    auto Mod = llvm::parseIRFile(Path, Diag, Ctx);
+    if (!Mod) {
+      Diag.print("phasar-cli", llvm::errs());
+      return;
+    }
+    Interfaces.push_back(computeModuleInterface(*Mod, Path));
+  }
+
+  ModuleWiseAnalysis MWA(std::move(Interfaces));
+  MWA.print(OS);
+
+  llvm::SmallString<128> SummaryDir;
+  bool IsTempDir = Data.ResultDirectory.empty();
+  if (IsTempDir) {
+    if (auto EC = llvm::sys::fs::createUniqueDirectory("psr-module-summaries",
+                                                       SummaryDir)) {
+      llvm::errs() << "Cannot create a directory for the module summaries: "
+                   << EC.message() << '\n';
+      return;
+    }
+  } else {
+    SummaryDir = (Data.ResultDirectory / "module-summaries").string();
+    std::filesystem::create_directory(SummaryDir.str().str());
+  }
+
+  std::vector<std::string> SummaryFiles(MWA.size());
+  for (size_t Mod = 1, End = MWA.size(); Mod != End; ++Mod) {
+    auto Stem = std::filesystem::path(MWA.getModule(Mod).Name).stem().string();
+    SummaryFiles[Mod] = (SummaryDir + "/" + llvm::Twine(Mod) + "-" + Stem +
+                         ".json")
+                            .str();
+  }
+
+  // Summaries that have not (yet) been written, e.g., within a dependency
+  // cycle or because the worker failed, are skipped. The analysis then treats
+  // the respective functions as unknown.
+  auto ForEachAvailableDependencySummary = [&](uint32_t Mod, auto Callback) {
+    for (auto Dep : MWA.getDependencies(Mod)) {
+      if (Dep != 0 && llvm::sys::fs::exists(SummaryFiles[Dep])) {
+        Callback(SummaryFiles[Dep]);
+      }
+    }
+  };
+
+  struct Worker {
+    uint32_t Mod{};
+    llvm::sys::ProcessInfo Process;
+  };
+  std::deque<Worker> Running;
+
+  auto WaitForOldest = [&] {
+    auto Current = std::move(Running.front());
+    Running.pop_front();
+
+    std::string ErrMsg;
+    auto Result = llvm::sys::Wait(Current.Process, /*SecondsToWait*/ 0,
+                                  /*WaitUntilChildTerminates*/ true, &ErrMsg);
+    if (Result.ReturnCode != 0) {
+      llvm::errs() << "WARNING: Failed to summarize module "
+                   << MWA.getModule(Current.Mod).Name << ": " << ErrMsg
+                   << '\n';
+    }
+  };
+
+  for (const auto &Stage : MWA.getStages()) {
+    for (auto Mod : Stage) {
+      if (Mod == 0) {
+        continue;
+      }
+      if (MWA.isCyclic(Mod)) {
+        llvm::errs() << "WARNING: Module " << MWA.getModule(Mod).Name
+                     << " is part of a dependency cycle; summarizing it "
+                        "without the summaries of the other modules in the "
+                        "cycle\n";
+      }
+
+      std::vector<std::string> Args = {
+          Data.ExecutablePath, "--silent",
+          "--module=" + MWA.getModule(Mod).Name,
+          // Library modules usually have no main function. The globals model
+          // does not support __ALL__ and would hide all other entry points
+          "--entry-points=__ALL__", "--auto-globals=false",
+          "--mwa-summary-out=" + SummaryFiles[Mod]};
+      Args.insert(Args.end(), Data.WorkerArgs.begin(), Data.WorkerArgs.end());
+      ForEachAvailableDependencySummary(Mod, [&Args](const auto &File) {
+        Args.push_back("--mwa-deps=" + File);
+      });
+      llvm::SmallVector<llvm::StringRef> ArgRefs(Args.begin(), Args.end());
+
+      while (Running.size() >= Data.NumJobs) {
+        WaitForOldest();
+      }
+
+      std::string ErrMsg;
+      bool ExecutionFailed = false;
+      auto Process = llvm::sys::ExecuteNoWait(Data.ExecutablePath, ArgRefs,
+                                              llvm::None, {}, 0, &ErrMsg,
+                                              &ExecutionFailed);
+      if (ExecutionFailed) {
+        llvm::errs() << "WARNING: Cannot spawn a process to summarize module "
+                     << MWA.getModule(Mod).Name << ": " << ErrMsg << '\n';
+        continue;
+      }
+      Running.push_back({Mod, Process});
     }
 
-    llvm_unreachable("All possible DataFlowAnalysisType variants should be "
-                     "handled in the switch above!");
+    // The next stage depends on the summaries of this one
+    while (!Running.empty()) {
+      WaitForOldest();
+    }
+  }
+
+  library_summary::FunctionDataFlowFacts Summaries;
+  ForEachAvailableDependencySummary(0, [&Summaries](const auto &File) {
+    Summaries.mergeWith(
+        library_summary::FunctionDataFlowFacts::deserializeJson(File));
+  });
+  OS << "Loaded the summaries of " << Summaries.size()
+     << " functions from linked modules\n";
+
+  Data.ModuleSummaries = &Summaries;
+  executeWholeProgram(Data);
+  Data.ModuleSummaries = nullptr;
+
+  if (IsTempDir) {
+    llvm::sys::fs::remove_directories(SummaryDir);
+  } else if (auto OFS = openFileStream(Data.ResultDirectory.string() +
+                                       "/psr-module-summaries.json")) {
+    Summaries.printAsJson(*OFS);
   }
 }
 
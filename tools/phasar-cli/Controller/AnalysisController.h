@@ -13,8 +13,12 @@
 #include "phasar/AnalysisStrategy/Strategies.h"
 #include "phasar/DataFlow/IfdsIde/IFDSIDESolverConfig.h"
 #include "phasar/PhasarLLVM/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/FunctionDataFlowFacts.h"
+#include "phasar/PhasarLLVM/LLVMIncrementalUpdate.h"
 #include "phasar/PhasarLLVM/Utils/DataFlowAnalysisType.h"
 
+#include "llvm/Support/raw_ostream.h"
+
 #include "AnalysisControllerEmitterOptions.h"
 
 #include <filesystem>
@@ -31,6 +35,29 @@ struct AnalysisController {
   IFDSIDESolverConfig SolverConfig{};
   std::string ProjectID = "default-phasar-project";
   std::filesystem::path ResultDirectory;
+  /// The maximum number of data-flow analyses to run concurrently
+  unsigned NumJobs = 1;
+  /// Where to emit results that are not written to the ResultDirectory; uses
+  /// llvm::outs() if null
+  llvm::raw_ostream *ResultStream = nullptr;
+  /// The snapshot file of the incremental analysis strategy
+  std::filesystem::path IncrementalBaseline;
+  /// Null, if there was no baseline to compare against
+  LLVMIncrementalUpdateAnalysis *Incremental = nullptr;
+  /// The modules that the module under analysis links against; they are
+  /// summarized separately by the module-wise analysis strategy
+  std::vector<std::string> LinkedModules;
+  /// The phasar-cli executable and the options it forwards to the processes
+  /// that summarize the LinkedModules
+  std::string ExecutablePath;
+  std::vector<std::string> WorkerArgs;
+  /// Summaries of the functions defined in the LinkedModules; null if there
+  /// are none
+  const library_summary::FunctionDataFlowFacts *ModuleSummaries = nullptr;
+
+  [[nodiscard]] llvm::raw_ostream &getResultStream() const noexcept {
+    return ResultStream ? *ResultStream : llvm::outs();
+  }
 
   static constexpr bool
   needsToEmitPTA(AnalysisControllerEmitterOptions EmitterOptions) {
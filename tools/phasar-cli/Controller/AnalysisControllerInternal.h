@@ -63,6 +63,13 @@ static void statsEmitter(llvm::raw_ostream & /*OS*/, const T & /*Solver*/) {}
 template <typename T, typename U>
 static void statsEmitter(llvm::raw_ostream &OS, const IDESolver<T, U> &Solver);
 
+template <typename T>
+static void profileEmitter(AnalysisController & /*Data*/,
+                           const T & /*Solver*/) {}
+template <typename T, typename U>
+static void profileEmitter(AnalysisController &Data,
+                           const IDESolver<T, U> &Solver);
+
 template <typename T>
 static void emitRequestedDataFlowResults(AnalysisController &Data, T &Solver) {
   auto EmitterOptions = Data.EmitterOptions;
@@ -75,7 +82,7 @@ static void emitRequestedDataFlowResults(AnalysisController &Data, T &Solver) {
         Solver.emitTextReport(*OFS);
       }
     } else {
-      Solver.emitTextReport(llvm::outs());
+      Solver.emitTextReport(Data.getResultStream());
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitGraphicalReport) {
@@ -85,7 +92,7 @@ static void emitRequestedDataFlowResults(AnalysisController &Data, T &Solver) {
         Solver.emitGraphicalReport(*OFS);
       }
     } else {
-      Solver.emitGraphicalReport(llvm::outs());
+      Solver.emitGraphicalReport(Data.getResultStream());
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitRawResults) {
@@ -95,15 +102,19 @@ static void emitRequestedDataFlowResults(AnalysisController &Data, T &Solver) {
         Solver.dumpResults(*OFS);
       }
     } else {
-      Solver.dumpResults(llvm::outs());
+      Solver.dumpResults(Data.getResultStream());
     }
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitESGAsDot) {
-    llvm::outs() << "Front-end support for 'EmitESGAsDot' to be implemented\n";
+    Data.getResultStream()
+        << "Front-end support for 'EmitESGAsDot' to be implemented\n";
   }
   if (EmitterOptions & AnalysisControllerEmitterOptions::EmitStatisticsAsText) {
 
-    statsEmitter(llvm::outs(), Solver);
+    statsEmitter(Data.getResultStream(), Solver);
+  }
+  if (EmitterOptions & AnalysisControllerEmitterOptions::EmitSolverProfile) {
+    profileEmitter(Data, Solver);
   }
 }
 
@@ -23,6 +23,24 @@ static void statsEmitter(llvm::raw_ostream &OS, const IDESolver<T, U> &Solver) {
   Solver.printEdgeFunctionStatistics(OS);
 }
 
+template <typename T, typename U>
+static void profileEmitter(AnalysisController &Data,
+                           const IDESolver<T, U> &Solver) {
+  const auto &ResultDirectory = Data.ResultDirectory;
+  if (!ResultDirectory.empty()) {
+    if (auto OFS = openFileStream(ResultDirectory.string() +
+                                  "/psr-solver-profile.json")) {
+      Solver.emitProfileAsJson(*OFS);
+    }
+    if (auto OFS = openFileStream(ResultDirectory.string() +
+                                  "/psr-solver-profile.folded")) {
+      Solver.emitProfileAsFoldedStacks(*OFS);
+    }
+  } else {
+    Solver.emitProfileAsJson(Data.getResultStream());
+  }
+}
+
 template <typename SolverTy, typename ProblemTy, typename... ArgTys>
 static void executeIfdsIdeAnalysis(AnalysisController &Data, ArgTys &&...Args) {
   auto Problem =
@@ -32,8 +50,8 @@ static void executeIfdsIdeAnalysis(AnalysisController &Data, ArgTys &&...Args) {
     std::optional<Timer> MeasureTime;
     if (Data.EmitterOptions &
         AnalysisControllerEmitterOptions::EmitStatisticsAsText) {
-      MeasureTime.emplace([](auto Elapsed) {
-        llvm::outs() << "Elapsed: " << hms{Elapsed} << '\n';
+      MeasureTime.emplace([&Data](auto Elapsed) {
+        Data.getResultStream() << "Elapsed: " << hms{Elapsed} << '\n';
       });
     }
 
@@ -15,5 +15,7 @@ using namespace psr;
 
 void controller::executeIFDSTaint(AnalysisController &Data) {
   auto Config = makeTaintConfig(Data);
-  executeIFDSAnalysis<IFDSTaintAnalysis>(Data, &Config, Data.EntryPoints);
+  executeIFDSAnalysis<IFDSTaintAnalysis>(Data, &Config, Data.EntryPoints,
+                                         /*TaintMainArgs*/ true,
+                                         Data.ModuleSummaries);
 }
@@ -11,24 +11,33 @@
 #include "phasar/Config/Configuration.h"
 #include "phasar/ControlFlow/CallGraphAnalysisType.h"
 #include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/FunctionDataFlowFacts.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMLibrarySummaryGenerator.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LibCSummary.h"
 #include "phasar/PhasarLLVM/HelperAnalyses.h"
+#include "phasar/PhasarLLVM/LLVMIncrementalUpdate.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
 #include "phasar/PhasarLLVM/Utils/DataFlowAnalysisType.h"
 #include "phasar/Pointer/AliasAnalysisType.h"
 #include "phasar/Utils/IO.h"
 #include "phasar/Utils/InitPhasar.h"
 #include "phasar/Utils/Logger.h"
+#include "phasar/Utils/PAMMMacros.h"
 #include "phasar/Utils/Soundness.h"
 #include "phasar/Utils/Utilities.h"
 
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
 
 #include "Controller/AnalysisController.h"
 #include "Controller/AnalysisControllerEmitterOptions.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <filesystem>
 #include <initializer_list>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -212,6 +221,10 @@ PSR_OPTION_FLAG(EmitPTAAsJsonOpt, "emit-pta-as-json",
                 "Emit the points-to information as json");
 PSR_OPTION_FLAG(EmitStatsAsJsonOpt, "emit-statistics-as-json",
                 "Emit the statistics information as json");
+PSR_OPTION_FLAG(
+    ProfileSolverOpt, "profile-solver",
+    "Let the IFDS/IDE Solver attribute its work to the analyzed functions and "
+    "emit the ranking as json and as folded stacks for flame graphs");
 PSR_OPTION_FLAG(FollowReturnPastSeedsOpt, "follow-return-past-seeds",
                 "Let the IFDS/IDE Solver process unbalanced returns",
                 cl::init(true));
@@ -228,6 +241,10 @@ PSR_OPTION_FLAG(
     "Let the IFDS/IDE Solver record all ESG edges whole solving the dataflow "
     "problem. This can have massive performance impact",
     cl::Hidden);
+PSR_OPTION_FLAG(SparseESGOpt, "sparse-esg",
+                "Let the IFDS/IDE Solver skip over statements that are "
+                "irrelevant to the analysis and compute their results on "
+                "demand");
 PSR_OPTION_FLAG(PersistedSummariesOpt, "persisted-summaries",
                 "Let the IFDS/IDE Solver compute persisted procedure summaries "
                 "(Currently not supported)",
@@ -249,6 +266,40 @@ PSR_SHORTLONG_OPTION(PammOutOpt, std::string, "A", "pamm-out",
                      "Filename for PAMM's gathered data",
                      cl::init("PAMM_data.json"), cl::cat(PsrCat), cl::Hidden);
 
+PSR_SHORTLONG_OPTION(JobsOpt, unsigned, "j", "jobs",
+                     "Run up to N data-flow analyses concurrently on the "
+                     "shared helper analyses; each analysis writes its results "
+                     "to its own sub-directory of the output directory",
+                     cl::init(1));
+
+cl::opt<std::string> IncrementalBaselineOpt(
+    "incremental-baseline",
+    cl::desc("Snapshot file for the incremental analysis strategy; the alias "
+             "sets and call targets of all unchanged functions are reused "
+             "from it (if it exists) and it is overwritten with the results "
+             "of this run. Data-flow results are not reused"),
+    cl::cat(PsrCat));
+
+cl::list<std::string> LinkedModulesOpt(
+    "linked-modules",
+    cl::desc("LLVM IR modules that the module under analysis links against; "
+             "the module-wise analysis strategy summarizes them separately "
+             "and analyzes the module under analysis on top of these "
+             "summaries"),
+    cl::CommaSeparated, cl::cat(PsrCat));
+
+// Used internally by the module-wise analysis strategy to summarize a single
+// linked module in a separate process
+cl::opt<std::string> MWASummaryOutOpt(
+    "mwa-summary-out",
+    cl::desc("Write the taint summary of the module to the given file instead "
+             "of running the data-flow analyses"),
+    cl::cat(PsrCat), cl::Hidden);
+cl::list<std::string> MWADepsOpt(
+    "mwa-deps",
+    cl::desc("Summaries of the modules that the module depends on"),
+    cl::cat(PsrCat), cl::Hidden);
+
 // void validateParamConfigFile(const std::string &Config) {
 //   if (!(std::filesystem::exists(Config) &&
 //         !std::filesystem::is_directory(Config))) {
@@ -323,6 +374,115 @@ void validatePTAJsonFile() {
   }
 }
 
+void validateIncrementalBaseline() {
+  if (StrategyOpt == AnalysisStrategy::Incremental &&
+      IncrementalBaselineOpt.empty()) {
+    llvm::errs() << "The incremental analysis strategy requires an "
+                    "--incremental-baseline file!\n";
+    exit(1);
+  }
+}
+
+void validateLinkedModules() {
+  for (const auto &Mod : LinkedModulesOpt) {
+    if (!std::filesystem::exists(Mod) || std::filesystem::is_directory(Mod)) {
+      llvm::errs() << "Linked module '" << Mod << "' does not exist!\n";
+      exit(1);
+    }
+  }
+}
+
+void validateModuleWiseAnalyses() {
+  if (StrategyOpt != AnalysisStrategy::ModuleWise) {
+    return;
+  }
+  // The module summaries are FunctionDataFlowFacts, which only the
+  // IFDSTaintAnalysis can compose with. All other analyses would silently
+  // ignore the linked modules.
+  for (auto Analysis : DataFlowAnalysisOpt) {
+    if (Analysis != DataFlowAnalysisType::IFDSTaintAnalysis) {
+      llvm::errs() << "The module-wise analysis strategy does not support the "
+                   << toString(Analysis)
+                   << "; only the IFDSTaintAnalysis can use the summaries of "
+                      "linked modules!\n";
+      exit(1);
+    }
+  }
+}
+
+template <typename EnumT> llvm::StringRef getCmdFlag(EnumT Value);
+
+template <> llvm::StringRef getCmdFlag(AliasAnalysisType Value) {
+  switch (Value) {
+#define ALIAS_ANALYSIS_TYPE(NAME, CMDFLAG, DESC)                               \
+  case AliasAnalysisType::NAME:                                                \
+    return CMDFLAG;
+#include "phasar/Pointer/AliasAnalysisType.def"
+  case AliasAnalysisType::Invalid:
+    break;
+  }
+  return "";
+}
+template <> llvm::StringRef getCmdFlag(CallGraphAnalysisType Value) {
+  switch (Value) {
+#define CALL_GRAPH_ANALYSIS_TYPE(NAME, CMDFLAG, DESC)                          \
+  case CallGraphAnalysisType::NAME:                                            \
+    return CMDFLAG;
+#include "phasar/ControlFlow/CallGraphAnalysisType.def"
+  case CallGraphAnalysisType::Invalid:
+    break;
+  }
+  return "";
+}
+template <> llvm::StringRef getCmdFlag(Soundness Value) {
+  switch (Value) {
+#define SOUNDNESS_FLAG_TYPE(NAME, CMDFLAG, DESC)                               \
+  case Soundness::NAME:                                                        \
+    return CMDFLAG;
+#include "phasar/Utils/Soundness.def"
+  case Soundness::Invalid:
+    break;
+  }
+  return "";
+}
+
+/// The options that the processes of the module-wise analysis strategy share
+/// with this one
+std::vector<std::string> getModuleWiseWorkerArgs() {
+  return {
+      ("--alias-analysis=" + getCmdFlag(AliasTypeOpt.getValue())).str(),
+      ("--call-graph-analysis=" + getCmdFlag(CGTypeOpt.getValue())).str(),
+      ("--soundness=" + getCmdFlag(SoundnessOpt.getValue())).str(),
+  };
+}
+
+/// Worker mode of the module-wise analysis strategy
+int summarizeModule(HelperAnalyses &HA) {
+  auto &IRDB = HA.getProjectIRDB();
+
+  // Summaries of linked modules take precedence over the libc summary, just
+  // as in the IFDSTaintAnalysis
+  library_summary::LLVMFunctionDataFlowFacts KnownFacts;
+  for (const auto &Dep : MWADepsOpt) {
+    KnownFacts.mergeWith(library_summary::readFromFDFF(
+        library_summary::FunctionDataFlowFacts::deserializeJson(Dep), IRDB));
+  }
+  KnownFacts.mergeWith(library_summary::readFromFDFF(getLibCSummary(), IRDB));
+
+  auto Summary = library_summary::generateLibrarySummary(
+      IRDB, HA.getICFG(), &HA.getAliasInfo(), KnownFacts);
+
+  std::error_code EC;
+  llvm::raw_fd_ostream OS(MWASummaryOutOpt.getValue(), EC);
+  if (EC) {
+    llvm::errs() << "Cannot write the module summary to " << MWASummaryOutOpt
+                 << ": " << EC.message() << '\n';
+    return 1;
+  }
+  Summary.printAsJson(OS);
+  return 0;
+}
+
 } // anonymous namespace
 
 int main(int Argc, const char **Argv) {
@@ -374,6 +534,9 @@ int main(int Argc, const char **Argv) {
   validateSoundnessFlag();
   validateParamAnalysisConfig();
   validatePTAJsonFile();
+  validateIncrementalBaseline();
+  validateLinkedModules();
+  validateModuleWiseAnalyses();
 
   [[maybe_unused]] auto &PConfig = PhasarConfig::getPhasarConfig();
 
@@ -432,6 +595,9 @@ int main(int Argc, const char **Argv) {
   if (EmitStatsAsJsonOpt) {
     EmitterOptions |= AnalysisControllerEmitterOptions::EmitStatisticsAsJson;
   }
+  if (ProfileSolverOpt) {
+    EmitterOptions |= AnalysisControllerEmitterOptions::EmitSolverProfile;
+  }
 
   SolverConfig.setFollowReturnsPastSeeds(FollowReturnPastSeedsOpt);
   SolverConfig.setAutoAddZero(AutoAddZeroOpt);
@@ -439,6 +605,8 @@ int main(int Argc, const char **Argv) {
   SolverConfig.setRecordEdges(RecordEdgesOpt || EmitESGAsDotOpt);
   SolverConfig.setComputePersistedSummaries(PersistedSummariesOpt);
   SolverConfig.setEmitESG(EmitESGAsDotOpt);
+  SolverConfig.setProfile(ProfileSolverOpt);
+  SolverConfig.setSparseESG(SparseESGOpt);
 
   std::optional<nlohmann::json> PrecomputedAliasSet;
   if (!LoadPTAFromJsonOpt.empty()) {
@@ -467,6 +635,10 @@ int main(int Argc, const char **Argv) {
     return 1;
   }
 
+  if (!MWASummaryOutOpt.empty()) {
+    return summarizeModule(HA);
+  }
+
   AnalysisController Controller{
       &HA,
       DataFlowAnalysisOpt,
@@ -485,7 +657,46 @@ int main(int Argc, const char **Argv) {
     std::filesystem::create_directory(Controller.ResultDirectory);
   }
 
+  Controller.NumJobs = std::max(1U, JobsOpt.getValue());
+
+  std::optional<LLVMIncrementalSnapshot> IncrementalBaseline;
+  if (StrategyOpt == AnalysisStrategy::Incremental) {
+    // Must happen before any helper analysis gets constructed
+    Controller.IncrementalBaseline = IncrementalBaselineOpt.getValue();
+    if (std::filesystem::exists(Controller.IncrementalBaseline)) {
+      PHASAR_LOG_LEVEL(INFO, "Load incremental baseline from file: "
+                                 << IncrementalBaselineOpt);
+      IncrementalBaseline =
+          LLVMIncrementalSnapshot::deserializeJson(IncrementalBaselineOpt);
+      Controller.Incremental = &HA.setIncrementalBaseline(*IncrementalBaseline);
+    }
+  }
+
+  if (StrategyOpt == AnalysisStrategy::ModuleWise) {
+    Controller.LinkedModules = LinkedModulesOpt;
+    Controller.ExecutablePath = llvm::sys::fs::getMainExecutable(
+        Argv[0], reinterpret_cast<void *>(&summarizeModule));
+    Controller.WorkerArgs = getModuleWiseWorkerArgs();
+  }
+
   Controller.emitRequestedHelperAnalysisResults();
   Controller.run();
+
+#if defined(PAMM_FULL) || defined(PAMM_CORE)
+  {
+    // One combined report for all analyses of this run
+    std::vector<std::string> Modules = {
+        HA.getProjectIRDB().getModule()->getModuleIdentifier()};
+    std::vector<std::string> Analyses;
+    for (auto DataFlowAnalysis : Controller.DataFlowAnalyses) {
+      Analyses.push_back(toString(DataFlowAnalysis));
+    }
+    auto PammOut = Controller.ResultDirectory / PammOutOpt.getValue();
+    PAMM::getInstance().exportMeasuredData(PammOut.string(),
+                                           Controller.ProjectID, &Modules,
+                                           &Analyses);
+  }
+#endif
+
   return 0;
 }
@@ -1,9 +1,13 @@
 #include "phasar/DB/Hexastore.h"
 
+#include "llvm/ADT/SmallString.h"
+#include "llvm/Support/FileSystem.h"
+
 #include "boost/graph/adjacency_list.hpp"
 #include "boost/graph/graph_utility.hpp"
 #include "boost/graph/isomorphism.hpp"
 #include "gtest/gtest.h"
+#include "sqlite3.h"
 
 #include <algorithm>
 
@@ -268,6 +272,112 @@ TEST(HexastoreTest, StoreGraphWithEdgeLabels) {
   ASSERT_TRUE(boost::isomorphism(I, J));
 }
 
+TEST(HexastoreTest, BulkInsert) {
+  std::vector<std::array<std::string, 3>> Edges;
+  for (int Idx = 0; Idx < 1000; ++Idx) {
+    Edges.push_back({{"f" + std::to_string(Idx), "calls",
+                      "f" + std::to_string(Idx + 1)}});
+  }
+  // Duplicates are ignored
+  Edges.push_back(Edges.front());
+
+  Hexastore H("");
+  H.putAll(Edges);
+  EXPECT_FALSE(H.inTransaction());
+
+  H.beginTransaction();
+  H.put("main", "calls", "f0");
+  H.put({{"f1000", "calls", "main"}});
+  H.commitTransaction();
+
+  EXPECT_EQ(H.get({{"?", "calls", "?"}}).size(), 1002U);
+  EXPECT_EQ(H.get({{"?", "?", "f0"}}),
+            std::vector<HSResult>({HSResult("main", "calls", "f0")}));
+  EXPECT_EQ(H.get({{"f1000", "?", "?"}}),
+            std::vector<HSResult>({HSResult("f1000", "calls", "main")}));
+  EXPECT_TRUE(H.get({{"f1", "calls", "f3"}}).empty());
+  EXPECT_TRUE(H.get({{"unknown", "?", "?"}}).empty());
+}
+
+TEST(HexastoreTest, StreamingQuery) {
+  Hexastore H("");
+  H.put({{"mary", "likes", "hexastores"}});
+  H.put({{"mary", "likes", "apples"}});
+  H.put({{"peter", "likes", "apples"}});
+
+  auto Cursor = H.query({{"?", "likes", "?"}});
+  std::vector<std::string> Subjects;
+  while (Cursor.next()) {
+    EXPECT_EQ(Cursor.predicate(), "likes");
+    Subjects.push_back(Cursor.subject().str());
+
+    // Querying while the cursor is active does not interfere with it
+    EXPECT_EQ(H.get({{"?", "likes", "?"}}).size(), 3U);
+  }
+  EXPECT_EQ(Subjects, std::vector<std::string>({"mary", "mary", "peter"}));
+  EXPECT_FALSE(Cursor.next());
+
+  auto Empty = H.query({{"?", "hates", "?"}});
+  EXPECT_FALSE(Empty.next());
+}
+
+TEST(HexastoreTest, FailedCommitIsRolledBack) {
+  llvm::SmallString<128> DBFile;
+  ASSERT_FALSE(llvm::sys::fs::createTemporaryFile("hexastore", "db", DBFile));
+  {
+    Hexastore H(DBFile.str().str());
+    Hexastore Reader(DBFile.str().str());
+    ASSERT_TRUE(H.isValid());
+    ASSERT_TRUE(Reader.isValid());
+    H.put({{"mary", "likes", "hexastores"}});
+
+    {
+      // The active query holds a read lock, such that the commit fails
+      auto Cursor = Reader.query({{"?", "likes", "?"}});
+      ASSERT_TRUE(Cursor.next());
+
+      H.beginTransaction();
+      H.put({{"peter", "likes", "apples"}});
+      EXPECT_FALSE(H.commitTransaction());
+      EXPECT_FALSE(H.inTransaction());
+    }
+
+    // Neither the triple nor its new terms survive the rollback
+    EXPECT_TRUE(H.get({{"peter", "?", "?"}}).empty());
+    EXPECT_TRUE(H.get({{"?", "?", "apples"}}).empty());
+    EXPECT_EQ(H.get({{"?", "likes", "?"}}).size(), 1U);
+
+    // The terms are interned anew on the next put
+    EXPECT_TRUE(H.putAll({{{"peter", "likes", "apples"}}}));
+    EXPECT_EQ(Reader.get({{"peter", "?", "?"}}),
+              std::vector<HSResult>({HSResult("peter", "likes", "apples")}));
+  }
+  llvm::sys::fs::remove(DBFile);
+}
+
+TEST(HexastoreTest, RejectsLegacyDatabase) {
+  llvm::SmallString<128> DBFile;
+  ASSERT_FALSE(llvm::sys::fs::createTemporaryFile("hexastore", "db", DBFile));
+  {
+    // The old layout stored each permutation in its own set of tables
+    sqlite3 *DB = nullptr;
+    ASSERT_EQ(SQLITE_OK, sqlite3_open(DBFile.c_str(), &DB));
+    ASSERT_EQ(SQLITE_OK,
+              sqlite3_exec(DB,
+                           "create table spo_subject (id integer primary key, "
+                           "name varchar unique not null);",
+                           nullptr, nullptr, nullptr));
+    sqlite3_close(DB);
+  }
+  {
+    Hexastore H(DBFile.str().str());
+    EXPECT_FALSE(H.isValid());
+    EXPECT_FALSE(H.putAll({{{"mary", "likes", "hexastores"}}}));
+    EXPECT_TRUE(H.get({{"?", "?", "?"}}).empty());
+  }
+  llvm::sys::fs::remove(DBFile);
+}
+
 int main(int Argc, char **Argv) {
   ::testing::InitGoogleTest(&Argc, Argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,165 @@
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFGExporter.h"
+
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+using namespace psr;
+
+using EdgeTy = std::tuple<uint32_t, uint32_t, ICFGEdgeKind>;
+
+std::string exportToString(const LLVMBasedICFG &ICF,
+                           const ICFGExportOptions &Opts) {
+  std::string Ret;
+  llvm::raw_string_ostream OS(Ret);
+  exportICFG(ICF, OS, Opts);
+  OS.flush();
+  return Ret;
+}
+
+class LLVMBasedICFGExporterTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    IRDB = std::make_unique<LLVMProjectIRDB>(
+        PHASAR_BUILD_SUBFOLDER("control_flow/") + "icfg_export_c_m2r.ll");
+    ASSERT_TRUE(IRDB->isValid());
+    // With __ALL__, all functions are part of the ICFG
+    ICF = std::make_unique<LLVMBasedICFG>(IRDB.get(),
+                                          CallGraphAnalysisType::NORESOLVE,
+                                          std::vector<std::string>{"__ALL__"},
+                                          nullptr, nullptr, Soundness::Soundy,
+                                          /*IncludeGlobals*/ false);
+  }
+
+  uint32_t idOf(llvm::StringRef Fun, unsigned InstIdx) const {
+    const auto *F = IRDB->getFunction(Fun);
+    auto It = llvm::instructions(F).begin();
+    std::advance(It, InstIdx);
+    return IRDB->getInstructionId(&*It);
+  }
+
+  std::unique_ptr<LLVMProjectIRDB> IRDB;
+  std::unique_ptr<LLVMBasedICFG> ICF;
+};
+
+TEST_F(LLVMBasedICFGExporterTest, JsonlAndBinaryAgree) {
+  ICFGExportOptions Opts;
+  Opts.Format = ICFGExportFormat::Jsonl;
+  auto Jsonl = exportToString(*ICF, Opts);
+
+  std::set<uint32_t> Nodes;
+  std::set<EdgeTy> JsonEdges;
+  llvm::SmallVector<llvm::StringRef> Lines;
+  llvm::StringRef(Jsonl).split(Lines, '\n', -1, /*KeepEmpty*/ false);
+  for (auto Line : Lines) {
+    auto Json = llvm::json::parse(Line);
+    ASSERT_TRUE(bool(Json)) << llvm::toString(Json.takeError());
+    const auto *Obj = Json->getAsObject();
+    ASSERT_NE(nullptr, Obj);
+
+    if (Obj->getString("kind") == llvm::StringRef("node")) {
+      Nodes.insert(*Obj->getInteger("id"));
+      continue;
+    }
+
+    auto Type = *Obj->getString("type");
+    auto Kind = Type == "intra"            ? ICFGEdgeKind::Intra
+                : Type == "call"           ? ICFGEdgeKind::Call
+                : Type == "return"         ? ICFGEdgeKind::Return
+                : Type == "call-to-return" ? ICFGEdgeKind::CallToReturn
+                                           : ICFGEdgeKind(255);
+    JsonEdges.emplace(*Obj->getInteger("from"), *Obj->getInteger("to"), Kind);
+  }
+  EXPECT_EQ(IRDB->getNumInstructions(), Nodes.size());
+
+  Opts.Format = ICFGExportFormat::Binary;
+  auto Binary = readICFGBinaryEdgeList(exportToString(*ICF, Opts));
+  ASSERT_TRUE(Binary.has_value());
+
+  std::set<EdgeTy> BinEdges;
+  for (const auto &Edge : *Binary) {
+    BinEdges.emplace(Edge.From, Edge.To, Edge.Kind);
+  }
+  EXPECT_EQ(JsonEdges, BinEdges);
+
+  // main: %cmp -> br; br -> call @inc (true) / ret (false)
+  EXPECT_TRUE(BinEdges.count({idOf("main", 0), idOf("main", 1),
+                              ICFGEdgeKind::Intra}));
+  EXPECT_TRUE(BinEdges.count({idOf("main", 1), idOf("main", 2),
+                              ICFGEdgeKind::Intra}));
+  EXPECT_TRUE(BinEdges.count({idOf("main", 1), idOf("main", 5),
+                              ICFGEdgeKind::Intra}));
+  // call @inc
+  EXPECT_TRUE(
+      BinEdges.count({idOf("main", 2), idOf("inc", 0), ICFGEdgeKind::Call}));
+  EXPECT_TRUE(
+      BinEdges.count({idOf("inc", 1), idOf("main", 3), ICFGEdgeKind::Return}));
+  // call @ext
+  EXPECT_TRUE(BinEdges.count(
+      {idOf("main", 3), idOf("main", 4), ICFGEdgeKind::CallToReturn}));
+}
+
+TEST_F(LLVMBasedICFGExporterTest, OnlyReachable) {
+  ICFGExportOptions Opts;
+  Opts.Format = ICFGExportFormat::Binary;
+  Opts.ReachableFrom = {IRDB->getFunction("main")};
+  auto Binary = readICFGBinaryEdgeList(exportToString(*ICF, Opts));
+  ASSERT_TRUE(Binary.has_value());
+  ASSERT_FALSE(Binary->empty());
+
+  auto UnreachableEntry = idOf("unreachable", 0);
+  for (const auto &Edge : *Binary) {
+    EXPECT_NE(UnreachableEntry, Edge.From);
+  }
+
+  std::string CG;
+  llvm::raw_string_ostream OS(CG);
+  exportCallGraphAsJsonl(*ICF, OS, Opts.ReachableFrom);
+  OS.flush();
+  EXPECT_EQ(std::string::npos, CG.find("\"caller\":\"unreachable\""));
+  EXPECT_NE(std::string::npos, CG.find("\"callees\":[\"inc\"]"));
+}
+
+TEST_F(LLVMBasedICFGExporterTest, Dot) {
+  ICFGExportOptions Opts;
+  Opts.Format = ICFGExportFormat::Dot;
+  auto Dot = exportToString(*ICF, Opts);
+
+  EXPECT_TRUE(llvm::StringRef(Dot).startswith("digraph ICFG{\n"));
+  EXPECT_TRUE(llvm::StringRef(Dot).endswith("}\n"));
+  EXPECT_NE(std::string::npos,
+            Dot.find(std::to_string(idOf("main", 1)) + "->" +
+                     std::to_string(idOf("main", 2)) + "[label=\"true\"];"));
+  EXPECT_EQ(Dot, ICF->exportICFGAsDot(/*WithSourceCodeInfo*/ false));
+}
+
+TEST(LLVMBasedICFGExporterBinaryTest, RejectsInvalidInput) {
+  EXPECT_FALSE(readICFGBinaryEdgeList("").has_value());
+  EXPECT_FALSE(readICFGBinaryEdgeList("PSRICFG\1abc").has_value());
+  auto Empty = readICFGBinaryEdgeList("PSRICFG\1");
+  ASSERT_TRUE(Empty.has_value());
+  EXPECT_TRUE(Empty->empty());
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
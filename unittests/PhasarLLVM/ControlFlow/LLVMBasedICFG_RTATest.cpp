@@ -78,6 +78,52 @@ TEST(LLVMBasedICFG_RTATest, StaticCallSite_13) {
   }
 }
 
+TEST(LLVMBasedICFG_RTATest, VirtualCallSite_10) {
+  LLVMProjectIRDB IRDB(unittest::PathToLLTestFiles +
+                       "call_graphs/virtual_call_10_cpp.ll");
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMAliasSet PT(&IRDB);
+  LLVMBasedICFG ICFG(&IRDB, CallGraphAnalysisType::RTA, {"main"}, &TH, &PT);
+  const llvm::Function *CallFoo =
+      IRDB.getFunctionDefinition("_Z7callFooP4Base");
+  const llvm::Function *CallFooMismatched =
+      IRDB.getFunctionDefinition("_Z17callFooMismatchedP4Base");
+  const llvm::Function *CallFooAgain =
+      IRDB.getFunctionDefinition("_Z12callFooAgainP4Base");
+  const llvm::Function *BaseFoo = IRDB.getFunctionDefinition("_ZN4Base3fooEi");
+  const llvm::Function *DerivedFoo =
+      IRDB.getFunctionDefinition("_ZN7Derived3fooEi");
+  ASSERT_TRUE(CallFoo);
+  ASSERT_TRUE(CallFooMismatched);
+  ASSERT_TRUE(CallFooAgain);
+  ASSERT_TRUE(BaseFoo);
+  ASSERT_TRUE(DerivedFoo);
+
+  // All three call-sites share the vtable slot (Base, 0), so they are resolved
+  // from the same memoized callees
+  const llvm::Instruction *I1 = getNthInstruction(CallFoo, 8);
+  const llvm::Instruction *I2 = getNthInstruction(CallFooMismatched, 9);
+  const llvm::Instruction *I3 = getNthInstruction(CallFooAgain, 8);
+  for (const auto *I : {I1, I2, I3}) {
+    ASSERT_TRUE(I && llvm::isa<llvm::CallBase>(I));
+    ASSERT_TRUE(ICFG.isVirtualFunctionCall(I));
+  }
+
+  for (const auto *I : {I1, I3}) {
+    const auto &Callees = ICFG.getCalleesOfCallAt(I);
+    ASSERT_EQ(Callees.size(), 2U);
+    ASSERT_TRUE(llvm::is_contained(Callees, BaseFoo));
+    ASSERT_TRUE(llvm::is_contained(Callees, DerivedFoo));
+    ASSERT_TRUE(llvm::is_contained(ICFG.getCallersOf(DerivedFoo), I));
+  }
+
+  // The signature of this call-site does not match the functions in the
+  // slot, neither via RTA nor via the fallback to CHA
+  ASSERT_TRUE(ICFG.getCalleesOfCallAt(I2).empty());
+  ASSERT_FALSE(llvm::is_contained(ICFG.getCallersOf(BaseFoo), I2));
+  ASSERT_FALSE(llvm::is_contained(ICFG.getCallersOf(DerivedFoo), I2));
+}
+
 int main(int Argc, char **Argv) {
   ::testing::InitGoogleTest(&Argc, Argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,165 @@
+#include "phasar/PhasarLLVM/ControlFlow/LLVMFrozenICFG.h"
+
+#include "phasar/DataFlow/IfdsIde/IFDSTabulationProblem.h"
+#include "phasar/DataFlow/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMZeroValue.h"
+#include "phasar/PhasarLLVM/Domain/LLVMAnalysisDomain.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
+
+#include "llvm/IR/Instructions.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace psr;
+
+template <typename RangeT> auto toVector(const RangeT &Range) {
+  using value_type = std::decay_t<decltype(*Range.begin())>;
+  return std::vector<value_type>(Range.begin(), Range.end());
+}
+
+class LLVMFrozenICFGTest : public ::testing::TestWithParam<std::string> {};
+
+TEST_P(LLVMFrozenICFGTest, SameAsUnfrozen) {
+  LLVMProjectIRDB IRDB(unittest::PathToLLTestFiles + GetParam());
+  ASSERT_TRUE(IRDB.isValid());
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMAliasSet PT(&IRDB);
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::OTF, {"main"}, &TH, &PT);
+  LLVMFrozenICFG Frozen(ICF);
+
+  for (const auto *Inst : IRDB.getAllInstructions()) {
+    EXPECT_EQ(toVector(ICF.getSuccsOf(Inst)), toVector(Frozen.getSuccsOf(Inst)))
+        << "At " << llvmIRToString(Inst);
+    EXPECT_EQ(toVector(ICF.getPredsOf(Inst)), toVector(Frozen.getPredsOf(Inst)))
+        << "At " << llvmIRToString(Inst);
+    EXPECT_EQ(toVector(ICF.getSuccsOf(Inst)),
+              toVector(Frozen.getSuccsOfId(IRDB.getInstructionId(Inst))));
+    if (ICF.isCallSite(Inst)) {
+      EXPECT_EQ(toVector(ICF.getReturnSitesOfCallAt(Inst)),
+                toVector(Frozen.getReturnSitesOfCallAt(Inst)));
+      EXPECT_EQ(toVector(ICF.getCalleesOfCallAt(Inst)),
+                toVector(Frozen.getCalleesOfCallAt(Inst)));
+    }
+  }
+
+  for (const auto *Fun : IRDB.getAllFunctions()) {
+    EXPECT_EQ(toVector(ICF.getStartPointsOf(Fun)),
+              toVector(Frozen.getStartPointsOf(Fun)))
+        << "In " << Fun->getName().str();
+    EXPECT_EQ(toVector(ICF.getExitPointsOf(Fun)),
+              toVector(Frozen.getExitPointsOf(Fun)))
+        << "In " << Fun->getName().str();
+    EXPECT_EQ(toVector(ICF.getCallsFromWithin(Fun)),
+              toVector(Frozen.getCallsFromWithin(Fun)))
+        << "In " << Fun->getName().str();
+    EXPECT_EQ(toVector(ICF.getAllControlFlowEdges(Fun)),
+              toVector(Frozen.getAllControlFlowEdges(Fun)))
+        << "In " << Fun->getName().str();
+    EXPECT_EQ(toVector(ICF.getCallersOf(Fun)),
+              toVector(Frozen.getCallersOf(Fun)));
+  }
+
+  EXPECT_EQ(toVector(ICF.allNonCallStartNodes()),
+            toVector(Frozen.allNonCallStartNodes()));
+}
+
+static const std::vector<std::string> FrozenICFGTestFiles = {
+    "control_flow/branch_cpp.ll",
+    "control_flow/loop_cpp.ll",
+    "control_flow/switch_cpp.ll",
+    "control_flow/multi_calls_cpp.ll",
+    "control_flow/ignore_dbg_insts_4_cpp_dbg.ll",
+    "call_graphs/virtual_call_9_cpp.ll",
+};
+
+INSTANTIATE_TEST_SUITE_P(LLVMFrozenICFG, LLVMFrozenICFGTest,
+                         ::testing::ValuesIn(FrozenICFGTestFiles));
+
+// A minimal analysis that propagates all allocas through the ICFG; Used to
+// check that the solver produces the same results on the frozen ICFG.
+
+template <typename ICFGTy>
+struct AllocaDomain : LLVMAnalysisDomainDefault {
+  using i_t = ICFGTy;
+};
+
+template <typename ICFGTy>
+class AllocaPropagation : public IFDSTabulationProblem<AllocaDomain<ICFGTy>> {
+  using Base = IFDSTabulationProblem<AllocaDomain<ICFGTy>>;
+
+public:
+  using typename Base::d_t;
+  using typename Base::f_t;
+  using typename Base::n_t;
+  using FlowFunctionPtrType = typename Base::FlowFunctionPtrType;
+
+  explicit AllocaPropagation(const LLVMProjectIRDB *IRDB)
+      : Base(IRDB, {"main"}, LLVMZeroValue::getInstance()) {}
+
+  FlowFunctionPtrType getNormalFlowFunction(n_t Curr, n_t /*Succ*/) override {
+    if (llvm::isa<llvm::AllocaInst>(Curr)) {
+      return this->generateFromZero(Curr);
+    }
+    return this->identityFlow();
+  }
+  FlowFunctionPtrType getCallFlowFunction(n_t /*CallInst*/,
+                                          f_t /*CalleeFun*/) override {
+    return this->identityFlow();
+  }
+  FlowFunctionPtrType getRetFlowFunction(n_t /*CallSite*/, f_t /*CalleeFun*/,
+                                         n_t /*ExitInst*/,
+                                         n_t /*RetSite*/) override {
+    return this->killAllFlows();
+  }
+  FlowFunctionPtrType
+  getCallToRetFlowFunction(n_t /*CallSite*/, n_t /*RetSite*/,
+                           llvm::ArrayRef<f_t> /*Callees*/) override {
+    return this->identityFlow();
+  }
+
+  InitialSeeds<n_t, d_t, BinaryDomain> initialSeeds() override {
+    return this->createDefaultSeeds();
+  }
+};
+
+TEST(LLVMFrozenICFGSolverTest, SameResultsAsUnfrozen) {
+  LLVMProjectIRDB IRDB(unittest::PathToLLTestFiles +
+                       "control_flow/multi_calls_cpp.ll");
+  ASSERT_TRUE(IRDB.isValid());
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::OTF, {"main"});
+  LLVMFrozenICFG Frozen(ICF);
+
+  AllocaPropagation<LLVMBasedICFG> Problem(&IRDB);
+  IFDSSolver Solver(Problem, &ICF);
+  Solver.solve();
+
+  AllocaPropagation<LLVMFrozenICFG> FrozenProblem(&IRDB);
+  IFDSSolver FrozenSolver(FrozenProblem, &Frozen);
+  FrozenSolver.solve();
+
+  size_t NumFacts = 0;
+  for (const auto *Inst : IRDB.getAllInstructions()) {
+    auto Facts = Solver.ifdsResultsAt(Inst);
+    NumFacts += Facts.size();
+    EXPECT_EQ(Facts, FrozenSolver.ifdsResultsAt(Inst))
+        << "At " << llvmIRToString(Inst);
+  }
+  EXPECT_GT(NumFacts, 0U);
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
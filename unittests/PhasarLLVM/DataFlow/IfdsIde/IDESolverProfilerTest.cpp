@@ -0,0 +1,210 @@
+#include "phasar/DataFlow/IfdsIde/Solver/IDESolverProfiler.h"
+
+#include "phasar/DataFlow/IfdsIde/Solver/IDESolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IDELinearConstantAnalysis.h"
+
+#include "llvm/Support/raw_ostream.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace {
+
+using namespace psr;
+
+TEST(IDESolverProfilerTest, RankingAndExport) {
+  IDESolverProfiler<int> Profiler(/*SamplingPeriod*/ 1);
+
+  for (int I = 0; I < 3; ++I) {
+    auto Sample = Profiler.enter(1);
+    Profiler.countPathEdge();
+    Profiler.countJumpFunction();
+  }
+  {
+    auto Sample = Profiler.enter(2);
+    Profiler.countPathEdge();
+    auto FFSample = Profiler.sampleFlowFunctions();
+    // Nested samples must not count the same time twice
+    auto Inert = Profiler.sampleEdgeFunctions();
+    Inert.stop();
+    FFSample.stop();
+  }
+
+  const auto &Profiles = Profiler.getProfiles();
+  ASSERT_EQ(2U, Profiles.size());
+  EXPECT_EQ(3U, Profiles.lookup(1).PathEdges);
+  EXPECT_EQ(3U, Profiles.lookup(1).Propagations);
+  EXPECT_EQ(3U, Profiles.lookup(1).JumpFunctions);
+  EXPECT_EQ(1U, Profiles.lookup(2).PathEdges);
+  EXPECT_EQ(0U, Profiles.lookup(2).SampledEdgeFunctionNanos);
+
+  auto Ranking = Profiler.getRanking();
+  ASSERT_EQ(2U, Ranking.size());
+  for (size_t I = 1; I < Ranking.size(); ++I) {
+    EXPECT_GE(Ranking[I - 1].second->getTotalNanos(),
+              Ranking[I].second->getTotalNanos());
+  }
+
+  auto Json = Profiler.getAsJson(
+      [](int Fun) { return "fun" + std::to_string(Fun) + ";x"; });
+  EXPECT_EQ(4U, Json["TotalPathEdges"].get<size_t>());
+  ASSERT_EQ(2U, Json["Functions"].size());
+
+  std::string Folded;
+  llvm::raw_string_ostream OS(Folded);
+  Profiler.printAsFoldedStacks(
+      OS, [](int Fun) { return "fun" + std::to_string(Fun) + ";x"; });
+  // The frame separator must not appear within function names
+  EXPECT_EQ(std::string::npos, Folded.find("fun1;x"));
+}
+
+TEST(IDESolverProfilerTest, ReenterDuringPropagation) {
+  IDESolverProfiler<int> Profiler(/*SamplingPeriod*/ 1);
+
+  {
+    auto Sample = Profiler.enter(1);
+    // Processing the path edge of the running propagation
+    auto Reentered = Profiler.enter(1);
+    Profiler.countPathEdge();
+  }
+  {
+    auto Sample = Profiler.enter(2);
+    Profiler.countPathEdge();
+  }
+  {
+    auto Sample = Profiler.enter(1);
+    Profiler.countPathEdge();
+  }
+
+  const auto &Profiles = Profiler.getProfiles();
+  EXPECT_EQ(2U, Profiles.lookup(1).Propagations);
+  EXPECT_EQ(2U, Profiles.lookup(1).SampledPropagations);
+  EXPECT_EQ(2U, Profiles.lookup(1).PathEdges);
+  EXPECT_EQ(1U, Profiles.lookup(2).Propagations);
+  EXPECT_EQ(1U, Profiles.lookup(2).PathEdges);
+}
+
+/// Slows down the normal flow functions of one function, such that its
+/// profile must be clearly distinguishable from the one of its caller
+class SlowCalleeLinearConstantAnalysis : public IDELinearConstantAnalysis {
+public:
+  static constexpr std::chrono::milliseconds SlowDown{2};
+
+  SlowCalleeLinearConstantAnalysis(const LLVMProjectIRDB *IRDB,
+                                   const LLVMBasedICFG *ICF,
+                                   const llvm::Function *SlowFun)
+      : IDELinearConstantAnalysis(IRDB, ICF, {"main"}), SlowFun(SlowFun) {}
+
+  FlowFunctionPtrType getNormalFlowFunction(n_t Curr, n_t Succ) override {
+    auto FF = IDELinearConstantAnalysis::getNormalFlowFunction(Curr, Succ);
+    if (Curr->getFunction() != SlowFun) {
+      return FF;
+    }
+    return lambdaFlow([FF](d_t Source) {
+      std::this_thread::sleep_for(SlowDown);
+      return FF->computeTargets(Source);
+    });
+  }
+
+private:
+  const llvm::Function *SlowFun;
+};
+
+TEST(IDESolverProfilerTest, ChargesCallerAndCalleeSeparately) {
+  LLVMProjectIRDB IRDB(unittest::PathToLLTestFiles +
+                       "linear_constant/call_13_cpp.ll");
+  ASSERT_TRUE(IRDB.isValid());
+
+  const auto *Main = IRDB.getFunctionDefinition("main");
+  const auto *Work = IRDB.getFunctionDefinition("_Z4worki");
+  ASSERT_NE(nullptr, Main);
+  ASSERT_NE(nullptr, Work);
+
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::NORESOLVE, {"main"});
+  SlowCalleeLinearConstantAnalysis Problem(&IRDB, &ICF, Work);
+  Problem.getIFDSIDESolverConfig().setProfile();
+
+  IDESolver Solver(Problem, &ICF);
+  Solver.solve();
+
+  const auto *Profiler = Solver.getProfiler();
+  ASSERT_NE(nullptr, Profiler);
+  const auto &Profiles = Profiler->getProfiles();
+  ASSERT_TRUE(Profiles.count(Main));
+  ASSERT_TRUE(Profiles.count(Work));
+  const auto &MainProfile = Profiles.lookup(Main);
+  const auto &WorkProfile = Profiles.lookup(Work);
+
+  // Without branches, every new jump function is processed as path edge
+  // exactly once and both must be charged to the function of their target,
+  // although main and work alternate on the worklist
+  EXPECT_EQ(MainProfile.JumpFunctions, MainProfile.PathEdges);
+  EXPECT_EQ(WorkProfile.JumpFunctions, WorkProfile.PathEdges);
+  EXPECT_GT(MainProfile.PathEdges, 0U);
+  EXPECT_GT(WorkProfile.PathEdges, 0U);
+
+  // Only the flow functions of work are slow. The first propagation into
+  // each function is always sampled.
+  auto SlowDownNanos = uint64_t(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          SlowCalleeLinearConstantAnalysis::SlowDown)
+          .count());
+  EXPECT_GE(WorkProfile.SampledFlowFunctionNanos, SlowDownNanos);
+  EXPECT_LT(MainProfile.SampledFlowFunctionNanos, SlowDownNanos);
+}
+
+TEST(IDESolverProfilerTest, ProfileLinearConstantAnalysis) {
+  LLVMProjectIRDB IRDB(unittest::PathToLLTestFiles +
+                       "linear_constant/call_13_cpp.ll");
+  ASSERT_TRUE(IRDB.isValid());
+
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::NORESOLVE, {"main"});
+  IDELinearConstantAnalysis Problem(&IRDB, &ICF, {"main"});
+  Problem.getIFDSIDESolverConfig().setProfile();
+
+  IDESolver Solver(Problem, &ICF);
+  Solver.solve();
+
+  const auto *Profiler = Solver.getProfiler();
+  ASSERT_NE(nullptr, Profiler);
+
+  const auto *Main = IRDB.getFunctionDefinition("main");
+  const auto *Work = IRDB.getFunctionDefinition("_Z4worki");
+  const auto &Profiles = Profiler->getProfiles();
+  ASSERT_TRUE(Profiles.count(Main));
+  ASSERT_TRUE(Profiles.count(Work));
+  EXPECT_GT(Profiles.lookup(Main).PathEdges, 0U);
+  EXPECT_GT(Profiles.lookup(Work).PathEdges, 0U);
+  EXPECT_GT(Profiles.lookup(Work).JumpFunctions, 0U);
+
+  std::string Json;
+  llvm::raw_string_ostream OS(Json);
+  Solver.emitProfileAsJson(OS);
+  EXPECT_NE(std::string::npos, OS.str().find("\"_Z4worki\""));
+}
+
+TEST(IDESolverProfilerTest, DisabledByDefault) {
+  LLVMProjectIRDB IRDB(unittest::PathToLLTestFiles +
+                       "linear_constant/call_13_cpp.ll");
+  ASSERT_TRUE(IRDB.isValid());
+
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::NORESOLVE, {"main"});
+  IDELinearConstantAnalysis Problem(&IRDB, &ICF, {"main"});
+
+  IDESolver Solver(Problem, &ICF);
+  Solver.solve();
+  EXPECT_EQ(nullptr, Solver.getProfiler());
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,50 @@
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LibCSummary.h"
+
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/StaticFunctionDataFlowFacts.h"
+
+#include "gtest/gtest.h"
+
+#include <variant>
+
+using namespace psr;
+using namespace psr::library_summary;
+
+TEST(LibCSummaryTest, FindsSummarizedFunctions) {
+  const auto &Sum = getLibCSummary();
+  ASSERT_FALSE(Sum.empty());
+
+  for (const auto &Fun : Sum) {
+    EXPECT_EQ(&Fun, Sum.find(Fun.Name)) << "for function " << Fun.Name.str();
+  }
+}
+
+TEST(LibCSummaryTest, RejectsUnknownFunctions) {
+  const auto &Sum = getLibCSummary();
+
+  EXPECT_FALSE(Sum.contains("main"));
+  EXPECT_FALSE(Sum.contains("strcpy_"));
+  EXPECT_FALSE(Sum.contains(""));
+  EXPECT_TRUE(Sum.getDataFlowFacts("main", 0).empty());
+}
+
+TEST(LibCSummaryTest, StrcpySummary) {
+  const auto &Sum = getLibCSummary();
+
+  auto SrcFacts = Sum.getDataFlowFacts("strcpy", 1);
+  ASSERT_EQ(1, SrcFacts.size());
+  const auto *Param = std::get_if<Parameter>(&SrcFacts[0].Fact);
+  ASSERT_NE(nullptr, Param);
+  EXPECT_EQ(0, Param->Index);
+
+  auto DestFacts = Sum.getDataFlowFacts("strcpy", 0);
+  ASSERT_EQ(1, DestFacts.size());
+  EXPECT_TRUE(std::holds_alternative<ReturnValue>(DestFacts[0].Fact));
+
+  EXPECT_TRUE(Sum.getDataFlowFacts("strcpy", 2).empty());
+}
+
+// main function for the test case
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
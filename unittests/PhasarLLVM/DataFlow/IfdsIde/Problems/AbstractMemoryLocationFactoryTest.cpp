@@ -0,0 +1,135 @@
+/******************************************************************************
+ * Copyright (c) 2024 Fabian Schiebel.
+ * All rights reserved. This program and the accompanying materials are made
+ * available under the terms of LICENSE.txt.
+ *
+ * Contributors:
+ *     Fabian Schiebel and others
+ *****************************************************************************/
+
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/ExtendedTaintAnalysis/AbstractMemoryLocationFactory.h"
+
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/Casting.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+using namespace psr;
+
+namespace {
+
+class AbstractMemoryLocationFactoryTest : public ::testing::Test {
+protected:
+  static constexpr auto PathToLLFiles = PHASAR_BUILD_SUBFOLDER("xtaint/");
+  static constexpr unsigned Bound = 3;
+
+  LLVMProjectIRDB IRDB{PathToLLFiles + "xtaint03_cpp.ll"};
+  AbstractMemoryLocationFactory<AbstractMemoryLocation> Factory{
+      &IRDB.getModule()->getDataLayout(), 128};
+
+  const llvm::AllocaInst *Array{};
+  /// &array[1]
+  const llvm::GetElementPtrInst *Gep{};
+
+  void SetUp() override {
+    ASSERT_TRUE(IRDB.isValid());
+    const auto *Main = IRDB.getFunctionDefinition("main");
+    ASSERT_NE(nullptr, Main);
+
+    for (const auto &Inst : llvm::instructions(Main)) {
+      if (const auto *Alloca = llvm::dyn_cast<llvm::AllocaInst>(&Inst);
+          Alloca && Alloca->getAllocatedType()->isArrayTy()) {
+        Array = Alloca;
+      } else if (const auto *G = llvm::dyn_cast<llvm::GetElementPtrInst>(&Inst);
+                 G && G->getPointerOperand() == Array &&
+                 llvm::cast<llvm::ConstantInt>(G->getOperand(2))->isOne()) {
+        Gep = G;
+      }
+    }
+    ASSERT_NE(nullptr, Array);
+    ASSERT_NE(nullptr, Gep);
+  }
+};
+
+TEST_F(AbstractMemoryLocationFactoryTest, WithOffsetIsMemoized) {
+  auto Base = Factory.create(Array, Bound);
+  ASSERT_EQ(1U, Factory.size());
+
+  auto WithOffs = Factory.withOffset(Base, Gep);
+  EXPECT_EQ(Array, WithOffs->base());
+  EXPECT_EQ((std::vector<ptrdiff_t>{sizeof(int32_t)}),
+            std::vector<ptrdiff_t>(WithOffs->offsets().begin(),
+                                   WithOffs->offsets().end()));
+  EXPECT_EQ(2U, Factory.size());
+  EXPECT_EQ(1U, Factory.getNumMemoizedDerivations());
+
+  EXPECT_EQ(WithOffs, Factory.withOffset(Base, Gep));
+  EXPECT_EQ(2U, Factory.size());
+  EXPECT_EQ(1U, Factory.getNumMemoizedDerivations());
+}
+
+TEST_F(AbstractMemoryLocationFactoryTest, WithIndirectionOfIsMemoized) {
+  auto Base = Factory.create(Array, Bound);
+
+  auto Ind = Factory.withIndirectionOf(Base, {8});
+  EXPECT_EQ((std::vector<ptrdiff_t>{0, 8}),
+            std::vector<ptrdiff_t>(Ind->offsets().begin(),
+                                   Ind->offsets().end()));
+  EXPECT_EQ(Base->lifetime() - 1, Ind->lifetime());
+  EXPECT_EQ(2U, Factory.size());
+  EXPECT_EQ(1U, Factory.getNumMemoizedDerivations());
+
+  EXPECT_EQ(Ind, Factory.withIndirectionOf(Base, {8}));
+  EXPECT_EQ(2U, Factory.size());
+  EXPECT_EQ(1U, Factory.getNumMemoizedDerivations());
+
+  // An empty indirection is the same as a zero-offset
+  auto Empty = Factory.withIndirectionOf(Base, {});
+  EXPECT_EQ(Empty, Factory.withIndirectionOf(Base, {0}));
+  EXPECT_EQ(3U, Factory.size());
+  EXPECT_EQ(2U, Factory.getNumMemoizedDerivations());
+}
+
+TEST_F(AbstractMemoryLocationFactoryTest, ResetInvalidatesCaches) {
+  {
+    auto Base = Factory.create(Array, Bound);
+    (void)Factory.withOffset(Base, Gep);
+    (void)Factory.withIndirectionOf(Base, {8});
+    ASSERT_EQ(3U, Factory.size());
+    ASSERT_EQ(2U, Factory.getNumMemoizedDerivations());
+  }
+
+  Factory.reset();
+  EXPECT_EQ(0U, Factory.size());
+  EXPECT_EQ(0U, Factory.getNumMemoizedDerivations());
+  EXPECT_TRUE(Factory.getOrCreateZero()->isZero());
+
+  // All derived locations must be re-created from scratch; stale cache entries
+  // could otherwise be hit, if the new base is allocated at the address of the
+  // old one
+  auto Base = Factory.create(Array, Bound);
+  EXPECT_EQ(1U, Factory.size());
+
+  auto WithOffs = Factory.withOffset(Base, Gep);
+  EXPECT_EQ(2U, Factory.size());
+  EXPECT_EQ(Array, WithOffs->base());
+  EXPECT_EQ(sizeof(int32_t), size_t(WithOffs->offsets().back()));
+
+  auto Ind = Factory.withIndirectionOf(Base, {8});
+  EXPECT_EQ(3U, Factory.size());
+  EXPECT_EQ(8, Ind->offsets().back());
+  EXPECT_EQ(2U, Factory.getNumMemoizedDerivations());
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -191,6 +191,49 @@ TEST_F(IDEGeneralizedLCATest, NullTest) {
   compareResults(GroundTruth);
 }
 
+TEST(IDEGeneralizedLCAEdgeValueTest, IntegerArithmeticWraps) {
+  llvm::APInt I8Max(8, 127);
+  llvm::APInt I8One(8, 1);
+  auto Sum = EdgeValue(I8Max).performBinOp(llvm::BinaryOperator::Add,
+                                           EdgeValue(I8One));
+  EXPECT_EQ(EdgeValue(llvm::APInt(8, -128, /*isSigned*/ true)), Sum);
+
+  auto Quot = EdgeValue(7).performBinOp(llvm::BinaryOperator::SDiv,
+                                        EdgeValue(-2));
+  EXPECT_EQ(EdgeValue(-3), Quot);
+  EXPECT_EQ(EdgeValue(2), EdgeValue(7).performBinOp(llvm::BinaryOperator::Sub,
+                                                    EdgeValue(5)));
+  EXPECT_EQ(EdgeValue(0x7fffffff),
+            EdgeValue(-1).performBinOp(llvm::BinaryOperator::LShr,
+                                       EdgeValue(1)));
+  EXPECT_TRUE(EdgeValue(1)
+                  .performBinOp(llvm::BinaryOperator::SDiv, EdgeValue(0))
+                  .isTop());
+}
+
+TEST(IDEGeneralizedLCAEdgeValueTest, StringsAreInterned) {
+  std::string Hello = "Hello";
+  EXPECT_EQ(EdgeValue("Hello, World"),
+            EdgeValue(Hello) + EdgeValue(llvm::StringRef(", World")));
+  EXPECT_NE(EdgeValue("Hello"), EdgeValue("World"));
+}
+
+TEST(IDEGeneralizedLCAEdgeValueTest, JoinIsSortedAndBounded) {
+  EdgeValueSet Lhs({EdgeValue(3), EdgeValue(1)});
+  EdgeValueSet Rhs({EdgeValue(1), EdgeValue(3)});
+  EXPECT_EQ(Lhs, Rhs);
+  EXPECT_EQ(Lhs, join(Lhs, Rhs, 2));
+  EXPECT_EQ(EdgeValue(1), *Lhs.begin());
+
+  EXPECT_TRUE(isTopValue(join(Lhs, EdgeValueSet({EdgeValue(2)}), 2)));
+  EXPECT_EQ(EdgeValueSet({EdgeValue(1), EdgeValue(2), EdgeValue(3)}),
+            join(Lhs, EdgeValueSet({EdgeValue(2)}), 3));
+
+  EXPECT_EQ(EdgeValueSet({EdgeValue(4.5)}),
+            EdgeValueSet({EdgeValue(4.5), EdgeValue(4.5000000001)}));
+  EXPECT_EQ(Ordering::Less, compare(EdgeValueSet({EdgeValue(1)}), Lhs));
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -24,10 +24,56 @@
 
 #include <memory>
 #include <optional>
+#include <set>
+#include <string>
 
 using namespace std;
 using namespace psr;
 
+/// Implements only the string-based interface of a type-state description,
+/// such that the analysis has to use the default getToken()
+class StringOnlyFileIODescription
+    : public TypeStateDescription<CSTDFILEIOState> {
+public:
+  using TypeStateDescription::getNextState;
+
+  [[nodiscard]] bool isFactoryFunction(llvm::StringRef F) const override {
+    return Desc.isFactoryFunction(F);
+  }
+  [[nodiscard]] bool isConsumingFunction(llvm::StringRef F) const override {
+    return Desc.isConsumingFunction(F);
+  }
+  [[nodiscard]] bool isAPIFunction(llvm::StringRef F) const override {
+    return Desc.isAPIFunction(F);
+  }
+  [[nodiscard]] State getNextState(llvm::StringRef Tok,
+                                   State S) const override {
+    return Desc.getNextState(Tok, S);
+  }
+  [[nodiscard]] std::string getTypeNameOfInterest() const override {
+    return Desc.getTypeNameOfInterest();
+  }
+  [[nodiscard]] std::set<int>
+  getConsumerParamIdx(llvm::StringRef F) const override {
+    return Desc.getConsumerParamIdx(F);
+  }
+  [[nodiscard]] std::set<int>
+  getFactoryParamIdx(llvm::StringRef F) const override {
+    return Desc.getFactoryParamIdx(F);
+  }
+  [[nodiscard]] State bottom() const override { return Desc.bottom(); }
+  [[nodiscard]] State top() const override { return Desc.top(); }
+  [[nodiscard]] State uninit() const override { return Desc.uninit(); }
+  [[nodiscard]] State start() const override { return Desc.start(); }
+  [[nodiscard]] State error() const override { return Desc.error(); }
+  [[nodiscard]] DataFlowAnalysisType analysisType() const override {
+    return Desc.analysisType();
+  }
+
+private:
+  CSTDFILEIOTypeStateDescription Desc{};
+};
+
 /* ============== TEST FIXTURE ============== */
 class IDETSAnalysisFileIOTest : public ::testing::Test {
 protected:
@@ -68,10 +114,10 @@ protected:
    * @param groundTruth results to compare against
    * @param solver provides the results
    */
+  template <typename SolverTy>
   void compareResults(
       const std::map<std::size_t, std::map<std::string, int>> &GroundTruth,
-      IDESolver_P<IDETypeStateAnalysis<CSTDFILEIOTypeStateDescription>>
-          &Solver) {
+      SolverTy &Solver) {
     for (const auto &InstToGroundTruth : GroundTruth) {
       const auto *Inst =
           HA->getProjectIRDB().getInstruction(InstToGroundTruth.first);
@@ -101,6 +147,35 @@ TEST_F(IDETSAnalysisFileIOTest, HandleTypeState_01) {
   compareResults(Gt, Llvmtssolver);
 }
 
+TEST_F(IDETSAnalysisFileIOTest, HandleTypeState_01_StringOnlyDescription) {
+  initialize({PathToLlFiles + "typestate_01_c.ll"});
+  StringOnlyFileIODescription StringOnlyDesc;
+  auto StringOnlyProblem = createAnalysisProblem<
+      IDETypeStateAnalysis<StringOnlyFileIODescription>>(*HA, &StringOnlyDesc,
+                                                         EntryPoints);
+  IDESolver Llvmtssolver(StringOnlyProblem, &HA->getICFG());
+  Llvmtssolver.solve();
+  const std::map<std::size_t, std::map<std::string, int>> Gt = {
+      {5, {{"3", IOSTATE::UNINIT}}},
+      {9, {{"3", IOSTATE::CLOSED}}},
+      {7, {{"3", IOSTATE::OPENED}}}};
+  compareResults(Gt, Llvmtssolver);
+
+  // The default tokens are dense and stable per function name
+  auto FOpen = StringOnlyDesc.getToken("fopen");
+  auto FClose = StringOnlyDesc.getToken("fclose");
+  EXPECT_NE(FOpen, FClose);
+  EXPECT_LT(FOpen, 2U);
+  EXPECT_LT(FClose, 2U);
+  EXPECT_EQ(FOpen, StringOnlyDesc.getToken("fopen"));
+  EXPECT_EQ(CSTDFILEIOState::OPENED,
+            StringOnlyDesc.getNextStateOfToken(FOpen, CSTDFILEIOState::UNINIT,
+                                               nullptr));
+  EXPECT_EQ(CSTDFILEIOState::CLOSED,
+            StringOnlyDesc.getNextStateOfToken(FClose, CSTDFILEIOState::OPENED,
+                                               nullptr));
+}
+
 TEST_F(IDETSAnalysisFileIOTest, HandleTypeState_02) {
   initialize({PathToLlFiles + "typestate_02_c.ll"});
   IDESolver Llvmtssolver(*TSProblem, &HA->getICFG());
@@ -0,0 +1,91 @@
+#include "phasar/DataFlow/IfdsIde/SolverResults.h"
+
+#include "phasar/ControlFlow/StmtLess.h"
+#include "phasar/DataFlow/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSUninitializedVariables.h"
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace psr;
+
+constexpr auto PathToLLFiles =
+    PHASAR_BUILD_SUBFOLDER("uninitialized_variables/");
+
+TEST(SolverResultsTest, StmtLessUsesInstructionIds) {
+  LLVMProjectIRDB IRDB(PathToLLFiles + "growing_example_cpp_dbg.ll");
+  ASSERT_TRUE(IRDB.isValid());
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::NORESOLVE, {"main"});
+
+  std::vector<const llvm::Instruction *> Expected(
+      IRDB.getAllInstructions().begin(), IRDB.getAllInstructions().end());
+  // More than 10 instructions, such that a lexicographic comparison of the
+  // ids would be wrong
+  ASSERT_GT(Expected.size(), 10U);
+
+  auto Insts = Expected;
+  std::reverse(Insts.begin(), Insts.end());
+  std::sort(Insts.begin(), Insts.end(), StmtLess<LLVMBasedICFG>(&ICF));
+  EXPECT_EQ(Expected, Insts);
+}
+
+TEST(SolverResultsTest, ExportAsJsonl) {
+  LLVMProjectIRDB IRDB(PathToLLFiles + "growing_example_cpp_dbg.ll");
+  ASSERT_TRUE(IRDB.isValid());
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::NORESOLVE, {"main"});
+
+  IFDSUninitializedVariables Problem(&IRDB, {"main"});
+  IFDSSolver Solver(Problem, &ICF);
+  Solver.solve();
+
+  std::string Str;
+  llvm::raw_string_ostream OS(Str);
+  Solver.getSolverResults().exportResultsAsJsonl(ICF, OS);
+  OS.flush();
+
+  llvm::SmallVector<llvm::StringRef> Lines;
+  llvm::StringRef(Str).split(Lines, '\n', -1, /*KeepEmpty*/ false);
+  ASSERT_FALSE(Lines.empty());
+
+  size_t NumResults = 0;
+  for (auto Line : Lines) {
+    auto Json = llvm::json::parse(Line);
+    ASSERT_TRUE(bool(Json)) << llvm::toString(Json.takeError());
+    const auto *Obj = Json->getAsObject();
+    ASSERT_NE(nullptr, Obj);
+    EXPECT_TRUE(Obj->getString("function").hasValue());
+    EXPECT_TRUE(Obj->getString("stmt").hasValue());
+
+    auto Id = Obj->getString("id");
+    ASSERT_TRUE(Id.hasValue());
+    const auto *Inst = IRDB.getInstruction(std::stoul(Id->str()));
+    ASSERT_NE(nullptr, Inst);
+
+    const auto *Results = Obj->getArray("results");
+    ASSERT_NE(nullptr, Results);
+    EXPECT_EQ(Solver.ifdsResultsAt(Inst).size(), Results->size());
+    NumResults += Results->size();
+  }
+
+  EXPECT_EQ(Solver.getSolverResults().getAllResultEntries().size(),
+            NumResults);
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,149 @@
+#include "phasar/DataFlow/IfdsIde/IFDSTabulationProblem.h"
+#include "phasar/DataFlow/IfdsIde/Solver/IFDSSolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMZeroValue.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSTaintAnalysis.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/Problems/IFDSUninitializedVariables.h"
+#include "phasar/PhasarLLVM/Domain/LLVMAnalysisDomain.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/TaintConfig/LLVMTaintConfig.h"
+#include "phasar/PhasarLLVM/Utils/LLVMShorthands.h"
+
+#include "llvm/IR/Instructions.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <set>
+
+namespace {
+
+using namespace psr;
+
+constexpr auto PathToLLFiles = PHASAR_BUILD_SUBFOLDER("sparse_esg/");
+
+/// Propagates all allocas; All other instructions are irrelevant
+class AllocaPropagation
+    : public IFDSTabulationProblem<LLVMIFDSAnalysisDomainDefault> {
+public:
+  explicit AllocaPropagation(const LLVMProjectIRDB *IRDB)
+      : IFDSTabulationProblem(IRDB, {"main"}, LLVMZeroValue::getInstance()) {}
+
+  FlowFunctionPtrType getNormalFlowFunction(n_t Curr, n_t /*Succ*/) override {
+    if (llvm::isa<llvm::AllocaInst>(Curr)) {
+      return generateFromZero(Curr);
+    }
+    return identityFlow();
+  }
+  FlowFunctionPtrType getCallFlowFunction(n_t /*CallInst*/,
+                                          f_t /*CalleeFun*/) override {
+    return identityFlow();
+  }
+  FlowFunctionPtrType getRetFlowFunction(n_t /*CallSite*/, f_t /*CalleeFun*/,
+                                         n_t /*ExitInst*/,
+                                         n_t /*RetSite*/) override {
+    return killAllFlows();
+  }
+  FlowFunctionPtrType
+  getCallToRetFlowFunction(n_t /*CallSite*/, n_t /*RetSite*/,
+                           llvm::ArrayRef<f_t> /*Callees*/) override {
+    return identityFlow();
+  }
+
+  InitialSeeds<n_t, d_t, l_t> initialSeeds() override {
+    return createDefaultSeeds();
+  }
+
+  [[nodiscard]] bool isIrrelevantStmt(n_t Stmt) const override {
+    return !llvm::isa<llvm::AllocaInst>(Stmt);
+  }
+};
+
+/// Solves both problems, the second one with a sparse ESG, and checks that
+/// the sparse solver computes the same facts with fewer jump functions
+template <typename ProblemTy>
+void compareSparseAndDense(const LLVMProjectIRDB &IRDB,
+                           const LLVMBasedICFG &ICF, ProblemTy &DenseProblem,
+                           ProblemTy &SparseProblem) {
+  IFDSSolver DenseSolver(DenseProblem, &ICF);
+  DenseSolver.solve();
+
+  SparseProblem.getIFDSIDESolverConfig().setSparseESG();
+  IFDSSolver SparseSolver(SparseProblem, &ICF);
+  SparseSolver.solve();
+
+  EXPECT_LT(SparseSolver.getEdgeFunctionStatistics().TotalNumJF,
+            DenseSolver.getEdgeFunctionStatistics().TotalNumJF);
+
+  size_t NumFacts = 0;
+  for (const auto *Inst : IRDB.getAllInstructions()) {
+    auto Facts = DenseSolver.ifdsResultsAt(Inst);
+    NumFacts += Facts.size();
+    EXPECT_EQ(Facts, SparseSolver.ifdsResultsAt(Inst))
+        << "At " << llvmIRToString(Inst);
+  }
+  EXPECT_GT(NumFacts, 0U);
+}
+
+class SparseIDESolverTest : public ::testing::Test {
+protected:
+  LLVMProjectIRDB IRDB{PathToLLFiles + "sparse_esg_01_cpp.ll"};
+  LLVMBasedICFG ICF{&IRDB, CallGraphAnalysisType::NORESOLVE, {"main"}};
+
+  void SetUp() override { ASSERT_TRUE(IRDB.isValid()); }
+};
+
+TEST_F(SparseIDESolverTest, AllocaPropagation) {
+  AllocaPropagation DenseProblem(&IRDB);
+  AllocaPropagation SparseProblem(&IRDB);
+  compareSparseAndDense(IRDB, ICF, DenseProblem, SparseProblem);
+}
+
+TEST_F(SparseIDESolverTest, UninitializedVariables) {
+  IFDSUninitializedVariables DenseProblem(&IRDB);
+  IFDSUninitializedVariables SparseProblem(&IRDB);
+  compareSparseAndDense(IRDB, ICF, DenseProblem, SparseProblem);
+
+  EXPECT_FALSE(DenseProblem.getAllUndefUses().empty());
+  EXPECT_EQ(DenseProblem.getAllUndefUses(), SparseProblem.getAllUndefUses());
+}
+
+TEST_F(SparseIDESolverTest, TaintAnalysis) {
+  auto IsCallTo = [](const llvm::Instruction *Inst, llvm::StringRef Name) {
+    const auto *Call = llvm::dyn_cast<llvm::CallBase>(Inst);
+    return Call && Call->getCalledFunction() &&
+           Call->getCalledFunction()->getName() == Name;
+  };
+  LLVMTaintConfig Config(
+      [&IsCallTo](const llvm::Instruction *Inst) {
+        std::set<const llvm::Value *> Ret;
+        if (IsCallTo(Inst, "_Z6sourcev")) {
+          Ret.insert(Inst);
+        }
+        return Ret;
+      },
+      [&IsCallTo](const llvm::Instruction *Inst) {
+        std::set<const llvm::Value *> Ret;
+        if (IsCallTo(Inst, "_Z4sinki")) {
+          Ret.insert(llvm::cast<llvm::CallBase>(Inst)->getArgOperand(0));
+        }
+        return Ret;
+      });
+  LLVMAliasSet PT(&IRDB);
+
+  IFDSTaintAnalysis DenseProblem(&IRDB, &PT, &Config);
+  IFDSTaintAnalysis SparseProblem(&IRDB, &PT, &Config);
+  compareSparseAndDense(IRDB, ICF, DenseProblem, SparseProblem);
+
+  // Sinks are relevant statements, so the sparse ESG must find all leaks
+  EXPECT_FALSE(DenseProblem.Leaks.empty());
+  EXPECT_EQ(DenseProblem.Leaks, SparseProblem.Leaks);
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
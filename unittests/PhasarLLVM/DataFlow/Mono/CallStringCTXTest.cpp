@@ -0,0 +1,63 @@
+#include "phasar/DataFlow/Mono/Contexts/CallStringCTX.h"
+
+#include "gtest/gtest.h"
+
+#include <unordered_set>
+
+using namespace psr;
+
+TEST(CallStringCTXTest, KLimitedPushBack) {
+  CallStringCTX<int, 2> CS;
+  EXPECT_TRUE(CS.empty());
+  CS.push_back(1);
+  CS.push_back(2);
+  CS.push_back(3);
+  EXPECT_EQ(CS.size(), 2);
+  EXPECT_EQ(CS, (CallStringCTX<int, 2>{2, 3}));
+  EXPECT_EQ(CS.pop_back(), 3);
+  EXPECT_EQ(CS.pop_back(), 2);
+  EXPECT_TRUE(CS.empty());
+  EXPECT_EQ(CS.pop_back(), 0);
+  EXPECT_EQ(CS, (CallStringCTX<int, 2>{}));
+}
+
+TEST(CallStringCTXTest, InterningIsCanonical) {
+  CallStringCTXTree<int, 3> Tree;
+  auto Empty = Tree.getEmpty();
+  EXPECT_TRUE(Tree.empty(Empty));
+
+  auto A = Tree.push(Empty, 1);
+  auto AB = Tree.push(A, 2);
+  EXPECT_EQ(Tree.push(A, 2), AB);
+  EXPECT_EQ(Tree.intern({1, 2}), AB);
+  EXPECT_EQ(Tree.get(AB), (CallStringCTX<int, 3>{1, 2}));
+
+  EXPECT_EQ(Tree.pop(AB), A);
+  EXPECT_EQ(Tree.pop(A), Empty);
+  EXPECT_EQ(Tree.pop(Empty), Empty);
+  EXPECT_EQ(std::hash<CallStringCTXId>{}(AB), AB.Id);
+}
+
+TEST(CallStringCTXTest, KLimitedPush) {
+  CallStringCTXTree<int, 2> Tree;
+  auto Ctx = Tree.getEmpty();
+  for (int CS : {1, 2, 3, 4}) {
+    Ctx = Tree.push(Ctx, CS);
+  }
+  EXPECT_EQ(Tree.get(Ctx), (CallStringCTX<int, 2>{3, 4}));
+  EXPECT_EQ(Tree.get(Tree.pop(Ctx)), (CallStringCTX<int, 2>{3}));
+
+  // {}, {1}, {1,2}, {2}, {2,3}, {3}, {3,4}
+  EXPECT_EQ(Tree.size(), 7);
+
+  std::unordered_set<CallStringCTXId> Seen;
+  auto Other = Tree.push(Tree.push(Tree.getEmpty(), 3), 4);
+  EXPECT_EQ(Other, Ctx);
+  Seen.insert(Ctx);
+  EXPECT_FALSE(Seen.insert(Other).second);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
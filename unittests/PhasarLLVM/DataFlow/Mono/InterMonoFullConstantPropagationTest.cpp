@@ -65,6 +65,15 @@ protected:
       IMSolver.dumpResults();
     }
     llvm::outs() << "Done analysis!\n";
+
+    // The sparse propagation must not change the results
+    InterMonoSolver_P<InterMonoFullConstantPropagation, 3> SparseIMSolver(
+        FCP, InterMonoPropagationMode::Sparse);
+    SparseIMSolver.solve();
+    for (const auto *Inst : HA->getProjectIRDB().getAllInstructions()) {
+      EXPECT_EQ(IMSolver.getResultsAt(Inst), SparseIMSolver.getResultsAt(Inst))
+          << "at " << llvmIRToString(Inst);
+    }
     // do the comparison
     bool ResultNotEmpty = false;
     for (const auto &Truth : GroundTruth) {
@@ -55,6 +55,19 @@ protected:
       TaintSolver.dumpResults();
     }
     auto Leaks = TaintProblem.getAllLeaks();
+
+    // The sparse propagation must not change the results
+    auto SparseTaintProblem =
+        createAnalysisProblem<InterMonoTaintAnalysis>(HA, TC, EntryPoints);
+    InterMonoSolver<InterMonoTaintAnalysisDomain, 3> SparseTaintSolver(
+        SparseTaintProblem, InterMonoPropagationMode::Sparse);
+    SparseTaintSolver.solve();
+    EXPECT_EQ(Leaks, SparseTaintProblem.getAllLeaks());
+    for (const auto *Inst : HA.getProjectIRDB().getAllInstructions()) {
+      EXPECT_EQ(TaintSolver.getResultsAt(Inst),
+                SparseTaintSolver.getResultsAt(Inst))
+          << "at " << llvmIRToString(Inst);
+    }
     // for (auto &[Inst, Values] : Leaks) {
     //   // llvm::outs() << "I: " << llvmIRToShortString(Inst) << '\n';
     //   for (const auto *Value : Values) {
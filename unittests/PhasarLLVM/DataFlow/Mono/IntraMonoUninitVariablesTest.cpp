@@ -10,6 +10,7 @@
 #include "phasar/PhasarLLVM/DataFlow/Mono/Problems/IntraMonoUninitVariables.h"
 
 #include "phasar/Config/Configuration.h"
+#include "phasar/DataFlow/Mono/Solver/IntraMonoGenKillSolver.h"
 #include "phasar/DataFlow/Mono/Solver/IntraMonoSolver.h"
 #include "phasar/PhasarLLVM/ControlFlow/LLVMBasedCFG.h"
 #include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
@@ -26,44 +27,99 @@
 #include "TestConfig.h"
 #include "gtest/gtest.h"
 
+#include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 using namespace psr;
 
+namespace {
+/// Additionally seeds some facts at instructions that are not the entry of the
+/// function
+class SeededIntraMonoUninitVariables : public IntraMonoUninitVariables {
+public:
+  using IntraMonoUninitVariables::IntraMonoUninitVariables;
+
+  std::unordered_map<n_t, mono_container_t> ExtraSeeds;
+
+  std::unordered_map<n_t, mono_container_t> initialSeeds() override {
+    auto Seeds = IntraMonoUninitVariables::initialSeeds();
+    for (const auto &[Inst, Facts] : ExtraSeeds) {
+      Seeds[Inst].insert(Facts.begin(), Facts.end());
+    }
+    return Seeds;
+  }
+};
+} // namespace
+
 /* ============== TEST FIXTURE ============== */
 class IntraMonoUninitVariablesTest : public ::testing::Test {
 protected:
   static constexpr auto PathToLLFiles =
       PHASAR_BUILD_SUBFOLDER("/uninitialized_variables/");
 
-  using CompactResults_t = std::set<std::pair<size_t, std::set<std::string>>>;
+  /// Maps instruction-ids to the names of the variables that are
+  /// uninitialized right after that instruction
+  using CompactResults_t = std::map<size_t, std::set<std::string>>;
+  /// Maps instruction-ids to the ids of the allocas that are seeded there
+  using CompactSeeds_t = std::map<size_t, std::set<size_t>>;
 
   const std::vector<std::string> EntryPoints = {"main"};
 
+  static std::set<std::string>
+  toNames(const IntraMonoUninitVariables::mono_container_t &Facts) {
+    std::set<std::string> Ret;
+    for (const auto *Fact : Facts) {
+      Ret.insert("%" + Fact->getName().str());
+    }
+    return Ret;
+  }
+
   void doAnalysisAndCompareResults(llvm::StringRef LlvmFilePath,
-                                   const CompactResults_t & /*GroundTruth*/,
+                                   const CompactResults_t &GroundTruth,
+                                   const CompactSeeds_t &Seeds = {},
                                    bool PrintDump = false) {
     HelperAnalyses HA(PathToLLFiles + LlvmFilePath, EntryPoints);
+    const auto &IRDB = HA.getProjectIRDB();
 
     if (PrintDump) {
-      HA.getProjectIRDB().dump();
+      IRDB.dump();
     }
 
     auto Uninit =
-        createAnalysisProblem<IntraMonoUninitVariables>(HA, EntryPoints);
+        createAnalysisProblem<SeededIntraMonoUninitVariables>(HA, EntryPoints);
+    for (const auto &[InstId, FactIds] : Seeds) {
+      auto &Facts = Uninit.ExtraSeeds[IRDB.getInstruction(InstId)];
+      for (auto FactId : FactIds) {
+        Facts.insert(IRDB.getInstruction(FactId));
+      }
+    }
 
     IntraMonoSolver Solver(Uninit);
     Solver.solve();
     if (PrintDump) {
       Solver.dumpResults();
     }
-    // for (auto result :
-    //      TaintSolver.getResultsAt(IRDB->getInstruction(InstId)).getAsSet()) {
-    //   FoundResults.insert(getMetaDataID(result));
-    // }
-    // EXPECT_EQ(FoundResults, GroundTruth);
+
+    IntraMonoGenKillSolver GenKillSolver(Uninit);
+    GenKillSolver.solve();
+
+    for (const auto &[InstId, Expected] : GroundTruth) {
+      const auto *Inst = IRDB.getInstruction(InstId);
+      ASSERT_NE(nullptr, Inst) << "No instruction with id " << InstId;
+      EXPECT_EQ(Expected, toNames(Solver.getResultsAt(Inst)))
+          << "at " << llvmIRToString(Inst);
+      EXPECT_EQ(Expected, toNames(GenKillSolver.getResultsAt(Inst)))
+          << "at " << llvmIRToString(Inst);
+    }
+
+    // The bit-vector solver must compute exactly the same fixpoint
+    for (const auto *Inst : IRDB.getAllInstructions()) {
+      EXPECT_EQ(Solver.getResultsAt(Inst), GenKillSolver.getResultsAt(Inst))
+          << "at " << llvmIRToString(Inst);
+    }
   }
 
 }; // Test Fixture
@@ -75,10 +131,33 @@ protected:
 
 TEST_F(IntraMonoUninitVariablesTest, Basic_02) {
   CompactResults_t GroundTruth;
-  GroundTruth.insert({13, {"%b"}});
-  GroundTruth.insert({15, {"%a"}});
-  GroundTruth.insert({17, {"%a", "%b"}});
-  doAnalysisAndCompareResults("basic_02_cpp.ll", GroundTruth, true);
+  // store i32 0, i32* %retval
+  GroundTruth[5] = {"%argc.addr", "%argv.addr", "%a", "%b"};
+  // store i32 42, i32* %a
+  GroundTruth[11] = {"%argc.addr", "%argv.addr", "%b"};
+  // store i32 13, i32* %b
+  GroundTruth[13] = {"%argc.addr", "%argv.addr", "%a"};
+  // %1 = load i32, i32* %a; the analysis is a must-analysis
+  GroundTruth[15] = {"%argc.addr", "%argv.addr"};
+  GroundTruth[16] = {"%argc.addr", "%argv.addr"};
+  doAnalysisAndCompareResults("basic_02_cpp.ll", GroundTruth);
+}
+
+TEST_F(IntraMonoUninitVariablesTest, Basic_02_SeedsInsideBlocks) {
+  CompactSeeds_t Seeds;
+  // %retval at %0 = load i32, i32* %argc.addr, in the middle of the entry block
+  Seeds[8] = {0};
+  // %b at br label %if.end, behind the store to %b in the else-branch
+  Seeds[14] = {4};
+
+  CompactResults_t GroundTruth;
+  GroundTruth[5] = {"%argc.addr", "%argv.addr", "%a", "%b"};
+  GroundTruth[8] = {"%argc.addr", "%argv.addr", "%a", "%b", "%retval"};
+  GroundTruth[11] = {"%argc.addr", "%argv.addr", "%b", "%retval"};
+  GroundTruth[13] = {"%argc.addr", "%argv.addr", "%a", "%retval"};
+  GroundTruth[14] = {"%argc.addr", "%argv.addr", "%a", "%b", "%retval"};
+  GroundTruth[15] = {"%argc.addr", "%argv.addr", "%b", "%retval"};
+  doAnalysisAndCompareResults("basic_02_cpp.ll", GroundTruth, Seeds);
 }
 
 int main(int argc, char **argv) {
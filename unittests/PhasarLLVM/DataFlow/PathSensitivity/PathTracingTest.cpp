@@ -21,15 +21,19 @@
 #include "phasar/Utils/Utilities.h"
 
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/IR/Constants.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/IR/Instructions.h"
 #include "llvm/Support/Casting.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/raw_ostream.h"
 
 #include "TestConfig.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <fstream>
 #include <memory>
@@ -733,6 +737,198 @@ TEST_F(PathTracingTest, Handle_Intra_09) {
                });
 }
 
+TEST_F(PathTracingTest, Handle_Intra_08_Parallel) {
+  IRDB = std::make_unique<psr::LLVMProjectIRDB>(PathToLlFiles +
+                                                "intra_08_cpp.ll");
+  psr::LLVMTypeHierarchy TH(*IRDB);
+  psr::LLVMAliasSet PT(IRDB.get());
+  psr::LLVMBasedICFG ICFG(IRDB.get(), psr::CallGraphAnalysisType::OTF,
+                          {"main"}, &TH, &PT, psr::Soundness::Soundy,
+                          /*IncludeGlobals*/ false);
+  psr::IDELinearConstantAnalysis LCAProblem(IRDB.get(), &ICFG, {"main"});
+  psr::PathAwareIDESolver LCASolver(LCAProblem, &ICFG);
+  LCASolver.solve();
+
+  auto [LastInst, InterestingFact] = getInterestingInstFact();
+  psr::Z3BasedPathSensitivityManager<psr::IDELinearConstantAnalysisDomain> PSM(
+      &LCASolver.getExplicitESG(), {}, &LPC);
+
+  auto Expected = PSM.pathsTo(LastInst, InterestingFact);
+  ASSERT_FALSE(Expected.empty());
+
+  llvm::SmallVector<std::pair<const llvm::Instruction *, const llvm::Value *>>
+      Leaves(4, {LastInst, InterestingFact});
+  auto Results = PSM.pathsToAll(Leaves, 2);
+  ASSERT_EQ(Leaves.size(), Results.size());
+  for (const auto &PathsVec : Results) {
+    EXPECT_EQ(Expected, PathsVec);
+    for (const auto &Path : PathsVec) {
+      // Must have been translated into the context of LPC
+      EXPECT_EQ(&LPC.getContext(), &Path.Constraint.ctx());
+    }
+  }
+}
+
+TEST_F(PathTracingTest, Handle_Intra_08_Generator) {
+  IRDB = std::make_unique<psr::LLVMProjectIRDB>(PathToLlFiles +
+                                                "intra_08_cpp.ll");
+  psr::LLVMTypeHierarchy TH(*IRDB);
+  psr::LLVMAliasSet PT(IRDB.get());
+  psr::LLVMBasedICFG ICFG(IRDB.get(), psr::CallGraphAnalysisType::OTF,
+                          {"main"}, &TH, &PT, psr::Soundness::Soundy,
+                          /*IncludeGlobals*/ false);
+  psr::IDELinearConstantAnalysis LCAProblem(IRDB.get(), &ICFG, {"main"});
+  psr::PathAwareIDESolver LCASolver(LCAProblem, &ICFG);
+  LCASolver.solve();
+
+  auto [LastInst, InterestingFact] = getInterestingInstFact();
+  psr::Z3BasedPathSensitivityManager<psr::IDELinearConstantAnalysisDomain> PSM(
+      &LCASolver.getExplicitESG(), {}, &LPC);
+
+  auto Expected = PSM.pathsTo(LastInst, InterestingFact);
+  ASSERT_EQ(4U, Expected.size());
+
+  for (auto Order :
+       {psr::FlowPathOrder::DepthFirst, psr::FlowPathOrder::BestFirst,
+        psr::FlowPathOrder::ShortestFirst}) {
+    auto Gen = PSM.pathsGeneratorTo(LastInst, InterestingFact, Order);
+    psr::FlowPathSequence<const llvm::Instruction *> Paths;
+    while (auto Path = Gen.next()) {
+      Paths.push_back(std::move(*Path));
+    }
+    EXPECT_EQ(Expected.size(), Gen.getNumPathsYielded());
+
+    if (Order == psr::FlowPathOrder::ShortestFirst) {
+      EXPECT_TRUE(std::is_sorted(Paths.begin(), Paths.end(),
+                                 [](const auto &LHS, const auto &RHS) {
+                                   return LHS.size() < RHS.size();
+                                 }));
+    }
+
+    // pathsTo() returns the paths ordered by length and lexicographically
+    std::sort(Paths.begin(), Paths.end(),
+              [](const auto &LHS, const auto &RHS) {
+                return LHS.size() < RHS.size() ||
+                       (LHS.size() == RHS.size() &&
+                        std::lexicographical_compare(LHS.begin(), LHS.end(),
+                                                     RHS.begin(), RHS.end()));
+              });
+    EXPECT_EQ(Expected, Paths);
+  }
+
+  // Stopping after the first witness; it must be a shortest one
+  auto Gen = PSM.pathsGeneratorTo(LastInst, InterestingFact);
+  auto First = Gen.next();
+  ASSERT_TRUE(First.has_value());
+  EXPECT_EQ(Expected.front().size(), First->size());
+  EXPECT_EQ(1U, Gen.getNumPathsYielded());
+}
+
+TEST_F(PathTracingTest, Handle_Intra_08_SpilledESG) {
+  IRDB = std::make_unique<psr::LLVMProjectIRDB>(PathToLlFiles +
+                                                "intra_08_cpp.ll");
+  psr::LLVMTypeHierarchy TH(*IRDB);
+  psr::LLVMAliasSet PT(IRDB.get());
+  psr::LLVMBasedICFG ICFG(IRDB.get(), psr::CallGraphAnalysisType::OTF,
+                          {"main"}, &TH, &PT, psr::Soundness::Soundy,
+                          /*IncludeGlobals*/ false);
+  psr::IDELinearConstantAnalysis LCAProblem(IRDB.get(), &ICFG, {"main"});
+  psr::PathAwareIDESolver LCASolver(LCAProblem, &ICFG);
+  LCASolver.solve();
+
+  auto [LastInst, InterestingFact] = getInterestingInstFact();
+
+  psr::ExplodedSuperGraph InMemoryESG(LCASolver.getExplicitESG());
+  llvm::SmallString<128> SpillFile;
+  ASSERT_FALSE(
+      llvm::sys::fs::createTemporaryFile("intra_08-esg", "bin", SpillFile));
+  psr::scope_exit RemoveSpillFile = [&SpillFile] {
+    llvm::sys::fs::remove(SpillFile);
+  };
+  ASSERT_FALSE(LCASolver.spillExplicitESGTo(SpillFile));
+  ASSERT_TRUE(LCASolver.getExplicitESG().isSpilled());
+  EXPECT_EQ(InMemoryESG.size(), LCASolver.getExplicitESG().size());
+
+  psr::Z3BasedPathSensitivityManager<psr::IDELinearConstantAnalysisDomain>
+      InMemoryPSM(&InMemoryESG, {}, &LPC);
+  psr::Z3BasedPathSensitivityManager<psr::IDELinearConstantAnalysisDomain>
+      SpilledPSM(&LCASolver.getExplicitESG(), {}, &LPC);
+
+  auto Expected = InMemoryPSM.pathsTo(LastInst, InterestingFact);
+  ASSERT_FALSE(Expected.empty());
+  EXPECT_EQ(Expected, SpilledPSM.pathsTo(LastInst, InterestingFact));
+}
+
+TEST_F(PathTracingTest, Handle_Intra_08_ReopenedAndRespilledESG) {
+  IRDB = std::make_unique<psr::LLVMProjectIRDB>(PathToLlFiles +
+                                                "intra_08_cpp.ll");
+  psr::LLVMTypeHierarchy TH(*IRDB);
+  psr::LLVMAliasSet PT(IRDB.get());
+  psr::LLVMBasedICFG ICFG(IRDB.get(), psr::CallGraphAnalysisType::OTF,
+                          {"main"}, &TH, &PT, psr::Soundness::Soundy,
+                          /*IncludeGlobals*/ false);
+  psr::IDELinearConstantAnalysis LCAProblem(IRDB.get(), &ICFG, {"main"});
+  psr::PathAwareIDESolver LCASolver(LCAProblem, &ICFG);
+  LCASolver.solve();
+
+  auto [LastInst, InterestingFact] = getInterestingInstFact();
+  const auto *Main = IRDB->getFunctionDefinition("main");
+  const auto *First = &Main->front().front();
+  // Never a fact of the LCA, so the new edge cannot change any path
+  const llvm::Value *UnrelatedFact = Main;
+
+  const auto &InMemoryESG = LCASolver.getExplicitESG();
+  psr::Z3BasedPathSensitivityManager<psr::IDELinearConstantAnalysisDomain>
+      InMemoryPSM(&InMemoryESG, {}, &LPC);
+  auto Expected = InMemoryPSM.pathsTo(LastInst, InterestingFact);
+  ASSERT_FALSE(Expected.empty());
+
+  llvm::SmallString<128> SpillFile;
+  ASSERT_FALSE(
+      llvm::sys::fs::createTemporaryFile("intra_08-esg", "bin", SpillFile));
+  psr::scope_exit RemoveSpillFile = [&SpillFile] {
+    llvm::sys::fs::remove(SpillFile);
+  };
+
+  // finalize -> reopen -> saveEdges -> spill
+  psr::ExplodedSuperGraph ESG(InMemoryESG);
+  ESG.finalize();
+  ASSERT_TRUE(ESG.isFinalized());
+  ESG.saveEdges(First, ESG.getZeroValue(), First->getNextNode(),
+                std::array{UnrelatedFact}, psr::ESGEdgeKind::Normal);
+  EXPECT_FALSE(ESG.isFinalized());
+  EXPECT_EQ(InMemoryESG.size() + 1, ESG.size());
+  ASSERT_FALSE(ESG.spillTo(SpillFile));
+  ASSERT_TRUE(ESG.isSpilled());
+  EXPECT_EQ(InMemoryESG.size() + 1, ESG.size());
+  EXPECT_TRUE(ESG.getNodeOrNull(First->getNextNode(), UnrelatedFact));
+
+  psr::Z3BasedPathSensitivityManager<psr::IDELinearConstantAnalysisDomain> PSM(
+      &ESG, {}, &LPC);
+  EXPECT_EQ(Expected, PSM.pathsTo(LastInst, InterestingFact));
+
+  // Spilling again to the same file must not pull the mapped data from under
+  // the ESG or any copy of it
+  psr::ExplodedSuperGraph SpilledCopy(ESG);
+  ASSERT_TRUE(SpilledCopy.isSpilled());
+  ASSERT_FALSE(ESG.spillTo(SpillFile));
+  EXPECT_EQ(Expected, PSM.pathsTo(LastInst, InterestingFact));
+
+  // spill -> reopen -> saveEdges -> spill
+  ESG.saveEdges(First->getNextNode(), UnrelatedFact,
+                First->getNextNode()->getNextNode(), std::array{UnrelatedFact},
+                psr::ESGEdgeKind::Normal);
+  EXPECT_FALSE(ESG.isSpilled());
+  ASSERT_FALSE(ESG.spillTo(SpillFile));
+  EXPECT_EQ(InMemoryESG.size() + 2, ESG.size());
+  EXPECT_EQ(Expected, PSM.pathsTo(LastInst, InterestingFact));
+
+  EXPECT_EQ(InMemoryESG.size() + 1, SpilledCopy.size());
+  psr::Z3BasedPathSensitivityManager<psr::IDELinearConstantAnalysisDomain>
+      CopyPSM(&SpilledCopy, {}, &LPC);
+  EXPECT_EQ(Expected, CopyPSM.pathsTo(LastInst, InterestingFact));
+}
+
 TEST_F(PathTracingTest, Handle_Other_01) {
   auto PathsVec = doAnalysis("other_01_cpp.ll");
   comparePaths(PathsVec, {{0, 1, 6, 7, 8, 9, 10, 12, 13}});
@@ -766,6 +962,75 @@ TEST(PathsDAGTest, ForwardMinimizeDAGTest) {
             0);
 }
 
+/// Exposes the path generator to test it on hand-crafted DAGs
+struct PathGeneratorTester : psr::Z3BasedPathSensitivityManagerBase {
+  using Z3BasedPathSensitivityManagerBase::getLeaf;
+  using Z3BasedPathSensitivityManagerBase::makePathGenerator;
+};
+
+TEST(PathsDAGTest, GeneratorYieldsEachInstructionSequenceOnce) {
+  psr::LLVMProjectIRDB IRDB(PathTracingTest::PathToLlFiles + "intra_08_cpp.ll");
+  const auto *Main = IRDB.getFunctionDefinition("main");
+  ASSERT_NE(nullptr, Main);
+  llvm::SmallVector<const llvm::Instruction *> I;
+  for (const auto &Inst : Main->getEntryBlock()) {
+    if (!llvm::isa<llvm::AllocaInst>(Inst)) {
+      break;
+    }
+    I.push_back(&Inst);
+  }
+  ASSERT_GE(I.size(), 4U);
+
+  using graph_type = PathGeneratorTester::graph_type;
+  using traits_t = psr::GraphTraits<graph_type>;
+  using node_t = typename traits_t::value_type;
+
+  // The nodes of a reverse DAG hold their instructions in reverse order.
+  // Root->A->Leaf and Root->B->Leaf, as well as Root->A->D->Leaf and
+  // Root->C->Leaf are different vertex-paths with the same instructions, as
+  // they occur for different data-flow facts.
+  graph_type Dag;
+  auto Root = traits_t::addNode(Dag, node_t{I[3]});
+  auto A = traits_t::addNode(Dag, node_t{I[2]});
+  auto B = traits_t::addNode(Dag, node_t{I[2]});
+  auto C = traits_t::addNode(Dag, node_t{I[1], I[2]});
+  auto D = traits_t::addNode(Dag, node_t{I[1]});
+  auto Leaf = traits_t::addNode(Dag, node_t{I[0]});
+  traits_t::addRoot(Dag, Root);
+  traits_t::addEdge(Dag, Root, A);
+  traits_t::addEdge(Dag, Root, B);
+  traits_t::addEdge(Dag, Root, C);
+  traits_t::addEdge(Dag, A, D);
+  traits_t::addEdge(Dag, A, Leaf);
+  traits_t::addEdge(Dag, B, Leaf);
+  traits_t::addEdge(Dag, C, Leaf);
+  traits_t::addEdge(Dag, D, Leaf);
+  ASSERT_EQ(Leaf, PathGeneratorTester::getLeaf(Dag));
+
+  using PathTy = std::vector<const llvm::Instruction *>;
+  std::vector<PathTy> Expected = {{I[3], I[2], I[0]},
+                                  {I[3], I[2], I[1], I[0]}};
+
+  psr::LLVMPathConstraints LPC;
+  for (auto Order :
+       {psr::FlowPathOrder::DepthFirst, psr::FlowPathOrder::BestFirst,
+        psr::FlowPathOrder::ShortestFirst}) {
+    auto Gen = PathGeneratorTester::makePathGenerator(
+        Dag, Leaf, I[0], psr::Z3BasedPathSensitivityConfig{}, LPC, Order);
+    std::vector<PathTy> Paths;
+    while (auto Path = Gen.next()) {
+      Paths.emplace_back(Path->begin(), Path->end());
+    }
+
+    std::sort(Paths.begin(), Paths.end(),
+              [](const PathTy &LHS, const PathTy &RHS) {
+                return LHS.size() < RHS.size();
+              });
+    EXPECT_EQ(Expected, Paths);
+    EXPECT_EQ(Expected.size(), Gen.getNumPathsYielded());
+  }
+}
+
 template <typename GraphTy>
 std::vector<std::vector<std::string>> getPaths(const GraphTy &G) {
   std::vector<std::vector<std::string>> Ret;
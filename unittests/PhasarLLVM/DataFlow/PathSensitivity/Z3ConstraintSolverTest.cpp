@@ -0,0 +1,86 @@
+#include "phasar/PhasarLLVM/DataFlow/PathSensitivity/Z3ConstraintSolver.h"
+
+#include "gtest/gtest.h"
+
+#include "z3++.h"
+
+namespace {
+
+using namespace psr;
+
+TEST(Z3ConstraintSolverTest, CachesResultsIndependentOfOrder) {
+  z3::context Ctx;
+  Z3ConstraintSolver Solver(Ctx);
+
+  auto X = Ctx.int_const("x");
+  auto Y = Ctx.int_const("y");
+
+  EXPECT_EQ(z3::sat, Solver.check({X > 0, Y > X}));
+  EXPECT_EQ(1U, Solver.getStats().NumSolverCalls);
+
+  // Same conjunction, different order and nesting
+  EXPECT_EQ(z3::sat, Solver.check({Y > X && X > 0}));
+  EXPECT_EQ(z3::sat, Solver.check({Y > X, X > 0, X > 0}));
+  EXPECT_EQ(1U, Solver.getStats().NumSolverCalls);
+  EXPECT_EQ(2U, Solver.getStats().NumCacheHits);
+  EXPECT_EQ(3U, Solver.getStats().NumQueries);
+}
+
+TEST(Z3ConstraintSolverTest, ReusesUnsatCores) {
+  z3::context Ctx;
+  Z3ConstraintSolver Solver(Ctx);
+
+  auto X = Ctx.int_const("x");
+  auto Y = Ctx.int_const("y");
+  auto Z = Ctx.int_const("z");
+
+  EXPECT_EQ(z3::unsat, Solver.check({X > 0, X < 0, Y > 0}));
+  EXPECT_EQ(1U, Solver.getStats().NumSolverCalls);
+  EXPECT_EQ(1U, Solver.getNumUnsatCores());
+
+  // Contains the core {x > 0, x < 0}
+  EXPECT_EQ(z3::unsat, Solver.check({Z == Y, X < 0, X > 0}));
+  EXPECT_EQ(1U, Solver.getStats().NumSolverCalls);
+  EXPECT_EQ(1U, Solver.getStats().NumUnsatCoreHits);
+
+  // Does not contain the core; the assumptions of the previous queries must
+  // not leak into this one
+  EXPECT_EQ(z3::sat, Solver.check({X < 0, Y > 0}));
+  EXPECT_EQ(2U, Solver.getStats().NumSolverCalls);
+
+  EXPECT_EQ(z3::unsat, Solver.check({Ctx.bool_val(false), Y > 0}));
+  EXPECT_EQ(2U, Solver.getStats().NumSolverCalls);
+}
+
+TEST(Z3ConstraintSolverTest, ModelSatisfiesQuery) {
+  z3::context Ctx;
+  Z3ConstraintSolver Solver(Ctx);
+
+  auto X = Ctx.int_const("x");
+  auto Y = Ctx.int_const("y");
+
+  ASSERT_EQ(z3::sat, Solver.check({X > 41, Y == X + 1}));
+  ASSERT_EQ(z3::sat, Solver.check({X < 41}));
+
+  auto Model = Solver.getModel({X > 41, Y == X + 1});
+  EXPECT_TRUE(Model.eval(X > 41 && Y == X + 1).is_true());
+  // Only x and y; no internal tracking literals
+  EXPECT_EQ(2U, Model.num_consts());
+
+  auto NumCalls = Solver.getStats().NumSolverCalls;
+  auto Model2 = Solver.getModel({X < 41});
+  EXPECT_TRUE(Model2.eval(X < 41).is_true());
+  // Solved again, since the solver has moved on in between
+  EXPECT_EQ(NumCalls + 1, Solver.getStats().NumSolverCalls);
+
+  // Now cached
+  std::ignore = Solver.getModel({X < 41});
+  EXPECT_EQ(NumCalls + 1, Solver.getStats().NumSolverCalls);
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -7,9 +7,20 @@
 #include "phasar/PhasarLLVM/Pointer/LLVMPointsToUtils.h"
 #include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
 
+#include "llvm/IR/Constants.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Type.h"
+#include "llvm/Support/raw_ostream.h"
+
 #include "TestConfig.h"
 #include "gtest/gtest.h"
 
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
 using namespace psr;
 
 TEST(LLVMAliasSet, Intra_01) {
@@ -64,6 +75,98 @@ TEST(LLVMAliasSet, Global_01) {
   llvm::outs() << '\n';
 }
 
+TEST(LLVMAliasSet, ConcurrentQueriesWhenFrozen) {
+  // This is what phasar-cli --jobs N does to share the alias sets between
+  // concurrently running analyses
+  ValueAnnotationPass::resetValueID();
+  LLVMProjectIRDB IRDB(unittest::PathToLLTestFiles +
+                       "pointers/global_01_cpp.ll");
+  LLVMAliasSet PTS(&IRDB);
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::OTF, {"main"}, &TH, &PTS);
+  PTS.computeAllAliasSets(IRDB);
+  ASSERT_TRUE(PTS.isFrozen());
+
+  std::vector<const llvm::Value *> Values;
+  for (const auto &G : IRDB.getModule()->globals()) {
+    Values.push_back(&G);
+  }
+  for (const auto &F : *IRDB.getModule()) {
+    Values.push_back(&F);
+    for (const auto &Arg : F.args()) {
+      Values.push_back(&Arg);
+    }
+    for (const auto &I : llvm::instructions(F)) {
+      Values.push_back(&I);
+      for (const auto &Op : I.operands()) {
+        if (llvm::isa<llvm::ConstantExpr>(Op)) {
+          Values.push_back(Op);
+        }
+      }
+    }
+  }
+  // A pointer that is not part of the module when freezing
+  auto *G = IRDB.getModule()->getGlobalVariable("g");
+  ASSERT_NE(nullptr, G);
+  const auto *NewCast = llvm::ConstantExpr::getBitCast(
+      G, llvm::Type::getInt16PtrTy(IRDB.getModule()->getContext()));
+  Values.push_back(NewCast);
+
+  using ResultTy = std::vector<std::tuple<std::set<const llvm::Value *>,
+                                          std::set<const llvm::Value *>,
+                                          std::vector<AliasResult>>>;
+  auto Query = [&PTS, &Values] {
+    ResultTy Ret;
+    for (const auto *V : Values) {
+      auto AS = PTS.getAliasSet(V);
+      auto AllocSites = PTS.getReachableAllocationSites(V);
+      std::vector<AliasResult> Aliases;
+      for (const auto *W : Values) {
+        Aliases.push_back(PTS.alias(V, W));
+        std::ignore = PTS.isInReachableAllocationSites(V, W);
+      }
+      Ret.emplace_back(std::set<const llvm::Value *>(AS->begin(), AS->end()),
+                       std::set<const llvm::Value *>(AllocSites->begin(),
+                                                     AllocSites->end()),
+                       std::move(Aliases));
+    }
+    return Ret;
+  };
+
+  auto AsJson = [&PTS] {
+    std::string Ret;
+    llvm::raw_string_ostream OS(Ret);
+    PTS.printAsJson(OS);
+    return Ret;
+  };
+
+  auto FrozenJson = AsJson();
+  auto Expected = Query();
+  EXPECT_EQ(AliasResult::MayAlias, PTS.alias(NewCast, NewCast));
+  EXPECT_EQ(AliasResult::NoAlias, PTS.alias(NewCast, G));
+  // Consistently, its alias set only contains itself
+  auto NewCastAS = PTS.getAliasSet(NewCast);
+  EXPECT_EQ(
+      std::set<const llvm::Value *>{NewCast},
+      std::set<const llvm::Value *>(NewCastAS->begin(), NewCastAS->end()));
+
+  static constexpr size_t NumThreads = 4;
+  std::vector<ResultTy> Results(NumThreads);
+  std::vector<std::thread> Threads;
+  for (size_t I = 0; I != NumThreads; ++I) {
+    Threads.emplace_back([&Query, &Result = Results[I]] { Result = Query(); });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  for (const auto &Result : Results) {
+    EXPECT_EQ(Expected, Result);
+  }
+  // Querying a frozen alias set never modifies it
+  EXPECT_EQ(FrozenJson, AsJson());
+}
+
 int main(int Argc, char **Argv) {
   ::testing::InitGoogleTest(&Argc, Argv);
   return RUN_ALL_TESTS();
@@ -1426,6 +1426,40 @@ TEST(DBTHTest, TransitivelyReachableTypes_21) {
   EXPECT_TRUE(ReachableTypesChild2.count(Child2Type));
 }
 
+TEST(DBTHTest, IsSubTypeMultipleInheritance) {
+  LLVMProjectIRDB IRDB(unittest::PathToLLTestFiles +
+                       "type_hierarchies/type_hierarchy_7_cpp_dbg.ll");
+  DIBasedTypeHierarchy DBTH(IRDB);
+
+  const auto *AType = DBTH.getType("_ZTS1A");
+  const auto *CType = DBTH.getType("_ZTS1C");
+  const auto *DType = DBTH.getType("_ZTS1D");
+  const auto *XType = DBTH.getType("_ZTS1X");
+  const auto *ZType = DBTH.getType("_ZTS1Z");
+  ASSERT_NE(nullptr, AType);
+  ASSERT_NE(nullptr, CType);
+  ASSERT_NE(nullptr, DType);
+  ASSERT_NE(nullptr, XType);
+  ASSERT_NE(nullptr, ZType);
+
+  // struct Z : C, Y {};
+  EXPECT_TRUE(DBTH.isSubType(AType, ZType));
+  EXPECT_TRUE(DBTH.isSubType(CType, ZType));
+  EXPECT_TRUE(DBTH.isSubType(XType, ZType));
+  EXPECT_TRUE(DBTH.isSubType(ZType, ZType));
+  EXPECT_FALSE(DBTH.isSubType(ZType, AType));
+  EXPECT_FALSE(DBTH.isSubType(XType, DType));
+
+  for (const auto *Ty : DBTH.getAllTypes()) {
+    const auto &SubTypes = DBTH.getSubTypes(Ty);
+    for (const auto *SubTy : DBTH.getAllTypes()) {
+      EXPECT_EQ(SubTypes.count(SubTy) != 0, DBTH.isSubType(Ty, SubTy))
+          << "For " << DBTH.getTypeName(Ty).str() << " and "
+          << DBTH.getTypeName(SubTy).str();
+    }
+  }
+}
+
 } // namespace psr
 
 int main(int Argc, char **Argv) {
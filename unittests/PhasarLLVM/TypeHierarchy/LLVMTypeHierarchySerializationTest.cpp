@@ -13,6 +13,10 @@
 #include "TestConfig.h"
 #include "gtest/gtest.h"
 
+#include <map>
+#include <set>
+#include <string>
+
 using namespace psr;
 
 /* ============== TEST FIXTURE ============== */
@@ -65,6 +69,48 @@ TEST_P(LLVMTypeHierarchySerialization, OrigAndDeserEqual) {
   compareResults(TypeHierarchy, DeserializedTypeHierarchy);
 }
 
+TEST(LLVMTypeHierarchySerializationTest, DeserializedSubTypes) {
+  psr::LLVMProjectIRDB IRDB(PHASAR_BUILD_SUBFOLDER("type_hierarchies/") +
+                            "type_hierarchy_7_cpp_dbg.ll");
+  ASSERT_TRUE(IRDB.isValid());
+
+  std::string Ser;
+  llvm::raw_string_ostream StringStream(Ser);
+  psr::LLVMTypeHierarchy(IRDB).printAsJson(StringStream);
+
+  psr::LLVMTypeHierarchy Deser(IRDB,
+                               psr::LLVMTypeHierarchyData::loadJsonString(Ser));
+
+  // B : A, D : B, C : A, Y : X, Z : C, Y
+  const std::map<std::string, std::set<std::string>> ExpectedSubTypes = {
+      {"struct.A",
+       {"struct.A", "struct.B", "struct.C", "struct.D", "struct.Z"}},
+      {"struct.B", {"struct.B", "struct.D"}},
+      {"struct.C", {"struct.C", "struct.Z"}},
+      {"struct.D", {"struct.D"}},
+      {"struct.X", {"struct.X", "struct.Y", "struct.Z"}},
+      {"struct.Y", {"struct.Y", "struct.Z"}},
+      {"struct.Z", {"struct.Z"}},
+  };
+
+  for (const auto &[TypeName, Expected] : ExpectedSubTypes) {
+    const auto *Type = Deser.getType(TypeName);
+    ASSERT_NE(nullptr, Type) << TypeName;
+
+    std::set<std::string> SubTypeNames;
+    for (const auto *SubType : Deser.subTypesOf(Type)) {
+      SubTypeNames.insert(SubType->getName().str());
+    }
+    EXPECT_EQ(Expected, SubTypeNames) << "For " << TypeName;
+
+    for (const auto &[OtherName, Unused] : ExpectedSubTypes) {
+      EXPECT_EQ(Expected.count(OtherName) != 0,
+                Deser.isSubType(Type, Deser.getType(OtherName)))
+          << "For " << TypeName << " and " << OtherName;
+    }
+  }
+}
+
 static constexpr std::string_view TypeHierarchyTestFiles[] = {
     "type_hierarchy_1_cpp_dbg.ll",    "type_hierarchy_2_cpp_dbg.ll",
     "type_hierarchy_3_cpp_dbg.ll",    "type_hierarchy_4_cpp_dbg.ll",
@@ -281,6 +281,36 @@ TEST(LTHTest, TransitivelyReachableTypes) {
   ASSERT_TRUE(ReachableTypesChild5.size() == 1U);
 }
 
+TEST(LTHTest, IsSubTypeMultipleInheritance) {
+  LLVMProjectIRDB IRDB({unittest::PathToLLTestFiles +
+                        "type_hierarchies/type_hierarchy_7_cpp.ll"});
+  LLVMTypeHierarchy TH(IRDB);
+
+  const auto *AType = TH.getType("struct.A");
+  const auto *CType = TH.getType("struct.C");
+  const auto *DType = TH.getType("struct.D");
+  const auto *XType = TH.getType("struct.X");
+  const auto *ZType = TH.getType("struct.Z");
+
+  EXPECT_TRUE(TH.isSubType(AType, ZType));
+  EXPECT_TRUE(TH.isSubType(CType, ZType));
+  EXPECT_TRUE(TH.isSubType(XType, ZType));
+  EXPECT_TRUE(TH.isSubType(ZType, ZType));
+  EXPECT_FALSE(TH.isSubType(ZType, AType));
+  EXPECT_FALSE(TH.isSubType(XType, DType));
+  EXPECT_EQ(TH.subTypesOf(AType).size(), 5U);
+
+  for (const auto *Ty : TH.getAllTypes()) {
+    auto SubTypes = TH.getSubTypes(Ty);
+    EXPECT_EQ(SubTypes.size(), TH.subTypesOf(Ty).size());
+    for (const auto *SubTy : TH.getAllTypes()) {
+      EXPECT_EQ(SubTypes.count(SubTy) != 0, TH.isSubType(Ty, SubTy))
+          << "For " << TH.getTypeName(Ty).str() << " and "
+          << TH.getTypeName(SubTy).str();
+    }
+  }
+}
+
 // TEST(LTHTest, HandleLoadAndPrintOfNonEmptyGraph) {
 //   LLVMProjectIRDB IRDB(
 //       {pathToLLFiles + "type_hierarchies/type_hierarchy_1_cpp.ll"});
@@ -0,0 +1,97 @@
+#include "phasar/PhasarLLVM/Utils/LLVMIRDiff.h"
+
+#include "phasar/AnalysisStrategy/IncrementalUpdateAnalysis.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+
+#include "llvm/IR/Module.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace psr;
+
+constexpr auto PathToLLFiles = PHASAR_BUILD_SUBFOLDER("incremental/");
+
+TEST(LLVMIRDiffTest, HashIgnoresLocalNames) {
+  LLVMProjectIRDB Base(PathToLLFiles + "ir_diff_base_c.ll");
+  LLVMProjectIRDB Renamed(PathToLLFiles + "ir_diff_renamed_c.ll");
+  LLVMProjectIRDB Modified(PathToLLFiles + "ir_diff_changed_c.ll");
+  ASSERT_TRUE(Base.isValid() && Renamed.isValid() && Modified.isValid());
+
+  auto BaseHash = computeFunctionHash(*Base.getFunctionDefinition("inc"));
+  EXPECT_EQ(BaseHash,
+            computeFunctionHash(*Renamed.getFunctionDefinition("inc")));
+  EXPECT_NE(BaseHash,
+            computeFunctionHash(*Modified.getFunctionDefinition("inc")));
+}
+
+TEST(LLVMIRDiffTest, DiffModules) {
+  LLVMProjectIRDB Base(PathToLLFiles + "ir_diff_base_c.ll");
+  LLVMProjectIRDB Current(PathToLLFiles + "ir_diff_changed_c.ll");
+  ASSERT_TRUE(Base.isValid() && Current.isValid());
+
+  IncrementalUpdateAnalysis IUA(computeModuleFingerprint(*Base.getModule()),
+                                computeModuleFingerprint(*Current.getModule()));
+  const auto &Diff = IUA.getDiff();
+
+  EXPECT_EQ(std::vector<std::string>{"dec"}, Diff.Added);
+  EXPECT_EQ(std::vector<std::string>{"store"}, Diff.Removed);
+  EXPECT_EQ(std::vector<std::string>{"inc"}, Diff.Changed);
+  EXPECT_FALSE(Diff.GlobalsChanged);
+
+  EXPECT_TRUE(IUA.isUnchanged("twice"));
+  EXPECT_FALSE(IUA.isUnchanged("inc"));
+  EXPECT_FALSE(IUA.isUnchanged("dec"));
+  EXPECT_EQ(1U, IUA.getNumUnchanged());
+}
+
+TEST(LLVMIRDiffTest, GlobalsChanged) {
+  LLVMProjectIRDB Base(PathToLLFiles + "ir_diff_base_c.ll");
+  LLVMProjectIRDB Current(PathToLLFiles + "ir_diff_globals_c.ll");
+  ASSERT_TRUE(Base.isValid() && Current.isValid());
+
+  auto Diff =
+      ModuleDiff::compute(computeModuleFingerprint(*Base.getModule()),
+                          computeModuleFingerprint(*Current.getModule()));
+  EXPECT_TRUE(Diff.functionsUnchanged());
+  EXPECT_TRUE(Diff.GlobalsChanged);
+}
+
+TEST(LLVMIRDiffTest, StableValueIdsRoundTrip) {
+  LLVMProjectIRDB IRDB(PathToLLFiles + "ir_diff_base_c.ll");
+  ASSERT_TRUE(IRDB.isValid());
+  const auto *Mod = IRDB.getModule();
+
+  LLVMStableValueIds Ids(*Mod);
+  const auto *Twice = Mod->getFunction("twice");
+
+  EXPECT_EQ("twice#a0", Ids.getId(Twice->getArg(0)));
+  EXPECT_EQ("twice#1", Ids.getId(&*std::next(Twice->getEntryBlock().begin())));
+  EXPECT_EQ("@g", Ids.getId(Mod->getNamedValue("g")));
+
+  for (const auto &F : *Mod) {
+    for (const auto &Arg : F.args()) {
+      EXPECT_EQ(&Arg, Ids.getValue(Ids.getId(&Arg)));
+    }
+    for (const auto &BB : F) {
+      for (const auto &I : BB) {
+        EXPECT_EQ(&I, Ids.getValue(Ids.getId(&I)));
+      }
+    }
+  }
+
+  EXPECT_EQ(nullptr, Ids.getValue("twice#42"));
+  EXPECT_EQ(nullptr, Ids.getValue("unknown#0"));
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,294 @@
+#include "phasar/PhasarLLVM/LLVMIncrementalUpdate.h"
+
+#include "phasar/ControlFlow/CallGraphAnalysisType.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/ControlFlow/LLVMVFTableProvider.h"
+#include "phasar/PhasarLLVM/ControlFlow/Resolver/IncrementalResolver.h"
+#include "phasar/PhasarLLVM/ControlFlow/Resolver/Resolver.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/TypeHierarchy/LLVMTypeHierarchy.h"
+#include "phasar/Pointer/AliasAnalysisType.h"
+#include "phasar/Utils/Utilities.h"
+
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace psr;
+
+constexpr auto PathToLLFiles = PHASAR_BUILD_SUBFOLDER("incremental/");
+
+// The mangled names of the functions in incremental_01.cpp
+constexpr llvm::StringLiteral Measure = "_Z7measureRK5Shape";
+constexpr llvm::StringLiteral Apply = "_Z5applyPFiiEi";
+constexpr llvm::StringLiteral Inc = "_Z3inci";
+
+LLVMIncrementalSnapshot takeSnapshot(LLVMProjectIRDB &IRDB,
+                                     CallGraphAnalysisType CGTy,
+                                     AliasAnalysisType PATy) {
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMAliasSet PT(&IRDB, /*UseLazyEvaluation*/ false, PATy);
+  LLVMBasedICFG ICF(&IRDB, CGTy, {"main"}, &TH, &PT);
+  return LLVMIncrementalSnapshot::create(IRDB, &PT, &ICF, CGTy);
+}
+
+const llvm::CallBase *getIndirectCallIn(const LLVMProjectIRDB &IRDB,
+                                        llvm::StringRef FunName) {
+  const auto *Fun = IRDB.getFunctionDefinition(FunName);
+  if (!Fun) {
+    return nullptr;
+  }
+  for (const auto &Inst : llvm::instructions(Fun)) {
+    if (const auto *CallSite = llvm::dyn_cast<llvm::CallBase>(&Inst);
+        CallSite && CallSite->isIndirectCall()) {
+      return CallSite;
+    }
+  }
+  return nullptr;
+}
+
+std::set<std::string> getCallees(const LLVMBasedICFG &ICF,
+                                 const llvm::CallBase *CallSite) {
+  std::set<std::string> Ret;
+  for (const auto *Callee : ICF.getCalleesOfCallAt(CallSite)) {
+    Ret.insert(Callee->getName().str());
+  }
+  return Ret;
+}
+
+void expectSameSnapshot(const LLVMIncrementalSnapshot &Expected,
+                        const LLVMIncrementalSnapshot &Actual) {
+  auto ToMap = [](const ModuleFingerprint &FP) {
+    std::map<std::string, uint64_t> Ret;
+    for (const auto &Entry : FP.FunctionHashes) {
+      Ret.emplace(Entry.getKey().str(), Entry.second);
+    }
+    return Ret;
+  };
+
+  EXPECT_EQ(ToMap(Expected.Fingerprint), ToMap(Actual.Fingerprint));
+  EXPECT_EQ(Expected.Fingerprint.GlobalsHash, Actual.Fingerprint.GlobalsHash);
+  EXPECT_EQ(Expected.AliasSets, Actual.AliasSets);
+  EXPECT_EQ(Expected.AnalyzedFunctions, Actual.AnalyzedFunctions);
+  EXPECT_EQ(Expected.PATy, Actual.PATy);
+  EXPECT_EQ(Expected.IndirectCallTargets, Actual.IndirectCallTargets);
+  EXPECT_EQ(Expected.CGTy, Actual.CGTy);
+}
+
+TEST(LLVMIncrementalUpdateTest, SnapshotJsonRoundTrip) {
+  LLVMProjectIRDB IRDB(PathToLLFiles + "incremental_01_cpp.ll");
+  ASSERT_TRUE(IRDB.isValid());
+
+  auto Snapshot = takeSnapshot(IRDB, CallGraphAnalysisType::CHA,
+                               AliasAnalysisType::CFLAnders);
+  EXPECT_EQ(CallGraphAnalysisType::CHA, Snapshot.CGTy);
+  EXPECT_EQ(AliasAnalysisType::CFLAnders, Snapshot.PATy);
+  EXPECT_FALSE(Snapshot.AliasSets.empty());
+  EXPECT_TRUE(llvm::is_contained(Snapshot.AnalyzedFunctions, "main"));
+
+  // The virtual call in measure() and the function-pointer call in apply()
+  ASSERT_EQ(2U, Snapshot.IndirectCallTargets.size());
+  const auto *VirtualCall = getIndirectCallIn(IRDB, Measure);
+  ASSERT_NE(nullptr, VirtualCall);
+  auto VirtualTargets =
+      Snapshot.IndirectCallTargets[LLVMStableValueIds(*IRDB.getModule())
+                                       .getId(VirtualCall)];
+  llvm::sort(VirtualTargets);
+  EXPECT_EQ((std::vector<std::string>{"_ZNK5Shape4areaEv",
+                                      "_ZNK6Square4areaEv"}),
+            VirtualTargets);
+
+  std::string Json;
+  llvm::raw_string_ostream OS(Json);
+  Snapshot.printAsJson(OS);
+  OS.flush();
+  expectSameSnapshot(Snapshot, LLVMIncrementalSnapshot::loadJsonString(Json));
+
+  llvm::SmallString<128> SnapshotFile;
+  ASSERT_FALSE(llvm::sys::fs::createTemporaryFile("incremental_01", "json",
+                                                  SnapshotFile));
+  scope_exit RemoveSnapshotFile = [&SnapshotFile] {
+    llvm::sys::fs::remove(SnapshotFile);
+  };
+  {
+    std::error_code EC;
+    llvm::raw_fd_ostream FOS(SnapshotFile, EC);
+    ASSERT_FALSE(EC) << EC.message();
+    Snapshot.printAsJson(FOS);
+  }
+  expectSameSnapshot(Snapshot,
+                     LLVMIncrementalSnapshot::deserializeJson(SnapshotFile));
+}
+
+TEST(LLVMIncrementalUpdateTest, ReusableAliasSets) {
+  LLVMProjectIRDB BaseIRDB(PathToLLFiles + "incremental_01_cpp.ll");
+  LLVMProjectIRDB IRDB(PathToLLFiles + "incremental_01_changed_cpp.ll");
+  ASSERT_TRUE(BaseIRDB.isValid());
+  ASSERT_TRUE(IRDB.isValid());
+
+  auto Snapshot = takeSnapshot(BaseIRDB, CallGraphAnalysisType::CHA,
+                               AliasAnalysisType::CFLAnders);
+  LLVMIncrementalUpdateAnalysis IUA(Snapshot, IRDB);
+  EXPECT_EQ(std::vector<std::string>{Inc.str()}, IUA.getDiff().Changed);
+  EXPECT_FALSE(IUA.getDiff().GlobalsChanged);
+
+  auto Reusable = IUA.getReusableAliasSets(AliasAnalysisType::CFLAnders);
+  auto Fns = Reusable.at("AnalyzedFunctions").get<std::vector<std::string>>();
+  EXPECT_TRUE(llvm::is_contained(Fns, "main"));
+  EXPECT_FALSE(llvm::is_contained(Fns, Inc));
+
+  // No value of the changed function is reused
+  const auto *IncFun = IRDB.getFunctionDefinition(Inc);
+  ASSERT_NE(nullptr, IncFun);
+  ASSERT_FALSE(Reusable.at("AliasSets").empty());
+  for (const auto &Set : Reusable.at("AliasSets")) {
+    for (const auto &Id : Set) {
+      const auto *Val = fromMetaDataId(IRDB, Id.get<std::string>());
+      ASSERT_NE(nullptr, Val);
+      if (const auto *Inst = llvm::dyn_cast<llvm::Instruction>(Val)) {
+        EXPECT_NE(IncFun, Inst->getFunction());
+      } else if (const auto *Arg = llvm::dyn_cast<llvm::Argument>(Val)) {
+        EXPECT_NE(IncFun, Arg->getParent());
+      }
+    }
+  }
+
+  // The changed function is analyzed on demand
+  LLVMAliasSet PT(&IRDB, Reusable, AliasAnalysisType::CFLAnders);
+  const auto *IncAlloca = &IncFun->getEntryBlock().front();
+  ASSERT_TRUE(llvm::isa<llvm::AllocaInst>(IncAlloca));
+  EXPECT_TRUE(PT.getAliasSet(IncAlloca)->count(IncAlloca));
+
+  // Alias sets computed by another alias analysis are not reused
+  auto Other = IUA.getReusableAliasSets(AliasAnalysisType::Basic);
+  EXPECT_TRUE(Other.at("AliasSets").empty());
+  EXPECT_TRUE(Other.at("AnalyzedFunctions").empty());
+}
+
+TEST(LLVMIncrementalUpdateTest, ReusableCallTargets) {
+  LLVMProjectIRDB BaseIRDB(PathToLLFiles + "incremental_01_cpp.ll");
+  LLVMProjectIRDB IRDB(PathToLLFiles + "incremental_01_changed_cpp.ll");
+  ASSERT_TRUE(BaseIRDB.isValid());
+  ASSERT_TRUE(IRDB.isValid());
+  LLVMVFTableProvider BaseVTP(BaseIRDB);
+  LLVMVFTableProvider VTP(IRDB);
+
+  auto Snapshot = takeSnapshot(BaseIRDB, CallGraphAnalysisType::CHA,
+                               AliasAnalysisType::CFLAnders);
+
+  // Only the virtual call is reused, as the function-pointer call depends on
+  // other functions' bodies
+  LLVMIncrementalUpdateAnalysis IUA(Snapshot, IRDB);
+  auto Targets = IUA.getReusableCallTargets(
+      CallGraphAnalysisType::CHA, AliasAnalysisType::CFLAnders, VTP);
+  const auto *VirtualCall = getIndirectCallIn(IRDB, Measure);
+  ASSERT_NE(nullptr, VirtualCall);
+  ASSERT_EQ(1U, Targets.size());
+  ASSERT_EQ(1U, Targets.count(VirtualCall));
+  EXPECT_EQ(2U, Targets[VirtualCall].size());
+
+  // Another call-graph analysis resolves differently
+  EXPECT_TRUE(IUA.getReusableCallTargets(CallGraphAnalysisType::OTF,
+                                         AliasAnalysisType::CFLAnders, VTP)
+                  .empty());
+
+  // If nothing changed, all targets are reused
+  LLVMIncrementalUpdateAnalysis Unchanged(Snapshot, BaseIRDB);
+  EXPECT_EQ(2U, Unchanged
+                    .getReusableCallTargets(CallGraphAnalysisType::CHA,
+                                            AliasAnalysisType::Basic, BaseVTP)
+                    .size());
+
+  // ... unless they were resolved based on another alias analysis
+  LLVMProjectIRDB OTFIRDB(PathToLLFiles + "incremental_01_cpp.ll");
+  ASSERT_TRUE(OTFIRDB.isValid());
+  LLVMVFTableProvider OTFVTP(OTFIRDB);
+  auto OTFSnapshot = takeSnapshot(OTFIRDB, CallGraphAnalysisType::OTF,
+                                  AliasAnalysisType::CFLAnders);
+  LLVMIncrementalUpdateAnalysis OTFUnchanged(OTFSnapshot, OTFIRDB);
+  EXPECT_EQ(2U, OTFUnchanged
+                    .getReusableCallTargets(CallGraphAnalysisType::OTF,
+                                            AliasAnalysisType::CFLAnders,
+                                            OTFVTP)
+                    .size());
+  EXPECT_TRUE(OTFUnchanged
+                  .getReusableCallTargets(CallGraphAnalysisType::OTF,
+                                          AliasAnalysisType::Basic, OTFVTP)
+                  .empty());
+}
+
+TEST(LLVMIncrementalUpdateTest, IncrementalResolver) {
+  LLVMProjectIRDB BaseIRDB(PathToLLFiles + "incremental_01_cpp.ll");
+  LLVMProjectIRDB IRDB(PathToLLFiles + "incremental_01_changed_cpp.ll");
+  ASSERT_TRUE(BaseIRDB.isValid());
+  ASSERT_TRUE(IRDB.isValid());
+
+  auto Snapshot = takeSnapshot(BaseIRDB, CallGraphAnalysisType::CHA,
+                               AliasAnalysisType::CFLAnders);
+  LLVMIncrementalUpdateAnalysis IUA(Snapshot, IRDB);
+
+  LLVMTypeHierarchy TH(IRDB);
+  LLVMVFTableProvider VTP(IRDB);
+  auto Fallback =
+      Resolver::create(CallGraphAnalysisType::CHA, &IRDB, &VTP, &TH);
+  IncrementalResolver Res(
+      &IRDB, &VTP, *Fallback,
+      IUA.getReusableCallTargets(CallGraphAnalysisType::CHA,
+                                 AliasAnalysisType::CFLAnders, VTP));
+  EXPECT_EQ("IncrementalResolver(" + Fallback->str() + ")", Res.str());
+
+  LLVMBasedICFG ICF(&IRDB, Res, {"main"});
+  EXPECT_EQ(1U, Res.getNumReusedResolutions());
+
+  // The reused targets match a resolution from scratch. Each ICFG models the
+  // global ctors in its IRDB, so the fresh one gets its own copy of the module
+  LLVMProjectIRDB FreshIRDB(PathToLLFiles + "incremental_01_changed_cpp.ll");
+  ASSERT_TRUE(FreshIRDB.isValid());
+  LLVMTypeHierarchy FreshTH(FreshIRDB);
+  LLVMBasedICFG Fresh(&FreshIRDB, CallGraphAnalysisType::CHA, {"main"},
+                      &FreshTH);
+  const auto *VirtualCall = getIndirectCallIn(IRDB, Measure);
+  const auto *FPtrCall = getIndirectCallIn(IRDB, Apply);
+  ASSERT_NE(nullptr, VirtualCall);
+  ASSERT_NE(nullptr, FPtrCall);
+  EXPECT_EQ(2U, getCallees(ICF, VirtualCall).size());
+  EXPECT_EQ(getCallees(Fresh, getIndirectCallIn(FreshIRDB, Measure)),
+            getCallees(ICF, VirtualCall));
+  EXPECT_EQ(getCallees(Fresh, getIndirectCallIn(FreshIRDB, Apply)),
+            getCallees(ICF, FPtrCall));
+
+  // Known targets take precedence over the fallback resolver
+  const auto *IncFun = IRDB.getFunctionDefinition(Inc);
+  IncrementalResolver::KnownTargetsTy Known;
+  Known[FPtrCall].insert(IncFun);
+  IncrementalResolver KnownRes(&IRDB, &VTP, *Fallback, std::move(Known));
+  auto Callees = KnownRes.resolveFunctionPointer(FPtrCall);
+  EXPECT_EQ(1U, Callees.size());
+  EXPECT_EQ(1U, Callees.count(IncFun));
+  EXPECT_EQ(1U, KnownRes.getNumReusedResolutions());
+
+  EXPECT_EQ(Fallback->resolveVirtualCall(VirtualCall).size(),
+            KnownRes.resolveVirtualCall(VirtualCall).size());
+  EXPECT_EQ(1U, KnownRes.getNumReusedResolutions());
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,72 @@
+#include "phasar/PhasarLLVM/Utils/LLVMSourceCache.h"
+
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/Utils/LLVMIRToSrc.h"
+
+#include "llvm/IR/Function.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/Support/MemoryBuffer.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace psr;
+
+TEST(LLVMSourceCacheTest, LineIndex) {
+  LLVMSourceFile File(llvm::MemoryBuffer::getMemBuffer(
+      "first\n  second  \r\n\nlast", "mem", /*RequiresNullTerminator*/ false));
+
+  EXPECT_EQ(4U, File.getNumLines());
+  EXPECT_EQ("first", File.getLine(1));
+  EXPECT_EQ("  second  \r", File.getLine(2));
+  EXPECT_EQ("", File.getLine(3));
+  EXPECT_EQ("last", File.getLine(4));
+  EXPECT_EQ("", File.getLine(0));
+  EXPECT_EQ("", File.getLine(5));
+
+  LLVMSourceFile Terminated(
+      llvm::MemoryBuffer::getMemBuffer("a\nb\n", "mem2", false));
+  EXPECT_EQ(2U, Terminated.getNumLines());
+  EXPECT_EQ("b", Terminated.getLine(2));
+}
+
+TEST(LLVMSourceCacheTest, SrcCodeFromIR) {
+  LLVMProjectIRDB IRDB(PHASAR_BUILD_SUBFOLDER("llvmIRtoSrc/") +
+                       "source_cache_cpp_dbg.ll");
+  ASSERT_TRUE(IRDB.isValid());
+
+  const auto *Main = IRDB.getFunctionDefinition("main");
+  ASSERT_NE(nullptr, Main);
+  const llvm::Instruction *Ret = nullptr;
+  for (const auto &Inst : llvm::instructions(Main)) {
+    if (llvm::isa<llvm::ReturnInst>(Inst)) {
+      Ret = &Inst;
+    }
+  }
+  ASSERT_NE(nullptr, Ret);
+
+  EXPECT_EQ("int main() {", getSrcCodeFromIR(Main));
+  EXPECT_EQ("return x;", getSrcCodeFromIR(Ret));
+  EXPECT_EQ("  return x;", getSrcCodeFromIR(Ret, /*Trim*/ false));
+
+  // Both statements share the same loaded file
+  const auto *DIF = getDIFileFromIR(Main);
+  ASSERT_NE(nullptr, DIF);
+  const auto *File = LLVMSourceCache::getInstance().getFile(DIF);
+  ASSERT_NE(nullptr, File);
+  EXPECT_EQ(File,
+            LLVMSourceCache::getInstance().getFile(getFilePathFromIR(DIF)));
+  EXPECT_EQ("  int x = 42;", File->getLine(2));
+
+  LLVMSourceCache::getInstance().clear();
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
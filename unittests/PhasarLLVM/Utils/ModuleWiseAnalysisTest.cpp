@@ -0,0 +1,134 @@
+#include "phasar/AnalysisStrategy/ModuleWiseAnalysis.h"
+
+#include "phasar/PhasarLLVM/ControlFlow/LLVMBasedICFG.h"
+#include "phasar/PhasarLLVM/DB/LLVMProjectIRDB.h"
+#include "phasar/PhasarLLVM/DataFlow/IfdsIde/LLVMLibrarySummaryGenerator.h"
+#include "phasar/PhasarLLVM/Pointer/LLVMAliasSet.h"
+#include "phasar/PhasarLLVM/Utils/LLVMModuleInterface.h"
+
+#include "TestConfig.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace psr;
+
+TEST(ModuleWiseAnalysisTest, ComputeModuleInterface) {
+  LLVMProjectIRDB IRDB(PHASAR_BUILD_SUBFOLDER("module_wise/module_interface/") +
+                       "module_interface_cpp.ll");
+  ASSERT_TRUE(IRDB.isValid());
+
+  // Neither the static nor the inline function, nor the intrinsic are part of
+  // the interface
+  auto Interface =
+      computeModuleInterface(*IRDB.getModule(), "module_interface_cpp.ll");
+  EXPECT_EQ("module_interface_cpp.ll", Interface.Name);
+  EXPECT_EQ(std::vector<std::string>{"exported"}, Interface.Defines);
+  EXPECT_EQ(std::vector<std::string>{"imported"}, Interface.Declares);
+}
+
+TEST(ModuleWiseAnalysisTest, BottomUpStages) {
+  // main -> a -> b, main -> b
+  ModuleWiseAnalysis MWA({
+      {"main", {"main"}, {"a", "b", "printf"}},
+      {"a", {"a"}, {"b"}},
+      {"b", {"b"}, {}},
+  });
+
+  EXPECT_EQ(llvm::ArrayRef<uint32_t>({1, 2}), MWA.getDependencies(0));
+  EXPECT_EQ(llvm::ArrayRef<uint32_t>({2}), MWA.getDependencies(1));
+  EXPECT_TRUE(MWA.getDependencies(2).empty());
+
+  std::vector<std::vector<uint32_t>> Expected = {{2}, {1}, {0}};
+  EXPECT_EQ(Expected, MWA.getStages());
+  EXPECT_FALSE(MWA.isCyclic(0));
+  EXPECT_FALSE(MWA.isCyclic(1));
+  EXPECT_FALSE(MWA.isCyclic(2));
+}
+
+TEST(ModuleWiseAnalysisTest, IndependentModulesShareStage) {
+  ModuleWiseAnalysis MWA({
+      {"main", {"main"}, {"a", "b"}},
+      {"a", {"a"}, {}},
+      {"b", {"b"}, {}},
+  });
+
+  ASSERT_EQ(2U, MWA.getStages().size());
+  EXPECT_EQ((std::vector<uint32_t>{1, 2}), MWA.getStages()[0]);
+  EXPECT_EQ((std::vector<uint32_t>{0}), MWA.getStages()[1]);
+}
+
+TEST(ModuleWiseAnalysisTest, CyclicDependencies) {
+  // a and b call each other; main only calls a
+  ModuleWiseAnalysis MWA({
+      {"main", {"main"}, {"a"}},
+      {"a", {"a"}, {"b"}},
+      {"b", {"b"}, {"a"}},
+  });
+
+  EXPECT_FALSE(MWA.isCyclic(0));
+  EXPECT_TRUE(MWA.isCyclic(1));
+  EXPECT_TRUE(MWA.isCyclic(2));
+
+  ASSERT_EQ(2U, MWA.getStages().size());
+  EXPECT_EQ((std::vector<uint32_t>{1, 2}), MWA.getStages()[0]);
+  EXPECT_EQ((std::vector<uint32_t>{0}), MWA.getStages()[1]);
+  EXPECT_EQ((std::vector<uint32_t>{1, 2}), MWA.getTransitiveDependencies(0));
+}
+
+bool hasParameterFact(const std::vector<library_summary::DataFlowFact> &Facts,
+                      uint16_t Index) {
+  return llvm::any_of(Facts, [Index](const auto &Fact) {
+    const auto *Param = std::get_if<library_summary::Parameter>(&Fact.Fact);
+    return Param && Param->Index == Index;
+  });
+}
+
+bool hasReturnFact(const std::vector<library_summary::DataFlowFact> &Facts) {
+  return llvm::any_of(Facts, [](const auto &Fact) {
+    return std::holds_alternative<library_summary::ReturnValue>(Fact.Fact);
+  });
+}
+
+TEST(ModuleWiseAnalysisTest, GenerateLibrarySummary) {
+  LLVMProjectIRDB IRDB(PHASAR_BUILD_SUBFOLDER("summary_generation/") +
+                       "summary_library_c_m2r.ll");
+  ASSERT_TRUE(IRDB.isValid());
+
+  LLVMAliasSet PT(&IRDB);
+  // The globals model does not support library analysis with __ALL__
+  LLVMBasedICFG ICF(&IRDB, CallGraphAnalysisType::OTF, {"__ALL__"}, nullptr,
+                    &PT, Soundness::Soundy, /*IncludeGlobals*/ false);
+
+  auto Summary = library_summary::generateLibrarySummary(
+      IRDB, ICF, &PT, library_summary::LLVMFunctionDataFlowFacts{});
+
+  EXPECT_TRUE(hasParameterFact(Summary.getDataFlowFacts("copy", 1), 0));
+  EXPECT_TRUE(Summary.getDataFlowFacts("copy", 0).empty());
+
+  EXPECT_TRUE(hasReturnFact(Summary.getDataFlowFacts("id", 0)));
+
+  // Composed from the summary of copy
+  EXPECT_TRUE(hasParameterFact(Summary.getDataFlowFacts("wrap", 1), 0));
+
+  // Internal functions cannot be called from other modules and functions
+  // without any effect need no summary
+  auto Has = [&Summary](llvm::StringRef Fun) {
+    return llvm::any_of(Summary, [Fun](const auto &Entry) {
+      return Entry.getKey() == Fun;
+    });
+  };
+  EXPECT_TRUE(Has("copy"));
+  EXPECT_FALSE(Has("hidden"));
+  EXPECT_FALSE(Has("pure"));
+}
+
+} // namespace
+
+int main(int Argc, char **Argv) {
+  ::testing::InitGoogleTest(&Argc, Argv);
+  return RUN_ALL_TESTS();
+}
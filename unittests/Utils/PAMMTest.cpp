@@ -52,6 +52,62 @@ TEST_F(PAMMTest, HandleCounter) {
   EXPECT_EQ(Pamm.getCounter("third"), 0);
 }
 
+TEST_F(PAMMTest, HandleCounterHandles) {
+  PAMM &Pamm = PAMM::getInstance();
+  Pamm.regCounter("handled", 5);
+  auto Handle = PAMM::getCounterHandle("handled");
+  EXPECT_EQ(Handle.getIndex(), PAMM::getCounterHandle("handled").getIndex());
+
+  Pamm.incCounter(Handle, 10);
+  Pamm.decCounter(Handle, 3);
+  Pamm.incCounter("handled");
+  EXPECT_EQ(Pamm.getCounter(Handle), 13);
+  EXPECT_EQ(Pamm.getCounter("handled"), 13);
+}
+
+TEST_F(PAMMTest, HandleConcurrentCounters) {
+  PAMM &Pamm = PAMM::getInstance();
+  Pamm.regCounter("concurrent");
+  auto Handle = PAMM::getCounterHandle("concurrent");
+
+  constexpr unsigned NumThreads = 4;
+  constexpr unsigned NumIncrements = 100000;
+  std::vector<std::thread> Threads;
+  for (unsigned I = 0; I != NumThreads; ++I) {
+    Threads.emplace_back([&Pamm, Handle] {
+      for (unsigned J = 0; J != NumIncrements; ++J) {
+        Pamm.incCounter(Handle);
+      }
+      // Each thread runs its own instance of the same timer
+      Pamm.startTimer("per-thread");
+      Pamm.stopTimer("per-thread");
+    });
+  }
+  for (auto &Thread : Threads) {
+    Thread.join();
+  }
+
+  EXPECT_EQ(Pamm.getCounter(Handle), NumThreads * NumIncrements);
+}
+
+TEST_F(PAMMTest, HandleScopedTimer) {
+  PAMM &Pamm = PAMM::getInstance();
+  for (int I = 0; I < 3; ++I) {
+    PAMM::ScopedTimer Timer(Pamm, "scoped");
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  {
+    PAMM::ScopedTimer Disabled(Pamm, "disabled", /*Enabled*/ false);
+  }
+
+  auto Times = Pamm.elapsedTimeOfRepeatingTimer();
+  ASSERT_EQ(1, Times.size());
+  ASSERT_EQ(3, Times["scoped"].size());
+  for (auto Time : Times["scoped"]) {
+    EXPECT_GE(Time, 10);
+  }
+}
+
 TEST_F(PAMMTest, HandleJSONOutput) {
   PAMM &Pamm = PAMM::getInstance();
   Pamm.regCounter("timerCount");
@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+
+# Generates a constexpr library summary table (see
+# phasar/PhasarLLVM/DataFlow/IfdsIde/StaticFunctionDataFlowFacts.h) from a
+# summary spec file.
+#
+# Spec format: One data-flow fact per line; empty lines and lines starting with
+# '#' are ignored.
+#
+#   <function-name> <param-index> -> ret
+#   <function-name> <param-index> -> param <index>
+#
+# Example:
+#
+#   strcpy 1 -> param 0
+#   strcpy 1 -> ret
+#
+# The generated table is indexed by a minimal perfect hash over the function
+# names (hash-and-displace). The hash function must be kept in sync with
+# StaticFunctionDataFlowFacts::hash().
+
+import argparse
+import sys
+
+MASK32 = 0xFFFFFFFF
+RETURN_VALUE = -1
+
+
+def psr_hash(name, seed):
+    h = (2166136261 ^ ((seed * 0x9E3779B9) & MASK32)) & MASK32
+    for c in name.encode('utf-8'):
+        h ^= c
+        h = (h * 16777619) & MASK32
+    # final avalanche (murmur3 fmix32)
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK32
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK32
+    h ^= h >> 16
+    return h
+
+
+def parse_spec(path):
+    # function-name -> {param-index -> [fact, ...]}, preserving insertion order
+    summary = {}
+    with open(path, 'r') as spec:
+        for line_nr, line in enumerate(spec, start=1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            try:
+                lhs, rhs = line.split('->')
+                name, index = lhs.split()
+                target = rhs.split()
+                if target == ['ret']:
+                    fact = RETURN_VALUE
+                elif len(target) == 2 and target[0] == 'param':
+                    fact = int(target[1])
+                else:
+                    raise ValueError(rhs)
+                index = int(index)
+            except ValueError:
+                sys.exit('{}:{}: malformed summary entry: {}'.format(
+                    path, line_nr, line))
+
+            facts = summary.setdefault(name, {}).setdefault(index, [])
+            if fact not in facts:
+                facts.append(fact)
+    return summary
+
+
+def build_perfect_hash(names):
+    num_slots = len(names)
+    num_buckets = max(1, num_slots // 2)
+
+    buckets = [[] for _ in range(num_buckets)]
+    for name in names:
+        buckets[psr_hash(name, 0) % num_buckets].append(name)
+
+    displacements = [0] * num_buckets
+    slots = [None] * num_slots
+
+    # Place the largest buckets first; they are the hardest to fit
+    order = sorted(range(num_buckets), key=lambda b: len(buckets[b]),
+                   reverse=True)
+    pos = 0
+    for pos, bucket_idx in enumerate(order):
+        bucket = buckets[bucket_idx]
+        if len(bucket) <= 1:
+            break
+
+        seed = 1
+        while True:
+            candidate = [psr_hash(name, seed) % num_slots for name in bucket]
+            if len(set(candidate)) == len(candidate) and all(
+                    slots[slot] is None for slot in candidate):
+                break
+            seed += 1
+            if seed > 0x7FFFFFFF:
+                sys.exit('cannot build a perfect hash for the given names')
+
+        displacements[bucket_idx] = seed
+        for name, slot in zip(bucket, candidate):
+            slots[slot] = name
+    else:
+        pos = len(order)
+
+    # Buckets with a single entry directly encode their slot as a negative
+    # displacement
+    free_slots = [slot for slot, name in enumerate(slots) if name is None]
+    for bucket_idx in order[pos:]:
+        bucket = buckets[bucket_idx]
+        if not bucket:
+            continue
+        slot = free_slots.pop()
+        displacements[bucket_idx] = -slot - 1
+        slots[slot] = bucket[0]
+
+    return slots, displacements
+
+
+def fact_to_cpp(fact):
+    if fact == RETURN_VALUE:
+        return 'ReturnValue{}'
+    return 'Parameter{{{}}}'.format(fact)
+
+
+def generate(summary, table_name, spec_name, out):
+    names = list(summary.keys())
+    slots, displacements = build_perfect_hash(names)
+
+    # Fact-lists are shared between all parameters that have equal facts
+    facts = []
+    fact_lists = {}
+    params = []
+    functions = []
+    for name in slots:
+        params_begin = len(params)
+        for index, index_facts in sorted(summary[name].items()):
+            key = tuple(index_facts)
+            if key not in fact_lists:
+                fact_lists[key] = len(facts)
+                facts.extend(index_facts)
+            begin = fact_lists[key]
+            params.append((index, begin, begin + len(index_facts)))
+        functions.append((name, params_begin, len(params)))
+
+    out.write('// Generated by utils/phasar-gen-library-summary.py from {}.\n'
+              '// DO NOT EDIT!\n\n'.format(spec_name))
+    out.write('namespace {\n')
+    out.write('using namespace psr::library_summary;\n\n')
+
+    out.write('constexpr DataFlowFact {}Facts[] = {{\n'.format(table_name))
+    for fact in facts:
+        out.write('    {},\n'.format(fact_to_cpp(fact)))
+    out.write('};\n\n')
+
+    out.write('constexpr StaticParameterFacts {}Params[] = {{\n'.format(
+        table_name))
+    for index, begin, end in params:
+        out.write('    {{{}, {}, {}}},\n'.format(index, begin, end))
+    out.write('};\n\n')
+
+    out.write('constexpr StaticFunctionSummary {}Functions[] = {{\n'.format(
+        table_name))
+    for name, begin, end in functions:
+        out.write('    {{"{}", {}, {}}},\n'.format(name, begin, end))
+    out.write('};\n\n')
+
+    out.write('constexpr int32_t {}Displacements[] = {{\n'.format(table_name))
+    for disp in displacements:
+        out.write('    {},\n'.format(disp))
+    out.write('};\n\n')
+
+    out.write('constexpr StaticFunctionDataFlowFacts {0}{{\n'
+              '    {0}Functions, {0}Displacements,\n'
+              '    {0}Params, {0}Facts}};\n'.format(table_name))
+    out.write('} // namespace\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate a constexpr library summary table from a '
+        'summary spec file')
+    parser.add_argument('spec', help='the summary spec file')
+    parser.add_argument('-n', '--name', required=True,
+                        help='name of the generated table, e.g. LibCSummary')
+    parser.add_argument('-o', '--output', default='-',
+                        help='output file (default: stdout)')
+    args = parser.parse_args()
+
+    summary = parse_spec(args.spec)
+    if not summary:
+        sys.exit('{}: the summary spec is empty'.format(args.spec))
+
+    spec_name = args.spec.replace('\\', '/').split('/')[-1]
+    if args.output == '-':
+        generate(summary, args.name, spec_name, sys.stdout)
+    else:
+        with open(args.output, 'w') as out:
+            generate(summary, args.name, spec_name, out)
+
+
+if __name__ == '__main__':
+    main()